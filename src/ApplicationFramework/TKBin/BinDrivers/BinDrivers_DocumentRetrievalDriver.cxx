@@ -72,6 +72,21 @@ void BinDrivers_DocumentRetrievalDriver::ReadShapeSection(
 
 //=================================================================================================
 
+void BinDrivers_DocumentRetrievalDriver::DeferShapeSection(
+  BinLDrivers_DocumentSection& /*theSection*/,
+  Standard_IStream& theIS)
+{
+  occ::handle<BinMDF_ADriver> aDriver;
+  if (myDrivers->GetDriver(STANDARD_TYPE(TNaming_NamedShape), aDriver))
+  {
+    occ::handle<BinMNaming_NamedShapeDriver> aNamedShapeDriver =
+      occ::down_cast<BinMNaming_NamedShapeDriver>(aDriver);
+    aNamedShapeDriver->DeferShapeSection(theIS);
+  }
+}
+
+//=================================================================================================
+
 void BinDrivers_DocumentRetrievalDriver::CheckShapeSection(
   const Storage_Position& /*ShapeSectionPos*/,
   Standard_IStream& /*IS*/)
@@ -42,6 +42,10 @@ public:
     const bool                   isMess   = false,
     const Message_ProgressRange& theRange = Message_ProgressRange()) override;
 
+  //! Postpones reading of the shapes section till the first NamedShape attribute is retrieved.
+  Standard_EXPORT void DeferShapeSection(BinLDrivers_DocumentSection& theSection,
+                                         Standard_IStream&            theIS) override;
+
   Standard_EXPORT void CheckShapeSection(const Storage_Position& thePos,
                                          Standard_IStream&       theIS) override;
 
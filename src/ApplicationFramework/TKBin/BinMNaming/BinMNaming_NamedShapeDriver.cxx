@@ -21,6 +21,8 @@
 #include <BinTools_ShapeReader.hxx>
 #include <Message_Messenger.hxx>
 #include <Standard_DomainError.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_Type.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <TDF_Attribute.hxx>
@@ -181,6 +183,8 @@ BinMNaming_NamedShapeDriver::BinMNaming_NamedShapeDriver(
   const occ::handle<Message_Messenger>& theMsgDriver)
     : BinMDF_ADriver(theMsgDriver, STANDARD_TYPE(TNaming_NamedShape)->Name()),
       myShapeSet(nullptr),
+      myDeferredStream(nullptr),
+      myDeferredPos(0),
       myWithTriangles(false),
       myWithNormals(false),
       myIsQuickPart(false)
@@ -221,6 +225,11 @@ bool BinMNaming_NamedShapeDriver::Paste(const BinObjMgt_Persistent&       theSou
   TNaming_Evolution anEvol = EvolutionToEnum(aCharEvol); // Evolution
   aTAtt->SetVersion(anEvol);
 
+  if (!const_cast<BinMNaming_NamedShapeDriver*>(this)->ReadDeferredShapeSection())
+  {
+    return false;
+  }
+
   BinTools_ShapeSetBase* aShapeSet = const_cast<BinMNaming_NamedShapeDriver*>(this)->ShapeSet(true);
   Standard_IStream*      aDirectStream = nullptr;
   if (myIsQuickPart)
@@ -363,7 +372,8 @@ void BinMNaming_NamedShapeDriver::WriteShapeSection(Standard_OStream&
                                                     const int                    theDocVer,
                                                     const Message_ProgressRange& theRange)
 {
-  myIsQuickPart = false;
+  myIsQuickPart    = false;
+  myDeferredStream = nullptr;
   theOS << SHAPESET;
   if (theDocVer >= TDocStd_FormatVersion_VERSION_11)
   {
@@ -381,6 +391,7 @@ void BinMNaming_NamedShapeDriver::WriteShapeSection(Standard_OStream&
 
 void BinMNaming_NamedShapeDriver::Clear()
 {
+  myDeferredStream = nullptr;
   if (myShapeSet)
   {
     myShapeSet->Clear();
@@ -414,6 +425,50 @@ void BinMNaming_NamedShapeDriver::ReadShapeSection(Standard_IStream&
 
 //=================================================================================================
 
+void BinMNaming_NamedShapeDriver::DeferShapeSection(Standard_IStream& theIS)
+{
+  myIsQuickPart    = false;
+  myDeferredStream = &theIS;
+  myDeferredPos    = theIS.tellg();
+  if (myShapeSet)
+  {
+    myShapeSet->Clear();
+  }
+}
+
+//=================================================================================================
+
+bool BinMNaming_NamedShapeDriver::ReadDeferredShapeSection()
+{
+  if (myDeferredStream == nullptr)
+  {
+    return true;
+  }
+
+  Standard_IStream&    anIS     = *myDeferredStream;
+  const std::streampos aCurrPos = anIS.tellg();
+  anIS.seekg(myDeferredPos);
+  bool isOk = true;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    ReadShapeSection(anIS);
+  }
+  catch (Standard_Failure const& anException)
+  {
+    myMessageDriver->Send(TCollection_AsciiString("BinMNaming_NamedShapeDriver: ")
+                            + "error of Shape Section " + anException.what(),
+                          Message_Fail);
+    isOk = false;
+  }
+  myDeferredStream = nullptr;
+  anIS.clear();
+  anIS.seekg(aCurrPos);
+  return isOk;
+}
+
+//=================================================================================================
+
 BinTools_ShapeSetBase* BinMNaming_NamedShapeDriver::ShapeSet(const bool theReading)
 {
   if (!myShapeSet)
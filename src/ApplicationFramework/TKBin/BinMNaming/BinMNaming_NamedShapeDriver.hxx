@@ -55,6 +55,18 @@ public:
     Standard_IStream&            theIS,
     const Message_ProgressRange& therange = Message_ProgressRange());
 
+  //! Remembers the position of the shapes section in the stream theIS to read
+  //! the section only when the first attribute is retrieved by Paste()
+  //! or by another driver using the shapes locations (see ReadDeferredShapeSection()).
+  //! The stream should be kept alive till the reading of attributes is finished.
+  Standard_EXPORT void DeferShapeSection(Standard_IStream& theIS);
+
+  //! Reads the shapes section postponed by DeferShapeSection(), if any,
+  //! restoring the current position of the stream.
+  //! Should be called by the drivers using GetShapesLocations() on reading.
+  //! Returns false if the section cannot be read.
+  Standard_EXPORT bool ReadDeferredShapeSection();
+
   //! Output the shapes into Bin Document file
   Standard_EXPORT void WriteShapeSection(
     Standard_OStream&            theOS,
@@ -91,6 +103,8 @@ public:
 
 private:
   BinTools_ShapeSetBase* myShapeSet;
+  Standard_IStream*      myDeferredStream; //!< stream containing not yet read shapes section
+  std::streampos         myDeferredPos;    //!< position of not yet read shapes section
   bool                   myWithTriangles;
   bool                   myWithNormals;
   //! Enables storing of whole shape data just in the attribute, not in a separated shapes section
@@ -211,8 +211,9 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
   }
   myDrivers->AssignIds(aTypeNames);
 
-  // recognize types not supported by drivers
-  myMapUnsupported.Clear();
+  // recognize types not supported by drivers;
+  // the data left by previous (e.g. interrupted) reading are released as well
+  Clear();
   for (i = 1; i <= aTypeNames.Length(); i++)
   {
     if (myDrivers->GetDriver(i).IsNull())
@@ -246,6 +247,8 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
 
   Message_ProgressScope aPS(theRange, "Reading data", 3);
   bool                  aQuickPart = IsQuickPart(aFileVer);
+  // in case of partial reading the shapes section is parsed only if some shape is retrieved
+  const bool aToDeferShapes = !theFilter.IsNull();
 
   // 2b. Read the TOC of Sections
   if (aFileVer >= TDocStd_FormatVersion_VERSION_3)
@@ -283,7 +286,15 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
           theIStream.seekg((std::streampos)aCurSection.Offset());
           if (aCurSection.Name().IsEqual(SHAPESECTION_POS))
           {
-            ReadShapeSection(aCurSection, theIStream, false, aPS.Next());
+            if (aToDeferShapes)
+            {
+              DeferShapeSection(aCurSection, theIStream);
+              aPS.Next();
+            }
+            else
+            {
+              ReadShapeSection(aCurSection, theIStream, false, aPS.Next());
+            }
             if (!aPS.More())
             {
               myReaderStatus = PCDM_RS_UserBreak;
@@ -337,7 +348,15 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
         CheckShapeSection(aShapeSectionPos, theIStream);
         // Read Shapes
         BinLDrivers_DocumentSection aCurSection;
-        ReadShapeSection(aCurSection, theIStream, false, aPS.Next());
+        if (aToDeferShapes)
+        {
+          DeferShapeSection(aCurSection, theIStream);
+          aPS.Next();
+        }
+        else
+        {
+          ReadShapeSection(aCurSection, theIStream, false, aPS.Next());
+        }
         if (!aPS.More())
         {
           myReaderStatus = PCDM_RS_UserBreak;
@@ -683,6 +702,14 @@ void BinLDrivers_DocumentRetrievalDriver::ReadShapeSection(
 
 //=================================================================================================
 
+void BinLDrivers_DocumentRetrievalDriver::DeferShapeSection(BinLDrivers_DocumentSection& theSection,
+                                                            Standard_IStream&            theIS)
+{
+  ReadShapeSection(theSection, theIS);
+}
+
+//=================================================================================================
+
 void BinLDrivers_DocumentRetrievalDriver::CheckShapeSection(const Storage_Position& ShapeSectionPos,
                                                             Standard_IStream&       IS)
 {
@@ -87,6 +87,14 @@ protected:
     const bool                   isMess   = false,
     const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! define the procedure of deferred reading of a shapes section: the section
+  //! positioned at the current point of the stream <theIS> should be read only when
+  //! the first attribute referring to the shapes is retrieved, so that it is not parsed
+  //! at all if the reader filter rejects all such attributes.
+  //! The default implementation reads the section immediately.
+  Standard_EXPORT virtual void DeferShapeSection(BinLDrivers_DocumentSection& theSection,
+                                                 Standard_IStream&            theIS);
+
   //! checks the shapes section can be correctly retrieved.
   Standard_EXPORT virtual void CheckShapeSection(const Storage_Position& thePos,
                                                  Standard_IStream&       theIS);
@@ -109,6 +109,11 @@ bool BinMXCAFDoc_LocationDriver::Translate(const BinObjMgt_Persistent& theSource
 
   if (aFileVer >= TDocStd_FormatVersion_VERSION_6)
   {
+    // the shapes section (sharing the locations) might be deferred by partial retrieval
+    if (!myNSDriver->ReadDeferredShapeSection())
+    {
+      return false;
+    }
     const TopLoc_Location& aLoc = myNSDriver->GetShapesLocations().Location(anId);
     aPower                      = aLoc.FirstPower();
     aDatum                      = aLoc.FirstDatum();
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinXCAFDrivers.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <PCDM_ReaderFilter.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDF_Label.hxx>
+#include <TDF_Tool.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TNaming_NamedShape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Shape.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_Location.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+//! Test fixture with a binary XCAF document of version 11 (shapes in a separate section)
+//! containing an assembly with a located component.
+class BinXCAFDrivers_PartialRetrievalTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    myApp = new TDocStd_Application();
+    BinXCAFDrivers::DefineFormat(myApp);
+
+    occ::handle<TDocStd_Document> aDoc;
+    myApp->NewDocument("BinXCAF", aDoc);
+    occ::handle<XCAFDoc_ShapeTool> aShapeTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+
+    const TDF_Label aBoxLabel = aShapeTool->AddShape(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0), false);
+    const TDF_Label anAsmLabel = aShapeTool->NewShape();
+    gp_Trsf         aTrsf;
+    aTrsf.SetTranslation(gp_Vec(100.0, 0.0, 0.0));
+    const TDF_Label aCompLabel =
+      aShapeTool->AddComponent(anAsmLabel, aBoxLabel, TopLoc_Location(aTrsf));
+    aShapeTool->UpdateAssemblies();
+    TDataStd_Name::Set(aBoxLabel, "Box");
+    TDF_Tool::Entry(aBoxLabel, myBoxEntry);
+    TDF_Tool::Entry(aCompLabel, myCompEntry);
+
+    aDoc->ChangeStorageFormatVersion(TDocStd_FormatVersion_VERSION_11);
+    ASSERT_EQ(myApp->SaveAs(aDoc, myStream), PCDM_SS_OK);
+    myApp->Close(aDoc);
+  }
+
+  void TearDown() override
+  {
+    if (!myDoc.IsNull())
+    {
+      myApp->Close(myDoc);
+    }
+  }
+
+  //! Retrieves the saved document with the filter.
+  void open(const occ::handle<PCDM_ReaderFilter>& theFilter)
+  {
+    myStream.seekg(0);
+    ASSERT_EQ(myApp->Open(myStream, myDoc, theFilter), PCDM_RS_OK);
+  }
+
+  //! Returns label of the retrieved document by the entry.
+  TDF_Label label(const TCollection_AsciiString& theEntry) const
+  {
+    TDF_Label aLabel;
+    TDF_Tool::Label(myDoc->GetData(), theEntry, aLabel);
+    return aLabel;
+  }
+
+  //! Checks location of the component in the retrieved document.
+  void checkLocation() const
+  {
+    occ::handle<XCAFDoc_Location> aLocation;
+    ASSERT_TRUE(label(myCompEntry).FindAttribute(XCAFDoc_Location::GetID(), aLocation));
+    const gp_XYZ aTranslation = aLocation->Get().Transformation().TranslationPart();
+    EXPECT_NEAR(aTranslation.X(), 100.0, 1.0e-12);
+    EXPECT_NEAR(aTranslation.Y(), 0.0, 1.0e-12);
+    EXPECT_NEAR(aTranslation.Z(), 0.0, 1.0e-12);
+  }
+
+protected:
+  occ::handle<TDocStd_Application> myApp;
+  occ::handle<TDocStd_Document>    myDoc;
+  std::stringstream                myStream;
+  TCollection_AsciiString          myBoxEntry;
+  TCollection_AsciiString          myCompEntry;
+};
+} // namespace
+
+// Shapes are not retrieved, but locations shared with the shapes section are resolved.
+TEST_F(BinXCAFDrivers_PartialRetrievalTest, SkippedNamedShape)
+{
+  open(new PCDM_ReaderFilter(STANDARD_TYPE(TNaming_NamedShape)));
+
+  EXPECT_FALSE(label(myBoxEntry).IsAttribute(TNaming_NamedShape::GetID()));
+  occ::handle<TDataStd_Name> aName;
+  ASSERT_TRUE(label(myBoxEntry).FindAttribute(TDataStd_Name::GetID(), aName));
+  EXPECT_TRUE(aName->Get().IsEqual("Box"));
+  checkLocation();
+}
+
+// Deferred shapes section is read once for both shapes and locations.
+TEST_F(BinXCAFDrivers_PartialRetrievalTest, SkippedOtherAttribute)
+{
+  open(new PCDM_ReaderFilter(STANDARD_TYPE(TDataStd_Name)));
+
+  EXPECT_FALSE(label(myBoxEntry).IsAttribute(TDataStd_Name::GetID()));
+  checkLocation();
+
+  const TopoDS_Shape aBox = XCAFDoc_ShapeTool::GetShape(label(myBoxEntry));
+  ASSERT_FALSE(aBox.IsNull());
+  int aNbFaces = 0;
+  for (TopExp_Explorer anExp(aBox, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNbFaces;
+  }
+  EXPECT_EQ(aNbFaces, 6);
+
+  const TopoDS_Shape aComp = XCAFDoc_ShapeTool::GetShape(label(myCompEntry));
+  ASSERT_FALSE(aComp.IsNull());
+  EXPECT_TRUE(aComp.IsPartner(aBox));
+  EXPECT_NEAR(aComp.Location().Transformation().TranslationPart().X(), 100.0, 1.0e-12);
+}
@@ -2,4 +2,5 @@
 set(OCCT_TKBinXCAF_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKBinXCAF_GTests_FILES
+  BinXCAFDrivers_Test.cxx
 )
@@ -91,7 +91,7 @@ TCollection_AsciiString DEBREP_ConfigurationNode::Save() const
 
   aResult += "!\n";
   aResult += "!Defines the format version for the binary format writing\n";
-  aResult += "!Default value: 4. Available values: 1, 2, 3, 4\n";
+  aResult += "!Default value: 4. Available values: 1, 2, 3, 4, 5\n";
   aResult += aScope + "write.version.binary :\t " + InternalParameters.WriteVersionBin + "\n";
   aResult += "!\n";
 
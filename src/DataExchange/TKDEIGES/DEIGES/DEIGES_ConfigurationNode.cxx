@@ -89,6 +89,8 @@ bool DEIGES_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("read.fau_lty.entities", InternalParameters.ReadFaultyEntities, aScope);
   InternalParameters.ReadOnlyVisible =
     theResource->BooleanVal("read.onlyvisible", InternalParameters.ReadOnlyVisible, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
   InternalParameters.ReadColor =
     theResource->BooleanVal("read.color", InternalParameters.ReadColor, aScope);
   InternalParameters.ReadName =
@@ -243,6 +245,12 @@ TCollection_AsciiString DEIGES_ConfigurationNode::Save() const
   aResult += aScope + "read.onlyvisible :\t " + InternalParameters.ReadOnlyVisible + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Defines whether to load the file entities in parallel threads or not\n";
+  aResult += "!Default value: \"Off\"(0). Available values: \"Off\"(0), \"On\"(1)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Setting up the ColorMode parameter which is used to indicate read Colors or not\n";
   aResult += "!Default value: 1. Available values: 0, 1\n";
@@ -32,6 +32,7 @@ void DEIGES_Parameters::InitFromStatic()
   ReadApproxd1       = Interface_Static::IVal("read.bspline.approxd1.mode") == 1;
   ReadFaultyEntities = Interface_Static::IVal("read.fau_lty.entities") == 1;
   ReadOnlyVisible    = Interface_Static::IVal("read.onlyvisible") == 1;
+  ReadParallel       = Interface_Static::IVal("read.iges.parallel") == 1;
   ReadColor          = Interface_Static::IVal("read.color") == 1;
   ReadName           = Interface_Static::IVal("read.name") == 1;
   ReadLayer          = Interface_Static::IVal("read.layer") == 1;
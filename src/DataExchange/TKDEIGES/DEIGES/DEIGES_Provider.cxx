@@ -201,6 +201,7 @@ void DEIGES_Provider::initStatic(const occ::handle<DE_ConfigurationNode>& theNod
   myOldValues.ReadApproxd1       = Interface_Static::IVal("read.iges.bspline.approxd1.mode") == 1;
   myOldValues.ReadFaultyEntities = Interface_Static::IVal("read.iges.faulty.entities") == 1;
   myOldValues.ReadOnlyVisible    = Interface_Static::IVal("read.iges.onlyvisible") == 1;
+  myOldValues.ReadParallel       = Interface_Static::IVal("read.iges.parallel") == 1;
 
   myOldValues.WriteBRepMode =
     (DEIGES_Parameters::WriteMode_BRep)Interface_Static::IVal("write.iges.brep.mode");
@@ -247,6 +248,7 @@ void DEIGES_Provider::setStatic(const DEIGES_Parameters& theParameter)
   Interface_Static::SetIVal("read.iges.bspline.approxd1.mode", theParameter.ReadApproxd1);
   Interface_Static::SetIVal("read.iges.faulty.entities", theParameter.ReadFaultyEntities);
   Interface_Static::SetIVal("read.iges.onlyvisible", theParameter.ReadOnlyVisible);
+  Interface_Static::SetIVal("read.iges.parallel", theParameter.ReadParallel);
 
   Interface_Static::SetIVal("write.iges.brep.mode", theParameter.WriteBRepMode);
   Interface_Static::SetIVal("write.convertsurface.mode", theParameter.WriteConvertSurfaceMode);
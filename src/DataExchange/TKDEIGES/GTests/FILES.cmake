@@ -3,4 +3,5 @@ set(OCCT_TKDEIGES_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDEIGES_GTests_FILES
     IGESExportTest.cxx
+    IGESData_IGESReaderTool_Test.cxx
 )
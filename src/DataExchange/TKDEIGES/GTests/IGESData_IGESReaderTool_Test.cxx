@@ -0,0 +1,121 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <IGESControl_Controller.hxx>
+#include <IGESControl_Reader.hxx>
+#include <IGESControl_Writer.hxx>
+#include <IGESData_IGESEntity.hxx>
+#include <IGESData_IGESModel.hxx>
+#include <IGESData_IGESWriter.hxx>
+#include <IGESSelect_WorkLibrary.hxx>
+#include <Interface_Check.hxx>
+#include <Interface_Static.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <filesystem>
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes a compound of several primitives into an IGES file, in BRep and faces modes.
+void writeSampleIges(const std::filesystem::path& theFile, const int theBRepMode)
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(5.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(3.0, 8.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeTorus(10.0, 2.0).Shape());
+
+  IGESControl_Writer aWriter("MM", theBRepMode);
+  EXPECT_TRUE(aWriter.AddShape(aCompound));
+  aWriter.ComputeModel();
+  EXPECT_TRUE(aWriter.Write(theFile.string().c_str()));
+}
+
+//! Reads IGES file into a model, with or without parallel loading of entities.
+//! The model is owned by theReader, which should be kept alive while the model is used.
+occ::handle<IGESData_IGESModel> readIges(const std::filesystem::path& theFile,
+                                         const bool                   theIsParallel,
+                                         IGESControl_Reader&          theReader)
+{
+  IGESControl_Controller::Init();
+  const int anOldValue = Interface_Static::IVal("read.iges.parallel");
+  Interface_Static::SetIVal("read.iges.parallel", theIsParallel ? 1 : 0);
+
+  EXPECT_EQ(theReader.ReadFile(theFile.string().c_str()), IFSelect_RetDone);
+  Interface_Static::SetIVal("read.iges.parallel", anOldValue);
+  return theReader.IGESModel();
+}
+
+//! Formats the model back into IGES text, to compare the loaded contents.
+std::string dumpModel(const occ::handle<IGESData_IGESModel>& theModel)
+{
+  IGESData_IGESWriter aWriter(theModel);
+  aWriter.SendModel(IGESSelect_WorkLibrary::DefineProtocol());
+  std::ostringstream aStream;
+  aWriter.Print(aStream);
+  return aStream.str();
+}
+
+//! Checks that parallel loading of the file gives the same model as the sequential one.
+void checkSameModel(const int theBRepMode)
+{
+  const std::filesystem::path aFile =
+    std::filesystem::temp_directory_path()
+    / ("occt_iges_reader_tool_test_" + std::to_string(theBRepMode) + ".igs");
+  writeSampleIges(aFile, theBRepMode);
+
+  IGESControl_Reader              aSeqReader, aParReader;
+  occ::handle<IGESData_IGESModel> aSeqModel = readIges(aFile, false, aSeqReader);
+  occ::handle<IGESData_IGESModel> aParModel = readIges(aFile, true, aParReader);
+  std::filesystem::remove(aFile);
+  ASSERT_FALSE(aSeqModel.IsNull());
+  ASSERT_FALSE(aParModel.IsNull());
+  ASSERT_GT(aSeqModel->NbEntities(), 0);
+  ASSERT_EQ(aSeqModel->NbEntities(), aParModel->NbEntities());
+
+  for (int anIndex = 1; anIndex <= aSeqModel->NbEntities(); ++anIndex)
+  {
+    const occ::handle<IGESData_IGESEntity> aSeqEnt = aSeqModel->Entity(anIndex);
+    const occ::handle<IGESData_IGESEntity> aParEnt = aParModel->Entity(anIndex);
+    EXPECT_EQ(aSeqEnt->DynamicType(), aParEnt->DynamicType()) << "Entity " << anIndex;
+    EXPECT_EQ(aSeqEnt->FormNumber(), aParEnt->FormNumber()) << "Entity " << anIndex;
+    EXPECT_EQ(aSeqModel->IsErrorEntity(anIndex), aParModel->IsErrorEntity(anIndex))
+      << "Entity " << anIndex;
+  }
+  EXPECT_EQ(aSeqModel->GlobalCheck()->NbWarnings(), aParModel->GlobalCheck()->NbWarnings());
+  EXPECT_EQ(aSeqModel->GlobalCheck()->NbFails(), aParModel->GlobalCheck()->NbFails());
+
+  EXPECT_EQ(dumpModel(aSeqModel), dumpModel(aParModel));
+}
+} // namespace
+
+// Parallel loading of entities should give the same model as the sequential one (faces mode)
+TEST(IGESData_IGESReaderToolTest, ParallelLoadingMatchesSequentialFaces)
+{
+  checkSameModel(0);
+}
+
+// Parallel loading of entities should give the same model as the sequential one (BRep mode)
+TEST(IGESData_IGESReaderToolTest, ParallelLoadingMatchesSequentialBRep)
+{
+  checkSameModel(1);
+}
@@ -139,7 +139,7 @@ bool IGESData_IGESReaderTool::AnalyseRecord(const int
     ReadDir(ent, igesdat, igesdat->DirPart(num), ach);
   }
 
-  thestep = IGESData_ReadDir;
+  IGESData_ReadStage aStep = IGESData_ReadDir;
 
   //   Parameter List : control of its header
   //  occ::handle<Interface_ParamList> list = Data()->Params(num);
@@ -169,13 +169,13 @@ bool IGESData_IGESReaderTool::AnalyseRecord(const int
   }
 
   IGESData_ParamReader PR(thelist, ach, n0par, nbpar, num);
-  thestep = IGESData_ReadOwn;
+  aStep = IGESData_ReadOwn;
   ReadOwnParams(ent, igesdat, PR);
-  if ((thestep = PR.Stage()) == IGESData_ReadOwn)
+  if ((aStep = PR.Stage()) == IGESData_ReadOwn)
   {
     PR.NextStage();
   }
-  if (thestep == IGESData_ReadEnd)
+  if (aStep == IGESData_ReadEnd)
   {
     if (!PR.IsCheckEmpty())
     {
@@ -185,11 +185,11 @@ bool IGESData_IGESReaderTool::AnalyseRecord(const int
   }
 
   ReadAssocs(ent, igesdat, PR);
-  if ((thestep = PR.Stage()) == IGESData_ReadAssocs)
+  if ((aStep = PR.Stage()) == IGESData_ReadAssocs)
   {
     PR.NextStage();
   }
-  if (thestep == IGESData_ReadEnd)
+  if (aStep == IGESData_ReadEnd)
   {
     if (!PR.IsCheckEmpty())
     {
@@ -198,7 +198,7 @@ bool IGESData_IGESReaderTool::AnalyseRecord(const int
     return (!ach->HasFailed());
   }
   ReadProps(ent, igesdat, PR);
-  //  thestep = IGESData_ReadEnd;
+  //  aStep = IGESData_ReadEnd;
   if (!PR.IsCheckEmpty())
   {
     ach = PR.Check();
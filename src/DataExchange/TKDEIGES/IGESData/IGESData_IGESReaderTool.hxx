@@ -117,7 +117,6 @@ private:
   Interface_ReaderLib                  therlib;
   int                                  thecnum;
   IGESData_IGESType                    thectyp;
-  IGESData_ReadStage                   thestep;
   occ::handle<Interface_Check>         thechk;
   int                                  thegradweight;
   double                               themaxweight;
@@ -30,8 +30,6 @@
 #include <TCollection_HAsciiString.hxx>
 
 #include <cstdio>
-// MGE 03/08/98
-static int testconv = -1; // see session parameter
 
 //  ....              Gestion generale (etat, courant ...)              ....
 
@@ -508,6 +508,7 @@ private:
   int                              thenbterm;
   int                              pbrealint;
   int                              pbrealform;
+  int                              testconv; //!< conversion check mode, see session parameter
   int                              thenum;
 };
 
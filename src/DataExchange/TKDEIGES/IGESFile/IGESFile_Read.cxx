@@ -19,6 +19,7 @@
 #include <IGESData_IGESReaderTool.hxx>
 #include <IGESData_GeneralModule.hxx>
 #include <Interface_Check.hxx>
+#include <Interface_Static.hxx>
 
 //  To handle exceptions:
 #include <Standard_ErrorHandler.hxx>
@@ -169,6 +170,7 @@ int IGESFile_Read(char*                                       nomfic,
   IGESData_IGESReaderTool IT(IR, protocol);
   IT.Prepare(reco);
   IT.SetErrorHandle(true);
+  IT.SetParallel(Interface_Static::IVal("read.iges.parallel") == 1);
 
   // Sending of message : Loading of Model : Beginning
   IT.LoadModel(amodel);
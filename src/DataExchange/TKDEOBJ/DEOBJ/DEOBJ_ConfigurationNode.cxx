@@ -66,6 +66,8 @@ bool DEOBJ_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>& t
     theResource->BooleanVal("read.single.precision",
                             InternalParameters.ReadSinglePrecision,
                             aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
   InternalParameters.ReadCreateShapes =
     theResource->BooleanVal("read.create.shapes", InternalParameters.ReadCreateShapes, aScope);
   InternalParameters.ReadRootPrefix =
@@ -128,6 +130,12 @@ TCollection_AsciiString DEOBJ_ConfigurationNode::Save() const
   aResult += aScope + "read.single.precision :\t " + InternalParameters.ReadSinglePrecision + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to use multithreading\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Flag for create a single triangulation\n";
   aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
@@ -86,6 +86,7 @@ public:
     RWMesh_CoordinateSystem FileCS = RWMesh_CoordinateSystem_Yup; //!< File origin coordinate system to perform conversion during read
     // Reading
     bool ReadSinglePrecision = false; //!< Flag for reading vertex data with single or double floating point precision
+    bool ReadParallel = false; //!< Flag to use multithreading
     bool ReadCreateShapes = false;  //!< Flag for create a single triangulation
     TCollection_AsciiString ReadRootPrefix; //!< Root folder for generating root labels names
     bool ReadFillDoc = true; //!< Flag for fill document from shape sequence
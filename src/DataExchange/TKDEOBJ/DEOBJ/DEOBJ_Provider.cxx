@@ -77,6 +77,7 @@ bool DEOBJ_Provider::Read(const TCollection_AsciiString&       thePath,
   occ::handle<DEOBJ_ConfigurationNode> aNode = occ::down_cast<DEOBJ_ConfigurationNode>(GetNode());
   RWObj_CafReader                      aReader;
   aReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
+  aReader.SetParallel(aNode->InternalParameters.ReadParallel);
   aReader.SetSystemLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
   aReader.SetSystemCoordinateSystem(aNode->InternalParameters.SystemCS);
   aReader.SetFileLengthUnit(aNode->InternalParameters.FileLengthUnit);
@@ -195,6 +196,7 @@ bool DEOBJ_Provider::Read(const TCollection_AsciiString& thePath,
   aSimpleReader.SetTransformation(aConverter);
   aSimpleReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
   aSimpleReader.SetCreateShapes(aNode->InternalParameters.ReadCreateShapes);
+  aSimpleReader.SetParallel(aNode->InternalParameters.ReadParallel);
   aSimpleReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
   aSimpleReader.SetMemoryLimit(aNode->InternalParameters.ReadMemoryLimitMiB);
   if (!aSimpleReader.Read(thePath, theProgress))
@@ -0,0 +1,164 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWObj_TriangulationReader.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns OBJ text of a regular grid of theNbCells x theNbCells squares, defined row by row
+//! and split into groups, using both absolute and relative indices.
+std::string makeObjGrid(const int theNbCells)
+{
+  std::ostringstream aStream;
+  aStream.precision(12);
+  aStream << "# Grid sample\n#\n# generated for testing\n\no grid\nvn 0 0 1\n";
+
+  const int aNbCols = theNbCells + 1;
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      aStream << "v " << aCol * 0.1 << " " << aRow * 0.1 << " " << (aRow % 3) * 0.01 << "\n";
+      aStream << "vt " << double(aCol) / theNbCells << " " << double(aRow) / theNbCells << "\n";
+    }
+    if (aRow == 0)
+    {
+      continue;
+    }
+
+    if (aRow % 20 == 1)
+    {
+      aStream << "g part" << aRow / 20 << "\n";
+    }
+    if (aRow == theNbCells / 2)
+    {
+      aStream << "usemtl undefined\ns 1\n";
+    }
+
+    const int aNbNodes = (aRow + 1) * aNbCols;
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNodes[4] = {(aRow - 1) * aNbCols + aCol + 1,
+                             (aRow - 1) * aNbCols + aCol + 2,
+                             aRow * aNbCols + aCol + 2,
+                             aRow * aNbCols + aCol + 1};
+      if (aRow % 2 == 0)
+      {
+        // quad with relative indices
+        aStream << "f";
+        for (int aNode = 0; aNode < 4; ++aNode)
+        {
+          const int anIndex = aNodes[aNode] - aNbNodes - 1;
+          aStream << " " << anIndex << "/" << anIndex << "/-1";
+        }
+        aStream << "\n";
+      }
+      else if (aCol % 7 == 0)
+      {
+        // quad continued on the next line
+        aStream << "f " << aNodes[0] << "/" << aNodes[0] << " " << aNodes[1] << "/" << aNodes[1]
+                << " \\\n  " << aNodes[2] << "/" << aNodes[2] << " " << aNodes[3] << "/"
+                << aNodes[3] << "\n";
+      }
+      else
+      {
+        // two triangles with absolute indices
+        aStream << "f " << aNodes[0] << "//1 " << aNodes[1] << "//1 " << aNodes[2] << "//1\n";
+        aStream << "f " << aNodes[0] << " " << aNodes[2] << " " << aNodes[3] << "\r\n";
+      }
+    }
+  }
+  return aStream.str();
+}
+
+//! Reads OBJ text, with or without multithreading.
+TopoDS_Shape readObj(const std::string&       theContent,
+                     const bool               theToParallel,
+                     TCollection_AsciiString& theComments)
+{
+  RWObj_TriangulationReader aReader;
+  aReader.SetParallel(theToParallel);
+  std::istringstream aStream(theContent);
+  EXPECT_TRUE(aReader.Read(aStream, "grid.obj", Message_ProgressRange()));
+  EXPECT_EQ(aReader.NbProbeNodes(), 201 * 201);
+  theComments = aReader.FileComments();
+  return aReader.ResultShape();
+}
+} // namespace
+
+// Parallel parsing should give the same meshes as sequential one
+TEST(RWObj_ReaderTest, ParallelMatchesSequential)
+{
+  const std::string aContent = makeObjGrid(200);
+  ASSERT_GT(aContent.size(), size_t(2 * 1024 * 1024));
+
+  TCollection_AsciiString aSeqComments, aParComments;
+  const TopoDS_Shape      aSeqShape = readObj(aContent, false, aSeqComments);
+  const TopoDS_Shape      aParShape = readObj(aContent, true, aParComments);
+  EXPECT_STREQ(aSeqComments.ToCString(), "Grid sample\ngenerated for testing");
+  EXPECT_STREQ(aSeqComments.ToCString(), aParComments.ToCString());
+
+  int             aNbFaces   = 0;
+  int             aNbTris    = 0;
+  TopExp_Explorer aSeqExp(aSeqShape, TopAbs_FACE);
+  TopExp_Explorer aParExp(aParShape, TopAbs_FACE);
+  for (; aSeqExp.More() && aParExp.More(); aSeqExp.Next(), aParExp.Next(), ++aNbFaces)
+  {
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aSeqMesh =
+      BRep_Tool::Triangulation(TopoDS::Face(aSeqExp.Current()), aLoc);
+    const occ::handle<Poly_Triangulation>& aParMesh =
+      BRep_Tool::Triangulation(TopoDS::Face(aParExp.Current()), aLoc);
+    ASSERT_FALSE(aSeqMesh.IsNull());
+    ASSERT_FALSE(aParMesh.IsNull());
+    ASSERT_EQ(aSeqMesh->NbNodes(), aParMesh->NbNodes());
+    ASSERT_EQ(aSeqMesh->NbTriangles(), aParMesh->NbTriangles());
+    ASSERT_EQ(aSeqMesh->HasUVNodes(), aParMesh->HasUVNodes());
+    ASSERT_EQ(aSeqMesh->HasNormals(), aParMesh->HasNormals());
+    aNbTris += aSeqMesh->NbTriangles();
+    for (int aNodeIter = 1; aNodeIter <= aSeqMesh->NbNodes(); ++aNodeIter)
+    {
+      EXPECT_TRUE(aSeqMesh->Node(aNodeIter).IsEqual(aParMesh->Node(aNodeIter), 0.0));
+      if (aSeqMesh->HasUVNodes())
+      {
+        EXPECT_TRUE(aSeqMesh->UVNode(aNodeIter).IsEqual(aParMesh->UVNode(aNodeIter), 0.0));
+      }
+      if (aSeqMesh->HasNormals())
+      {
+        EXPECT_TRUE(aSeqMesh->Normal(aNodeIter).IsEqual(aParMesh->Normal(aNodeIter), 0.0));
+      }
+    }
+    for (int aTriIter = 1; aTriIter <= aSeqMesh->NbTriangles(); ++aTriIter)
+    {
+      int aSeqNodes[3], aParNodes[3];
+      aSeqMesh->Triangle(aTriIter).Get(aSeqNodes[0], aSeqNodes[1], aSeqNodes[2]);
+      aParMesh->Triangle(aTriIter).Get(aParNodes[0], aParNodes[1], aParNodes[2]);
+      EXPECT_EQ(aSeqNodes[0], aParNodes[0]);
+      EXPECT_EQ(aSeqNodes[1], aParNodes[1]);
+      EXPECT_EQ(aSeqNodes[2], aParNodes[2]);
+    }
+  }
+  EXPECT_FALSE(aSeqExp.More());
+  EXPECT_FALSE(aParExp.More());
+  EXPECT_GE(aNbFaces, 10);
+  EXPECT_EQ(aNbTris, 2 * 200 * 200);
+}
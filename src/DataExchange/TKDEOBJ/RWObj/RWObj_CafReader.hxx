@@ -31,6 +31,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision(bool theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return flag to use multithreading for reading mesh data; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup flag to use multithreading for reading mesh data.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Read the mesh from specified file.
   Standard_EXPORT bool performMesh(std::istream&                  theStream,
@@ -57,6 +63,7 @@ protected:
   NCollection_DataMap<TCollection_AsciiString, occ::handle<XCAFDoc_VisMaterial>> myObjMaterialMap;
   // clang-format off
   bool myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  bool myToParallel;        //!< flag to use multithreading; FALSE by default
   // clang-format on
 };
 
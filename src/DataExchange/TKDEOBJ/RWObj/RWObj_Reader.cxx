@@ -25,11 +25,13 @@
 #include <NCollection_IncAllocator.hxx>
 #include <OSD_OpenFile.hxx>
 #include <OSD_Path.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
 #include <Standard_ReadLineBuffer.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 #if defined(_WIN32)
@@ -62,6 +64,312 @@ static bool isClockwisePolygon(const occ::handle<BRepMesh_DataStructureOfDelaun>
   }
   return aPtSum < 0.0;
 }
+
+//! Read indices of position, UV and normal of element node; indices are returned zero-based
+//! (-1 if undefined) or negative relative to the end of the lists.
+//! @return position after the node or NULL if there is no more node
+static const char* readElementNode(const char* thePos, NCollection_Vec3<int>& theIndices)
+{
+  char* aNext = nullptr;
+  theIndices  = NCollection_Vec3<int>(-1, -1, -1);
+
+  theIndices[0] = int(strtol(thePos, &aNext, 10) - 1);
+  if (aNext == thePos)
+  {
+    return nullptr;
+  }
+
+  // parse UV index
+  thePos = aNext;
+  if (*thePos == '/')
+  {
+    ++thePos;
+    if (*thePos != '/')
+    {
+      theIndices[1] = int(strtol(thePos, &aNext, 10) - 1);
+      thePos        = aNext;
+    }
+
+    // parse Normal index
+    if (*thePos == '/')
+    {
+      ++thePos;
+      if (!IsSpace(*thePos))
+      {
+        theIndices[2] = int(strtol(thePos, &aNext, 10) - 1);
+        thePos        = aNext;
+      }
+    }
+  }
+  return thePos;
+}
+
+// The length of block of data parsed at once in parallel mode (in bytes)
+static const size_t THE_BLOCK_SIZE = 64 * 1024 * 1024;
+
+// The approximate length of chunk of data parsed by one thread (in bytes)
+static const size_t THE_CHUNK_SIZE = 1024 * 1024;
+
+//! Return TRUE if the line ending at given position is continued by the next one.
+static bool isContinuedLine(const char* theData, const size_t theLineEnd)
+{
+  return (theLineEnd >= 1 && theData[theLineEnd - 1] == '\\')
+         || (theLineEnd >= 2 && theData[theLineEnd - 1] == '\r' && theData[theLineEnd - 2] == '\\');
+}
+
+//! Return the position of the first line starting after theFrom, or theEnd if there is none.
+static size_t findLineStart(const char* theData, const size_t theFrom, const size_t theEnd)
+{
+  for (size_t aPos = theFrom; aPos < theEnd; ++aPos)
+  {
+    const char* aLineEnd = (const char*)::memchr(theData + aPos, '\n', theEnd - aPos);
+    if (aLineEnd == nullptr)
+    {
+      break;
+    }
+    aPos = size_t(aLineEnd - theData);
+    if (!isContinuedLine(theData, aPos))
+    {
+      return aPos + 1;
+    }
+  }
+  return theEnd;
+}
+
+//! Return the position of the last line start, or 0 if there is none.
+static size_t findLastLineStart(const char* theData, const size_t theEnd)
+{
+  for (size_t aPos = theEnd; aPos > 0; --aPos)
+  {
+    if (theData[aPos - 1] == '\n' && !isContinuedLine(theData, aPos - 1))
+    {
+      return aPos;
+    }
+  }
+  return 0;
+}
+
+//! Kind of lines parsed in parallel mode.
+enum ObjLineKind
+{
+  ObjLineKind_Comment,
+  ObjLineKind_Vertex,
+  ObjLineKind_Normal,
+  ObjLineKind_Texel,
+  ObjLineKind_Element,
+  ObjLineKind_Group,
+  ObjLineKind_SmoothGroup,
+  ObjLineKind_Object,
+  ObjLineKind_MaterialLib,
+  ObjLineKind_Material,
+  ObjLineKind_Other
+};
+
+//! Consecutive lines of the same kind parsed in parallel mode.
+struct ObjLines
+{
+  ObjLineKind Kind;    //!< kind of the lines
+  int         Line;    //!< index of the first line within the chunk
+  int         NbLines; //!< number of lines
+  const char* Text;    //!< text after keyword for lines other than nodal data and elements
+};
+
+//! Chunk of OBJ data parsed by one thread.
+struct ObjChunk
+{
+  char*                                             Begin;     //!< first character of the chunk
+  char*                                             End;       //!< end of the chunk
+  NCollection_DynamicArray<ObjLines>                Lines;     //!< parsed lines
+  NCollection_DynamicArray<gp_Pnt>                  Nodes;     //!< parsed vertices
+  NCollection_DynamicArray<NCollection_Vec3<float>> Normals;   //!< parsed normals
+  NCollection_DynamicArray<NCollection_Vec2<float>> Texels;    //!< parsed UV parameters
+  NCollection_DynamicArray<NCollection_Vec3<int>>   ElemNodes; //!< indices of element nodes
+  NCollection_DynamicArray<int>                     ElemSizes; //!< numbers of element nodes
+  int                                               NbLines;   //!< number of lines in the chunk
+
+  ObjChunk()
+      : Begin(nullptr),
+        End(nullptr),
+        Lines(1024),
+        Nodes(4096),
+        Normals(4096),
+        Texels(4096),
+        ElemNodes(4096),
+        ElemSizes(4096),
+        NbLines(0)
+  {
+  }
+
+  //! Return the next line terminated in place by zero, or NULL at the end of the chunk;
+  //! continued lines are joined with a gap as by Standard_ReadLineBuffer in multi-line mode.
+  char* NextLine(char*& thePos)
+  {
+    if (thePos >= End)
+    {
+      return nullptr;
+    }
+
+    char* aLine    = thePos;
+    char* aLineEnd = thePos;
+    for (;;)
+    {
+      char* aSrc     = thePos;
+      char* aNewLine = (char*)::memchr(aSrc, '\n', End - aSrc);
+      char* aSrcEnd  = aNewLine;
+      if (aNewLine == nullptr)
+      {
+        // the last line of the stream, followed by terminating zero
+        aSrcEnd = End;
+        thePos  = End;
+      }
+      else
+      {
+        thePos = aNewLine + 1;
+        if (aSrcEnd > aSrc && aSrcEnd[-1] == '\r')
+        {
+          --aSrcEnd;
+        }
+      }
+
+      const bool isContinued = aNewLine != nullptr && aSrcEnd > aSrc && aSrcEnd[-1] == '\\';
+      if (isContinued)
+      {
+        aSrcEnd[-1] = ' ';
+      }
+      if (aLineEnd != aSrc)
+      {
+        std::memmove(aLineEnd, aSrc, aSrcEnd - aSrc);
+      }
+      aLineEnd += aSrcEnd - aSrc;
+      if (!isContinued)
+      {
+        break;
+      }
+    }
+    *aLineEnd = '\0';
+    ++NbLines;
+    return aLine;
+  }
+
+  //! Append the line of given kind.
+  void AddLine(const ObjLineKind theKind, const int theLine, const char* theText)
+  {
+    if (theText == nullptr && !Lines.IsEmpty())
+    {
+      ObjLines& aLast = Lines.ChangeLast();
+      if (aLast.Kind == theKind && aLast.Line + aLast.NbLines == theLine)
+      {
+        ++aLast.NbLines;
+        return;
+      }
+    }
+    Lines.Append(ObjLines{theKind, theLine, 1, theText});
+  }
+
+  //! Parse the lines of the chunk.
+  void Perform(const RWMesh_CoordinateSystemConverter& theCSTrsf)
+  {
+    char* aPos = Begin;
+    for (;;)
+    {
+      const int   aLineIndex = NbLines;
+      const char* aLine      = NextLine(aPos);
+      if (aLine == nullptr)
+      {
+        return;
+      }
+
+      if (*aLine == '#')
+      {
+        AddLine(ObjLineKind_Comment, aLineIndex, aLine + 1);
+      }
+      else if (*aLine == '\0')
+      {
+        continue;
+      }
+      else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar(aLine[1]))
+      {
+        char*  aNext = nullptr;
+        gp_Pnt anXYZ;
+        RWObj_Tools::ReadVec3(aLine + 2, aNext, anXYZ.ChangeCoord());
+        theCSTrsf.TransformPosition(anXYZ.ChangeCoord());
+        Nodes.Append(anXYZ);
+        AddLine(ObjLineKind_Vertex, aLineIndex, nullptr);
+      }
+      else if (aLine[0] == 'v' && aLine[1] == 'n' && RWObj_Tools::isSpaceChar(aLine[2]))
+      {
+        char*                   aNext = nullptr;
+        NCollection_Vec3<float> aNorm;
+        RWObj_Tools::ReadVec3(aLine + 3, aNext, aNorm);
+        theCSTrsf.TransformNormal(aNorm);
+        Normals.Append(aNorm);
+        AddLine(ObjLineKind_Normal, aLineIndex, nullptr);
+      }
+      else if (aLine[0] == 'v' && aLine[1] == 't' && RWObj_Tools::isSpaceChar(aLine[2]))
+      {
+        char*                   aNext = nullptr;
+        const char*             aUV   = aLine + 3;
+        NCollection_Vec2<float> anUV;
+        anUV.x() = (float)Strtod(aUV, &aNext);
+        aUV      = aNext;
+        anUV.y() = (float)Strtod(aUV, &aNext);
+        Texels.Append(anUV);
+        AddLine(ObjLineKind_Texel, aLineIndex, nullptr);
+      }
+      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar(aLine[1]))
+      {
+        int         aNbElemNodes = 0;
+        const char* aNodePos     = aLine + 2;
+        for (;;)
+        {
+          NCollection_Vec3<int> a3Indices;
+          aNodePos = readElementNode(aNodePos, a3Indices);
+          if (aNodePos == nullptr)
+          {
+            break;
+          }
+          ElemNodes.Append(a3Indices);
+          ++aNbElemNodes;
+
+          if (*aNodePos == '\n' || *aNodePos == '\0')
+          {
+            break;
+          }
+          if (*aNodePos != ' ')
+          {
+            ++aNodePos;
+          }
+        }
+        ElemSizes.Append(aNbElemNodes);
+        AddLine(ObjLineKind_Element, aLineIndex, nullptr);
+      }
+      else if (aLine[0] == 'g' && IsSpace(aLine[1]))
+      {
+        AddLine(ObjLineKind_Group, aLineIndex, aLine + 2);
+      }
+      else if (aLine[0] == 's' && IsSpace(aLine[1]))
+      {
+        AddLine(ObjLineKind_SmoothGroup, aLineIndex, aLine + 2);
+      }
+      else if (aLine[0] == 'o' && IsSpace(aLine[1]))
+      {
+        AddLine(ObjLineKind_Object, aLineIndex, aLine + 2);
+      }
+      else if (::strncmp(aLine, "mtllib", 6) == 0)
+      {
+        AddLine(ObjLineKind_MaterialLib, aLineIndex, IsSpace(aLine[6]) ? aLine + 7 : "");
+      }
+      else if (::strncmp(aLine, "usemtl", 6) == 0)
+      {
+        AddLine(ObjLineKind_Material, aLineIndex, IsSpace(aLine[6]) ? aLine + 7 : "");
+      }
+      else
+      {
+        AddLine(ObjLineKind_Other, aLineIndex, nullptr);
+      }
+    }
+  }
+};
 } // namespace
 
 //=================================================================================================
@@ -73,7 +381,8 @@ RWObj_Reader::RWObj_Reader()
       myNbProbeNodes(0),
       myNbProbeElems(0),
       myNbElemsBig(0),
-      myToAbort(false)
+      myToAbort(false),
+      myToParallel(false)
 {
 }
 
@@ -121,6 +430,16 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     return false;
   }
 
+  if (myToParallel && !theToProbe)
+  {
+    if (!readParallel(theStream, aFileLen, theProgress))
+    {
+      return false;
+    }
+    endRead(theToProbe);
+    return true;
+  }
+
   Standard_ReadLineBuffer aBuffer(THE_BUFFER_SIZE);
   aBuffer.SetMultilineMode(true);
 
@@ -161,17 +480,7 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     {
       if (isStart)
       {
-        TCollection_AsciiString aComment(aLine + 1);
-        aComment.LeftAdjust();
-        aComment.RightAdjust();
-        if (!aComment.IsEmpty())
-        {
-          if (!myFileComments.IsEmpty())
-          {
-            myFileComments += "\n";
-          }
-          myFileComments += aComment;
-        }
+        pushComment(aLine + 1);
       }
       continue;
     }
@@ -245,6 +554,212 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     }
   }
 
+  endRead(theToProbe);
+  return true;
+}
+
+//=================================================================================================
+
+bool RWObj_Reader::readParallel(std::istream&                theStream,
+                                const int64_t                theFileLen,
+                                const Message_ProgressRange& theProgress)
+{
+  const int             aNbMiBTotal  = int(theFileLen / (1024 * 1024));
+  int                   aNbMiBPassed = 0;
+  Message_ProgressScope aPS(theProgress, "Reading text OBJ file", aNbMiBTotal);
+
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+
+  // the block is read after the tail of previous one, starting with incomplete line;
+  // one more character is reserved for terminating zero
+  NCollection_Array1<char> aBlock(0,
+                                  theFileLen < int64_t(THE_BLOCK_SIZE) ? int(theFileLen) + 1
+                                                                       : int(THE_BLOCK_SIZE));
+  size_t  aNbData  = 0;
+  int64_t aNbRead  = 0;
+  int     aNbLines = 0;
+  bool    isStart  = true;
+  bool    isEOF    = false;
+  while (!isEOF)
+  {
+    const size_t aNbToRead = size_t(aBlock.Size()) - 1 - aNbData;
+    const size_t aNbBytes =
+      (size_t)theStream.read(&aBlock.ChangeFirst() + aNbData, std::streamsize(aNbToRead)).gcount();
+    if (theStream.bad())
+    {
+      Message::SendFail("Error: OBJ reader, cannot read file");
+      return false;
+    }
+    isEOF = aNbBytes < aNbToRead;
+    aNbData += aNbBytes;
+    aNbRead += aNbBytes;
+
+    char* aData     = &aBlock.ChangeFirst();
+    aData[aNbData]  = '\0';
+    size_t aDataEnd = aNbData;
+    if (!isEOF)
+    {
+      // keep the last line, which might be incomplete, for the next block
+      aDataEnd = findLastLineStart(aData, aNbData);
+      if (aDataEnd == 0)
+      {
+        if (aBlock.Size() > std::numeric_limits<int>::max() / 2)
+        {
+          Message::SendFail(TCollection_AsciiString("Error: invalid OBJ syntax at line ")
+                            + (aNbLines + 1));
+          return false;
+        }
+        aBlock.Resize(0, aBlock.Upper() * 2, true);
+        continue;
+      }
+    }
+
+    // split the block at line ends
+    NCollection_DynamicArray<size_t> aSplits;
+    aSplits.Append(0);
+    for (;;)
+    {
+      const size_t aSplit = findLineStart(aData, aSplits.Last() + THE_CHUNK_SIZE, aDataEnd);
+      if (aSplit >= aDataEnd)
+      {
+        break;
+      }
+      aSplits.Append(aSplit);
+    }
+
+    const int                    aNbChunks = aSplits.Length();
+    NCollection_Array1<ObjChunk> aChunks(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      ObjChunk& aChunk = aChunks.ChangeValue(aChunkIter);
+      aChunk.Begin     = aData + aSplits.Value(aChunkIter);
+      aChunk.End = aData + (aChunkIter + 1 < aNbChunks ? aSplits.Value(aChunkIter + 1) : aDataEnd);
+    }
+
+    const int aNbThreads = std::min(aNbChunks, aThreadPool->NbDefaultThreadsToLaunch());
+
+    OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+    aLauncher.Perform(0, aNbChunks, [&aChunks, this](int, int theIndex) {
+      aChunks.ChangeValue(theIndex).Perform(myCSTrsf);
+    });
+
+    // process parsed lines in the order of the file
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      const ObjChunk& aChunk         = aChunks.Value(aChunkIter);
+      int             aNodeIter      = 0;
+      int             aNormIter      = 0;
+      int             aTexelIter     = 0;
+      int             anElemIter     = 0;
+      int             anElemNodeIter = 0;
+      for (int aLinesIter = 0; aLinesIter < aChunk.Lines.Length(); ++aLinesIter)
+      {
+        const ObjLines& aLines = aChunk.Lines.Value(aLinesIter);
+        for (int aLineIter = 0; aLineIter < aLines.NbLines; ++aLineIter)
+        {
+          myNbLines = aNbLines + aLines.Line + aLineIter + 1;
+          if (aLines.Kind == ObjLineKind_Comment)
+          {
+            if (isStart)
+            {
+              pushComment(aLines.Text);
+            }
+            continue;
+          }
+          isStart = false;
+
+          switch (aLines.Kind)
+          {
+            case ObjLineKind_Vertex: {
+              ++myNbProbeNodes;
+              myMemEstim +=
+                myObjVerts.IsSinglePrecision() ? sizeof(NCollection_Vec3<float>) : sizeof(gp_Pnt);
+              myObjVerts.Append(aChunk.Nodes.Value(aNodeIter++));
+              break;
+            }
+            case ObjLineKind_Normal: {
+              myMemEstim += sizeof(NCollection_Vec3<float>);
+              myObjNorms.Append(aChunk.Normals.Value(aNormIter++));
+              break;
+            }
+            case ObjLineKind_Texel: {
+              myMemEstim += sizeof(NCollection_Vec2<float>);
+              myObjVertsUV.Append(aChunk.Texels.Value(aTexelIter++));
+              break;
+            }
+            case ObjLineKind_Element: {
+              ++myNbProbeElems;
+              const int aNbElemNodes = aChunk.ElemSizes.Value(anElemIter++);
+              int       aNbPushed    = 0;
+              for (; aNbPushed < aNbElemNodes; ++aNbPushed)
+              {
+                if (!pushElementNode(aChunk.ElemNodes.Value(anElemNodeIter + aNbPushed),
+                                     aNbPushed))
+                {
+                  break;
+                }
+              }
+              anElemNodeIter += aNbElemNodes;
+              if (aNbPushed == aNbElemNodes)
+              {
+                pushElement(aNbElemNodes);
+              }
+              break;
+            }
+            case ObjLineKind_Group: {
+              pushGroup(aLines.Text);
+              break;
+            }
+            case ObjLineKind_SmoothGroup: {
+              pushSmoothGroup(aLines.Text);
+              break;
+            }
+            case ObjLineKind_Object: {
+              pushObject(aLines.Text);
+              break;
+            }
+            case ObjLineKind_MaterialLib: {
+              readMaterialLib(aLines.Text);
+              break;
+            }
+            case ObjLineKind_Material: {
+              pushMaterial(aLines.Text);
+              break;
+            }
+            default: {
+              break;
+            }
+          }
+
+          if (!checkMemory())
+          {
+            addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+            return false;
+          }
+        }
+      }
+      aNbLines += aChunk.NbLines;
+    }
+
+    if (!aPS.More())
+    {
+      return false;
+    }
+    const int aNbMiBRead = int((aNbRead - int64_t(aNbData - aDataEnd)) / (1024 * 1024));
+    aPS.Next(aNbMiBRead - aNbMiBPassed);
+    aNbMiBPassed = aNbMiBRead;
+
+    // move the tail to the beginning of the block
+    std::memmove(aData, aData + aDataEnd, aNbData - aDataEnd);
+    aNbData -= aDataEnd;
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void RWObj_Reader::endRead(const bool theToProbe)
+{
   // collect external references
   for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter(myMaterials);
        aMatIter.More();
@@ -275,164 +790,171 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     Message::SendWarning(TCollection_AsciiString("Warning: OBJ reader, ") + myNbElemsBig
                          + " polygon(s) have been split into triangles");
   }
+}
 
-  return true;
+//=================================================================================================
+
+void RWObj_Reader::pushComment(const char* theComment)
+{
+  TCollection_AsciiString aComment(theComment);
+  aComment.LeftAdjust();
+  aComment.RightAdjust();
+  if (!aComment.IsEmpty())
+  {
+    if (!myFileComments.IsEmpty())
+    {
+      myFileComments += "\n";
+    }
+    myFileComments += aComment;
+  }
 }
 
 //=================================================================================================
 
 void RWObj_Reader::pushIndices(const char* thePos)
 {
-  char* aNext = nullptr;
-
   int aNbElemNodes = 0;
   for (int aNode = 0;; ++aNode)
   {
-    NCollection_Vec3<int> a3Indices(-1, -1, -1);
-    a3Indices[0] = int(strtol(thePos, &aNext, 10) - 1);
-    if (aNext == thePos)
+    NCollection_Vec3<int> a3Indices;
+    thePos = readElementNode(thePos, a3Indices);
+    if (thePos == nullptr)
+    {
+      break;
+    }
+    if (!pushElementNode(a3Indices, aNode))
+    {
+      return;
+    }
+    aNbElemNodes = aNode + 1;
+
+    if (*thePos == '\n' || *thePos == '\0')
     {
       break;
     }
 
-    // parse UV index
-    thePos = aNext;
-    if (*thePos == '/')
+    if (*thePos != ' ')
     {
       ++thePos;
-      if (*thePos != '/')
-      {
-        a3Indices[1] = int(strtol(thePos, &aNext, 10) - 1);
-        thePos       = aNext;
-      }
-
-      // parse Normal index
-      if (*thePos == '/')
-      {
-        ++thePos;
-        if (!IsSpace(*thePos))
-        {
-          a3Indices[2] = int(strtol(thePos, &aNext, 10) - 1);
-          thePos       = aNext;
-        }
-      }
     }
+  }
+
+  pushElement(aNbElemNodes);
+}
+
+//=================================================================================================
 
-    // handle negative indices
-    if (a3Indices[0] < -1)
+bool RWObj_Reader::pushElementNode(NCollection_Vec3<int> theIndices, const int theNode)
+{
+  // handle negative indices
+  if (theIndices[0] < -1)
+  {
+    theIndices[0] += myObjVerts.Upper() + 2;
+  }
+  if (theIndices[1] < -1)
+  {
+    theIndices[1] += myObjVertsUV.Upper() + 2;
+  }
+  if (theIndices[2] < -1)
+  {
+    theIndices[2] += myObjNorms.Upper() + 2;
+  }
+
+  int anIndex = -1;
+  if (!myPackedIndices.Find(theIndices, anIndex))
+  {
+    if (theIndices[0] >= 0)
+    {
+      myMemEstim += sizeof(NCollection_Vec3<float>);
+    }
+    if (theIndices[1] >= 0)
     {
-      a3Indices[0] += myObjVerts.Upper() + 2;
+      myMemEstim += sizeof(NCollection_Vec2<float>);
     }
-    if (a3Indices[1] < -1)
+    if (theIndices[2] >= 0)
     {
-      a3Indices[1] += myObjVertsUV.Upper() + 2;
+      myMemEstim += sizeof(NCollection_Vec3<float>);
     }
-    if (a3Indices[2] < -1)
+    myMemEstim += sizeof(NCollection_Vec4<int>) + sizeof(int); // naive map
+    if (theIndices[0] < myObjVerts.Lower() || theIndices[0] > myObjVerts.Upper())
     {
-      a3Indices[2] += myObjNorms.Upper() + 2;
+      myToAbort = true;
+      Message::SendFail(TCollection_AsciiString("Error: invalid OBJ syntax at line ") + myNbLines
+                        + ": vertex index is out of range");
+      return false;
     }
 
-    int anIndex = -1;
-    if (!myPackedIndices.Find(a3Indices, anIndex))
+    anIndex = addNode(myObjVerts.Value(theIndices[0]));
+    myPackedIndices.Bind(theIndices, anIndex);
+    if (theIndices[1] >= 0)
     {
-      if (a3Indices[0] >= 0)
+      if (myObjVertsUV.IsEmpty())
       {
-        myMemEstim += sizeof(NCollection_Vec3<float>);
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": UV index is specified but no UV nodes are defined");
       }
-      if (a3Indices[1] >= 0)
+      else if (theIndices[1] < myObjVertsUV.Lower() || theIndices[1] > myObjVertsUV.Upper())
       {
-        myMemEstim += sizeof(NCollection_Vec2<float>);
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": UV index is out of range");
+        setNodeUV(anIndex, NCollection_Vec2<float>(0.0f, 0.0f));
       }
-      if (a3Indices[2] >= 0)
+      else
       {
-        myMemEstim += sizeof(NCollection_Vec3<float>);
+        setNodeUV(anIndex, myObjVertsUV.Value(theIndices[1]));
       }
-      myMemEstim += sizeof(NCollection_Vec4<int>) + sizeof(int); // naive map
-      if (a3Indices[0] < myObjVerts.Lower() || a3Indices[0] > myObjVerts.Upper())
+    }
+    if (theIndices[2] >= 0)
+    {
+      if (myObjNorms.IsEmpty())
       {
-        myToAbort = true;
-        Message::SendFail(TCollection_AsciiString("Error: invalid OBJ syntax at line ") + myNbLines
-                          + ": vertex index is out of range");
-        return;
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines
+                             + ": Normal index is specified but no Normals nodes are defined");
       }
-
-      anIndex = addNode(myObjVerts.Value(a3Indices[0]));
-      myPackedIndices.Bind(a3Indices, anIndex);
-      if (a3Indices[1] >= 0)
+      else if (theIndices[2] < myObjNorms.Lower() || theIndices[2] > myObjNorms.Upper())
       {
-        if (myObjVertsUV.IsEmpty())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": UV index is specified but no UV nodes are defined");
-        }
-        else if (a3Indices[1] < myObjVertsUV.Lower() || a3Indices[1] > myObjVertsUV.Upper())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": UV index is out of range");
-          setNodeUV(anIndex, NCollection_Vec2<float>(0.0f, 0.0f));
-        }
-        else
-        {
-          setNodeUV(anIndex, myObjVertsUV.Value(a3Indices[1]));
-        }
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": Normal index is out of range");
+        setNodeNormal(anIndex, NCollection_Vec3<float>(0.0f, 0.0f, 1.0f));
       }
-      if (a3Indices[2] >= 0)
+      else
       {
-        if (myObjNorms.IsEmpty())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines
-                               + ": Normal index is specified but no Normals nodes are defined");
-        }
-        else if (a3Indices[2] < myObjNorms.Lower() || a3Indices[2] > myObjNorms.Upper())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": Normal index is out of range");
-          setNodeNormal(anIndex, NCollection_Vec3<float>(0.0f, 0.0f, 1.0f));
-        }
-        else
-        {
-          setNodeNormal(anIndex, myObjNorms.Value(a3Indices[2]));
-        }
+        setNodeNormal(anIndex, myObjNorms.Value(theIndices[2]));
       }
     }
+  }
 
-    if (myCurrElem.Size() < size_t(aNode))
-    {
-      myCurrElem.Resize(aNode * 2, -1);
-    }
-    myCurrElem[aNode] = anIndex;
-    aNbElemNodes      = aNode + 1;
-
-    if (*thePos == '\n' || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
+  if (myCurrElem.Size() < size_t(theNode))
+  {
+    myCurrElem.Resize(theNode * 2, -1);
   }
+  myCurrElem[theNode] = anIndex;
+  return true;
+}
+
+//=================================================================================================
 
-  if (myCurrElem[0] < 0 || myCurrElem[1] < 0 || myCurrElem[2] < 0 || aNbElemNodes < 3)
+void RWObj_Reader::pushElement(const int theNbElemNodes)
+{
+  if (myCurrElem[0] < 0 || myCurrElem[1] < 0 || myCurrElem[2] < 0 || theNbElemNodes < 3)
   {
     return;
   }
 
-  if (aNbElemNodes == 3)
+  if (theNbElemNodes == 3)
   {
     myMemEstim += sizeof(NCollection_Vec4<int>);
     addElement(myCurrElem[0], myCurrElem[1], myCurrElem[2], -1);
   }
-  else if (aNbElemNodes == 4)
+  else if (theNbElemNodes == 4)
   {
     myMemEstim += sizeof(NCollection_Vec4<int>);
     addElement(myCurrElem[0], myCurrElem[1], myCurrElem[2], myCurrElem[3]);
   }
   else
   {
-    const NCollection_Array1<int> aCurrElemArray1(myCurrElem[0], 1, aNbElemNodes);
+    const NCollection_Array1<int> aCurrElemArray1(myCurrElem[0], 1, theNbElemNodes);
     const int                     aNbAdded = triangulatePolygon(aCurrElemArray1);
     if (aNbAdded < 1)
     {
@@ -134,6 +134,16 @@ public:
     myObjVerts.SetSinglePrecision(theIsSinglePrecision);
   }
 
+  //! Return flag to use multithreading for reading mesh data; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup flag to use multithreading for reading mesh data.
+  //! The text is then read by large blocks split at line ends into chunks, which are parsed
+  //! by parallel threads; parsed chunks are then processed sequentially in the order of the file,
+  //! so that the result (including resolution of relative indices) is the same as in
+  //! single-threaded mode. The flag has no effect on probing the file.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Reads data from OBJ file.
   //! Unicode paths can be given in UTF-8 encoding.
@@ -183,6 +193,18 @@ protected:
 
   //! @name implementation details
 private:
+  //! Reads mesh data from the stream, parsing it by chunks in parallel threads.
+  //! @return FALSE on error or user break
+  bool readParallel(std::istream&                theStream,
+                    const int64_t                theFileLen,
+                    const Message_ProgressRange& theProgress);
+
+  //! Collects external references, flushes the last group and reports split polygons.
+  void endRead(const bool theToProbe);
+
+  //! Handle "# Comment" at the beginning of file.
+  void pushComment(const char* theComment);
+
   //! Handle "v X Y Z".
   void pushVertex(const char* theXYZ)
   {
@@ -223,6 +245,16 @@ private:
   //! Handle "f indices".
   void pushIndices(const char* thePos);
 
+  //! Add node of the current element.
+  //! @param theIndices zero-based indices of position, UV and normal (-1 if undefined),
+  //!                   or negative ones relative to the end of the lists
+  //! @param theNode    index of the node within the element
+  //! @return FALSE if position index is out of range
+  bool pushElementNode(NCollection_Vec3<int> theIndices, const int theNode);
+
+  //! Add the current element defined by nodes passed to pushElementNode().
+  void pushElement(const int theNbElemNodes);
+
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
   //! @return center of polygon
@@ -367,6 +399,7 @@ protected:
   int                   myNbProbeElems;  //!< number of probed elements
   int                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   bool                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  bool                   myToParallel;    //!< flag to use multithreading; FALSE by default
                                                     // clang-format on
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates
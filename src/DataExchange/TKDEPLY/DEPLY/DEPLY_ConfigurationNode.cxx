@@ -63,6 +63,19 @@ bool DEPLY_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>& t
                                                       aScope)
                               % 2);
 
+  InternalParameters.ReadSinglePrecision =
+    theResource->BooleanVal("read.single.precision",
+                            InternalParameters.ReadSinglePrecision,
+                            aScope);
+  InternalParameters.ReadRootPrefix =
+    theResource->StringVal("read.root.prefix", InternalParameters.ReadRootPrefix, aScope);
+  InternalParameters.ReadSkipLateDataLoading =
+    theResource->BooleanVal("read.skip.late.data.loading",
+                            InternalParameters.ReadSkipLateDataLoading,
+                            aScope);
+  InternalParameters.ReadKeepLateData =
+    theResource->BooleanVal("read.keep.late.data", InternalParameters.ReadKeepLateData, aScope);
+
   InternalParameters.WriteNormals =
     theResource->BooleanVal("write.normals", InternalParameters.WriteNormals, aScope);
   InternalParameters.WriteColors =
@@ -114,6 +127,37 @@ TCollection_AsciiString DEPLY_ConfigurationNode::Save() const
   aResult += aScope + "file.cs :\t " + InternalParameters.FileCS + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Read parameters:\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag for reading vertex data with single or double floating point precision\n";
+  aResult += "!Default value: 1(true). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.single.precision :\t " + InternalParameters.ReadSinglePrecision + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Root folder for generating root labels names\n";
+  aResult += "!Default value: "
+             "(empty). Available values: <path>\n";
+  aResult += aScope + "read.root.prefix :\t " + InternalParameters.ReadRootPrefix + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag to skip triangulation loading\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult +=
+    aScope + "read.skip.late.data.loading :\t " + InternalParameters.ReadSkipLateDataLoading + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult +=
+    "!Flag to keep information about deferred storage to load/unload triangulation later\n";
+  aResult += "!Default value: 1(true). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.keep.late.data :\t " + InternalParameters.ReadKeepLateData + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -184,7 +228,7 @@ occ::handle<DE_Provider> DEPLY_ConfigurationNode::BuildProvider()
 
 bool DEPLY_ConfigurationNode::IsImportSupported() const
 {
-  return false;
+  return true;
 }
 
 //=================================================================================================
@@ -19,6 +19,7 @@
 #include <DE_Wrapper.hxx>
 #include <Message.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <RWPly_CafReader.hxx>
 #include <RWPly_CafWriter.hxx>
 #include <RWPly_PlyWriterContext.hxx>
 #include <TDocStd_Document.hxx>
@@ -26,6 +27,24 @@
 #include <XCAFDoc_ShapeTool.hxx>
 #include <XCAFPrs_DocumentExplorer.hxx>
 
+namespace
+{
+//=================================================================================================
+
+static void SetReaderParameters(RWPly_CafReader&                            theReader,
+                                const occ::handle<DEPLY_ConfigurationNode>& theNode)
+{
+  theReader.SetDoublePrecision(!theNode->InternalParameters.ReadSinglePrecision);
+  theReader.SetSystemLengthUnit(theNode->GlobalParameters.LengthUnit / 1000);
+  theReader.SetSystemCoordinateSystem(theNode->InternalParameters.SystemCS);
+  theReader.SetFileLengthUnit(theNode->InternalParameters.FileLengthUnit);
+  theReader.SetFileCoordinateSystem(theNode->InternalParameters.FileCS);
+  theReader.SetRootPrefix(theNode->InternalParameters.ReadRootPrefix);
+  theReader.SetToSkipLateDataLoading(theNode->InternalParameters.ReadSkipLateDataLoading);
+  theReader.SetToKeepLateData(theNode->InternalParameters.ReadKeepLateData);
+}
+} // namespace
+
 IMPLEMENT_STANDARD_RTTIEXT(DEPLY_Provider, DE_Provider)
 
 //=================================================================================================
@@ -41,6 +60,17 @@ DEPLY_Provider::DEPLY_Provider(const occ::handle<DE_ConfigurationNode>& theNode)
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&       thePath,
+                          const occ::handle<TDocStd_Document>& theDocument,
+                          occ::handle<XSControl_WorkSession>&  theWS,
+                          const Message_ProgressRange&         theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theDocument, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
                            const occ::handle<TDocStd_Document>& theDocument,
                            occ::handle<XSControl_WorkSession>&  theWS,
@@ -52,6 +82,38 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&       thePath,
+                          const occ::handle<TDocStd_Document>& theDocument,
+                          const Message_ProgressRange&         theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateDocument(theDocument, aContext))
+  {
+    return false;
+  }
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  occ::handle<DEPLY_ConfigurationNode> aNode = occ::down_cast<DEPLY_ConfigurationNode>(GetNode());
+  RWPly_CafReader                      aReader;
+  aReader.SetDocument(theDocument);
+  SetReaderParameters(aReader, aNode);
+  XCAFDoc_DocumentTool::SetLengthUnit(theDocument,
+                                      aNode->GlobalParameters.LengthUnit,
+                                      UnitsMethods_LengthUnit_Millimeter);
+  if (!aReader.Perform(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
                            const occ::handle<TDocStd_Document>& theDocument,
                            const Message_ProgressRange&         theProgress)
@@ -117,6 +179,17 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&       thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&      thePath,
+                          TopoDS_Shape&                       theShape,
+                          occ::handle<XSControl_WorkSession>& theWS,
+                          const Message_ProgressRange&        theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theShape, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&      thePath,
                            const TopoDS_Shape&                 theShape,
                            occ::handle<XSControl_WorkSession>& theWS,
@@ -128,6 +201,31 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&      thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          const Message_ProgressRange&   theProgress)
+{
+  TCollection_AsciiString aContext = TCollection_AsciiString("reading the file ") + thePath;
+  if (!DE_ValidationUtils::ValidateConfigurationNode(GetNode(),
+                                                     STANDARD_TYPE(DEPLY_ConfigurationNode),
+                                                     aContext))
+  {
+    return false;
+  }
+  occ::handle<DEPLY_ConfigurationNode> aNode = occ::down_cast<DEPLY_ConfigurationNode>(GetNode());
+  RWPly_CafReader                      aReader;
+  SetReaderParameters(aReader, aNode);
+  if (!aReader.Perform(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  theShape = aReader.SingleShape();
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
                            const TopoDS_Shape&            theShape,
                            const Message_ProgressRange&   theProgress)
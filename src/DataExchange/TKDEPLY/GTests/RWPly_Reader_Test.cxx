@@ -0,0 +1,332 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWPly_CafReader.hxx>
+#include <RWPly_Reader.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes the value in specified format.
+template <typename T>
+void writeValue(std::ostream& theStream, const RWPly_Reader::PlyFormat theFormat, const T theValue)
+{
+  if (theFormat == RWPly_Reader::PlyFormat_Ascii)
+  {
+    theStream << " " << (sizeof(T) == 1 ? int(theValue) : theValue);
+    return;
+  }
+
+  char aBytes[sizeof(T)];
+  std::memcpy(aBytes, &theValue, sizeof(T));
+  const uint16_t anOne          = 1;
+  const bool     isLittleEndian = *reinterpret_cast<const uint8_t*>(&anOne) == 1;
+  if (isLittleEndian != (theFormat == RWPly_Reader::PlyFormat_BinaryLittleEndian))
+  {
+    for (size_t aByteIter = 0; aByteIter < sizeof(T) / 2; ++aByteIter)
+    {
+      std::swap(aBytes[aByteIter], aBytes[sizeof(T) - 1 - aByteIter]);
+    }
+  }
+  theStream.write(aBytes, sizeof(T));
+}
+
+//! Returns PLY file of a regular grid of theNbCells x theNbCells squares,
+//! defined by quads in even rows and by triangles in odd rows.
+std::string makePlyGrid(const RWPly_Reader::PlyFormat theFormat,
+                        const int                     theNbCells,
+                        const bool                    theToWriteAttribs)
+{
+  const int aNbCols  = theNbCells + 1;
+  const int aNbNodes = aNbCols * aNbCols;
+  const int aNbQuads = (theNbCells + 1) / 2 * theNbCells;
+  const int aNbFaces = aNbQuads + (theNbCells * theNbCells - aNbQuads) * 2;
+
+  std::ostringstream aStream;
+  aStream.precision(9);
+  aStream << "ply\nformat "
+          << (theFormat == RWPly_Reader::PlyFormat_Ascii
+                ? "ascii"
+                : (theFormat == RWPly_Reader::PlyFormat_BinaryLittleEndian ? "binary_little_endian"
+                                                                           : "binary_big_endian"))
+          << " 1.0\ncomment grid sample\nelement vertex " << aNbNodes
+          << "\nproperty float x\nproperty float y\nproperty float z\n";
+  if (theToWriteAttribs)
+  {
+    aStream << "property float nx\nproperty float ny\nproperty float nz\n"
+               "property float s\nproperty float t\nproperty uchar red\n";
+  }
+  aStream << "element face " << aNbFaces << "\nproperty list uchar int vertex_indices\n";
+  if (theToWriteAttribs)
+  {
+    aStream << "property int surface_id\n";
+  }
+  aStream << "element edge 1\nproperty int vertex1\nproperty int vertex2\nend_header\n";
+
+  const bool isAscii = theFormat == RWPly_Reader::PlyFormat_Ascii;
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      writeValue(aStream, theFormat, float(aCol * 0.125));
+      writeValue(aStream, theFormat, float(aRow * 0.125));
+      writeValue(aStream, theFormat, float((aRow % 3) * 0.25));
+      if (theToWriteAttribs)
+      {
+        writeValue(aStream, theFormat, 0.0f);
+        writeValue(aStream, theFormat, 0.0f);
+        writeValue(aStream, theFormat, 1.0f);
+        writeValue(aStream, theFormat, float(aCol) / float(theNbCells));
+        writeValue(aStream, theFormat, float(aRow) / float(theNbCells));
+        writeValue(aStream, theFormat, uint8_t(aRow % 256));
+      }
+      if (isAscii)
+      {
+        aStream << "\n";
+      }
+    }
+  }
+
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNodes[4] = {aRow * aNbCols + aCol,
+                             aRow * aNbCols + aCol + 1,
+                             (aRow + 1) * aNbCols + aCol + 1,
+                             (aRow + 1) * aNbCols + aCol};
+      for (int aTri = 0; aTri < (aRow % 2 == 0 ? 1 : 2); ++aTri)
+      {
+        writeValue(aStream, theFormat, uint8_t(aRow % 2 == 0 ? 4 : 3));
+        if (aRow % 2 == 0)
+        {
+          for (int aNode = 0; aNode < 4; ++aNode)
+          {
+            writeValue(aStream, theFormat, int32_t(aNodes[aNode]));
+          }
+        }
+        else
+        {
+          writeValue(aStream, theFormat, int32_t(aNodes[0]));
+          writeValue(aStream, theFormat, int32_t(aNodes[aTri == 0 ? 1 : 2]));
+          writeValue(aStream, theFormat, int32_t(aNodes[aTri == 0 ? 2 : 3]));
+        }
+        if (theToWriteAttribs)
+        {
+          writeValue(aStream, theFormat, int32_t(aRow));
+        }
+        if (isAscii)
+        {
+          aStream << "\n";
+        }
+      }
+    }
+  }
+  writeValue(aStream, theFormat, int32_t(0));
+  writeValue(aStream, theFormat, int32_t(1));
+  if (isAscii)
+  {
+    aStream << "\n";
+  }
+  return aStream.str();
+}
+
+//! Reads PLY data from the string.
+occ::handle<Poly_Triangulation> readPly(const std::string& theContent, RWPly_Reader& theReader)
+{
+  std::istringstream aStream(theContent);
+  EXPECT_TRUE(theReader.ReadHeader(aStream));
+  occ::handle<Poly_Triangulation> aMesh = new Poly_Triangulation();
+  EXPECT_TRUE(theReader.ReadData(aStream, occ::handle<RWMesh_TriangulationSource>(), aMesh));
+  return aMesh;
+}
+
+//! Checks that two triangulations are equal.
+void checkSameMesh(const occ::handle<Poly_Triangulation>& theMesh1,
+                   const occ::handle<Poly_Triangulation>& theMesh2)
+{
+  ASSERT_EQ(theMesh1->NbNodes(), theMesh2->NbNodes());
+  ASSERT_EQ(theMesh1->NbTriangles(), theMesh2->NbTriangles());
+  ASSERT_EQ(theMesh1->HasNormals(), theMesh2->HasNormals());
+  ASSERT_EQ(theMesh1->HasUVNodes(), theMesh2->HasUVNodes());
+  for (int aNodeIter = 1; aNodeIter <= theMesh1->NbNodes(); ++aNodeIter)
+  {
+    EXPECT_TRUE(theMesh1->Node(aNodeIter).IsEqual(theMesh2->Node(aNodeIter), 0.0));
+    if (theMesh1->HasNormals())
+    {
+      EXPECT_TRUE(theMesh1->Normal(aNodeIter).IsEqual(theMesh2->Normal(aNodeIter), 0.0));
+    }
+    if (theMesh1->HasUVNodes())
+    {
+      EXPECT_TRUE(theMesh1->UVNode(aNodeIter).IsEqual(theMesh2->UVNode(aNodeIter), 0.0));
+    }
+  }
+  for (int aTriIter = 1; aTriIter <= theMesh1->NbTriangles(); ++aTriIter)
+  {
+    int aNodes1[3], aNodes2[3];
+    theMesh1->Triangle(aTriIter).Get(aNodes1[0], aNodes1[1], aNodes1[2]);
+    theMesh2->Triangle(aTriIter).Get(aNodes2[0], aNodes2[1], aNodes2[2]);
+    EXPECT_EQ(aNodes1[0], aNodes2[0]);
+    EXPECT_EQ(aNodes1[1], aNodes2[1]);
+    EXPECT_EQ(aNodes1[2], aNodes2[2]);
+  }
+}
+} // namespace
+
+// Ascii and binary files of both byte orders should give the same triangulation
+TEST(RWPly_ReaderTest, AsciiAndBinaryFormats)
+{
+  const int    aNbCells = 40;
+  RWPly_Reader anAsciiReader, aLittleReader, aBigReader;
+  const occ::handle<Poly_Triangulation> anAsciiMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_Ascii, aNbCells, true), anAsciiReader);
+  const occ::handle<Poly_Triangulation> aLittleMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_BinaryLittleEndian, aNbCells, true),
+            aLittleReader);
+  const occ::handle<Poly_Triangulation> aBigMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_BinaryBigEndian, aNbCells, true), aBigReader);
+
+  EXPECT_EQ(anAsciiReader.Format(), RWPly_Reader::PlyFormat_Ascii);
+  EXPECT_EQ(aLittleReader.Format(), RWPly_Reader::PlyFormat_BinaryLittleEndian);
+  EXPECT_EQ(aBigReader.Format(), RWPly_Reader::PlyFormat_BinaryBigEndian);
+  EXPECT_EQ(anAsciiReader.Elements().Length(), 3);
+  EXPECT_TRUE(anAsciiReader.HasNormals());
+  EXPECT_TRUE(anAsciiReader.HasTexCoords());
+  EXPECT_TRUE(anAsciiReader.HasColors());
+  EXPECT_STREQ(anAsciiReader.FileComments().ToCString(), "grid sample");
+
+  ASSERT_EQ(anAsciiMesh->NbNodes(), (aNbCells + 1) * (aNbCells + 1));
+  ASSERT_EQ(anAsciiMesh->NbTriangles(), 2 * aNbCells * aNbCells);
+  EXPECT_TRUE(anAsciiMesh->HasNormals());
+  EXPECT_TRUE(anAsciiMesh->HasUVNodes());
+  EXPECT_TRUE(anAsciiMesh->Node(aNbCells + 3).IsEqual(gp_Pnt(0.125, 0.125, 0.25), 0.0));
+  EXPECT_TRUE(anAsciiMesh->UVNode(aNbCells + 3).IsEqual(gp_Pnt2d(1.0 / aNbCells, 1.0 / aNbCells),
+                                                        1.0e-7));
+
+  // the first quad is split into two triangles
+  int aNodes[3];
+  anAsciiMesh->Triangle(1).Get(aNodes[0], aNodes[1], aNodes[2]);
+  EXPECT_EQ(aNodes[0], 1);
+  EXPECT_EQ(aNodes[1], 2);
+  EXPECT_EQ(aNodes[2], aNbCells + 3);
+  anAsciiMesh->Triangle(2).Get(aNodes[0], aNodes[1], aNodes[2]);
+  EXPECT_EQ(aNodes[0], 1);
+  EXPECT_EQ(aNodes[1], aNbCells + 3);
+  EXPECT_EQ(aNodes[2], aNbCells + 2);
+
+  checkSameMesh(anAsciiMesh, aLittleMesh);
+  checkSameMesh(anAsciiMesh, aBigMesh);
+}
+
+// Binary file defining only positions should be read in the same way as general one
+TEST(RWPly_ReaderTest, BinaryPositionsOnly)
+{
+  const int    aNbCells = 30;
+  RWPly_Reader aLittleReader, aBigReader, anAsciiReader;
+  const occ::handle<Poly_Triangulation> aLittleMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_BinaryLittleEndian, aNbCells, false),
+            aLittleReader);
+  const occ::handle<Poly_Triangulation> aBigMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_BinaryBigEndian, aNbCells, false), aBigReader);
+  const occ::handle<Poly_Triangulation> anAsciiMesh =
+    readPly(makePlyGrid(RWPly_Reader::PlyFormat_Ascii, aNbCells, false), anAsciiReader);
+  EXPECT_FALSE(aLittleReader.HasNormals());
+  EXPECT_FALSE(aLittleReader.HasTexCoords());
+  EXPECT_FALSE(aLittleMesh->IsDoublePrecision());
+  EXPECT_EQ(aLittleMesh->NbTriangles(), 2 * aNbCells * aNbCells);
+  checkSameMesh(anAsciiMesh, aLittleMesh);
+  checkSameMesh(anAsciiMesh, aBigMesh);
+}
+
+// Invalid header should be rejected
+TEST(RWPly_ReaderTest, InvalidHeader)
+{
+  RWPly_Reader       aReader;
+  std::istringstream aStream("ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\n");
+  EXPECT_FALSE(aReader.ReadHeader(aStream));
+
+  RWPly_Reader       aReader2;
+  std::istringstream aStream2("obj\nformat ascii 1.0\nend_header\n");
+  EXPECT_FALSE(aReader2.ReadHeader(aStream2));
+}
+
+// Data loading could be deferred till explicit request
+TEST(RWPly_ReaderTest, DeferredLoading)
+{
+  const int                   aNbCells = 20;
+  const std::filesystem::path aFile =
+    std::filesystem::temp_directory_path() / "occt_rwply_reader_test.ply";
+  {
+    std::ofstream aStream(aFile, std::ios::binary);
+    aStream << makePlyGrid(RWPly_Reader::PlyFormat_BinaryLittleEndian, aNbCells, true);
+  }
+
+  RWPly_CafReader aReader;
+  aReader.SetToSkipLateDataLoading(true);
+  const bool isDone = aReader.Perform(aFile.string().c_str(), Message_ProgressRange());
+  EXPECT_TRUE(isDone);
+
+  TopExp_Explorer anExp(aReader.SingleShape(), TopAbs_FACE);
+  ASSERT_TRUE(anExp.More());
+  TopLoc_Location                        aLoc;
+  const occ::handle<Poly_Triangulation>& aMesh =
+    BRep_Tool::Triangulation(TopoDS::Face(anExp.Current()), aLoc);
+  ASSERT_FALSE(aMesh.IsNull());
+  EXPECT_TRUE(aMesh->HasDeferredData());
+  EXPECT_EQ(aMesh->NbDeferredNodes(), (aNbCells + 1) * (aNbCells + 1));
+  EXPECT_EQ(aMesh->NbNodes(), 0);
+
+  EXPECT_TRUE(aMesh->LoadDeferredData());
+  std::filesystem::remove(aFile);
+  EXPECT_EQ(aMesh->NbNodes(), (aNbCells + 1) * (aNbCells + 1));
+  EXPECT_EQ(aMesh->NbTriangles(), 2 * aNbCells * aNbCells);
+  EXPECT_TRUE(aMesh->HasNormals());
+  EXPECT_TRUE(aMesh->HasUVNodes());
+}
+
+// List count declared by the file should not be trusted for allocation
+TEST(RWPly_ReaderTest, TruncatedHugeList)
+{
+  std::ostringstream aStream;
+  aStream << "ply\nformat binary_little_endian 1.0\nelement vertex 3\n"
+             "property float x\nproperty float y\nproperty float z\n"
+             "element face 1\nproperty list uint int vertex_indices\nend_header\n";
+  for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+  {
+    writeValue(aStream, RWPly_Reader::PlyFormat_BinaryLittleEndian, float(aNodeIter));
+    writeValue(aStream, RWPly_Reader::PlyFormat_BinaryLittleEndian, float(aNodeIter % 2));
+    writeValue(aStream, RWPly_Reader::PlyFormat_BinaryLittleEndian, 0.0f);
+  }
+  writeValue(aStream, RWPly_Reader::PlyFormat_BinaryLittleEndian, uint32_t(2000000000));
+  for (int anIndex = 0; anIndex < 3; ++anIndex)
+  {
+    writeValue(aStream, RWPly_Reader::PlyFormat_BinaryLittleEndian, int32_t(anIndex));
+  }
+
+  RWPly_Reader       aReader;
+  std::istringstream anInStream(aStream.str());
+  ASSERT_TRUE(aReader.ReadHeader(anInStream));
+  occ::handle<Poly_Triangulation> aMesh = new Poly_Triangulation();
+  EXPECT_FALSE(aReader.ReadData(anInStream, occ::handle<RWMesh_TriangulationSource>(), aMesh));
+  EXPECT_EQ(aMesh->NbTriangles(), 0);
+}
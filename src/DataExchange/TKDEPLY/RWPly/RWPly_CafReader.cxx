@@ -0,0 +1,95 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_CafReader.hxx>
+
+#include <BRep_Builder.hxx>
+#include <Message.hxx>
+#include <RWMesh_TriangulationSource.hxx>
+#include <RWPly_Reader.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+
+//=================================================================================================
+
+RWPly_CafReader::RWPly_CafReader()
+    : myIsDoublePrecision(false),
+      myToSkipLateDataLoading(false),
+      myToKeepLateData(true)
+{
+  // PLY format defines neither length units nor coordinate system
+}
+
+//=================================================================================================
+
+occ::handle<RWPly_Reader> RWPly_CafReader::createReaderContext() const
+{
+  occ::handle<RWPly_Reader> aReader = new RWPly_Reader();
+  aReader->SetCoordinateSystemConverter(myCoordSysConverter);
+  aReader->SetDoublePrecision(myIsDoublePrecision);
+  return aReader;
+}
+
+//=================================================================================================
+
+bool RWPly_CafReader::performMesh(std::istream&                  theStream,
+                                  const TCollection_AsciiString& theFile,
+                                  const Message_ProgressRange&   theProgress,
+                                  const bool                     theToProbe)
+{
+  if (!theStream.good())
+  {
+    Message::SendFail(TCollection_AsciiString("File '") + theFile + "' is not found");
+    return false;
+  }
+
+  occ::handle<RWPly_Reader> aReader = createReaderContext();
+  aReader->SetFileName(theFile);
+  if (!aReader->ReadHeader(theStream))
+  {
+    return false;
+  }
+  if (!aReader->FileComments().IsEmpty())
+  {
+    myMetadata.Add("Comments", aReader->FileComments());
+  }
+
+  // the number of triangles is estimated assuming that file defines triangles
+  occ::handle<RWMesh_TriangulationSource> aLateMesh = new RWMesh_TriangulationSource();
+  aLateMesh->SetReader(aReader);
+  aLateMesh->SetNbDeferredNodes(aReader->NbHeaderNodes());
+  aLateMesh->SetNbDeferredTriangles(aReader->NbHeaderElements());
+
+  occ::handle<Poly_Triangulation> aMesh  = aLateMesh;
+  bool                            isDone = true;
+  if (!theToProbe && (!myToSkipLateDataLoading || !aLateMesh->HasDeferredData()))
+  {
+    const bool toKeepLateData = myToKeepLateData && aLateMesh->HasDeferredData();
+    if (!toKeepLateData)
+    {
+      aMesh = new Poly_Triangulation();
+    }
+    isDone = aReader->ReadData(theStream, aLateMesh, aMesh, theProgress);
+    if (toKeepLateData)
+    {
+      aMesh->SetMeshPurpose(aMesh->MeshPurpose() | Poly_MeshPurpose_Loaded);
+    }
+  }
+
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aMesh);
+  myRootShapes.Append(aFace);
+  return isDone;
+}
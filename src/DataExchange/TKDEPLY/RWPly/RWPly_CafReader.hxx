@@ -0,0 +1,72 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_CafReader_HeaderFile
+#define _RWPly_CafReader_HeaderFile
+
+#include <RWMesh_CafReader.hxx>
+
+class RWPly_Reader;
+
+//! The PLY mesh reader into XDE document.
+//! The file is put into a single face holding RWMesh_TriangulationSource,
+//! which allows loading / unloading triangulation data later on.
+class RWPly_CafReader : public RWMesh_CafReader
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_CafReader();
+
+  //! Return TRUE if triangulation should be loaded with double precision; FALSE by default.
+  bool IsDoublePrecision() const { return myIsDoublePrecision; }
+
+  //! Set flag to fill in triangulation using double or single precision.
+  void SetDoublePrecision(bool theIsDouble) { myIsDoublePrecision = theIsDouble; }
+
+  //! Returns TRUE if data loading should be skipped and can be performed later; FALSE by default.
+  bool ToSkipLateDataLoading() const { return myToSkipLateDataLoading; }
+
+  //! Sets flag to skip data loading.
+  void SetToSkipLateDataLoading(bool theToSkip) { myToSkipLateDataLoading = theToSkip; }
+
+  //! Returns TRUE if data should be loaded into itself without its transferring to new structure.
+  //! It allows to keep information about deferred storage to load/unload this data later.
+  //! TRUE by default.
+  bool ToKeepLateData() const { return myToKeepLateData; }
+
+  //! Sets flag to keep information about deferred storage to load/unload data later.
+  void SetToKeepLateData(bool theToKeep) { myToKeepLateData = theToKeep; }
+
+protected:
+  //! Read the mesh from specified file.
+  Standard_EXPORT bool performMesh(std::istream&                  theStream,
+                                   const TCollection_AsciiString& theFile,
+                                   const Message_ProgressRange&   theProgress,
+                                   const bool                     theToProbe) override;
+
+protected:
+  //! Create reader context.
+  //! Can be overridden by sub-class to read triangulation into application-specific data structures
+  //! instead of Poly_Triangulation.
+  Standard_EXPORT virtual occ::handle<RWPly_Reader> createReaderContext() const;
+
+protected:
+  // clang-format off
+  bool myIsDoublePrecision;     //!< flag to fill in triangulation using single or double precision
+  bool myToSkipLateDataLoading; //!< flag to skip triangulation loading
+  bool myToKeepLateData;        //!< flag to keep information about deferred storage to load/unload triangulation later
+  // clang-format on
+};
+
+#endif // _RWPly_CafReader_HeaderFile
@@ -0,0 +1,852 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_Reader.hxx>
+
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_FileSystem.hxx>
+#include <RWMesh_TriangulationSource.hxx>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <sstream>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_Reader, RWMesh_TriangulationReader)
+
+namespace
+{
+//! Size of the buffer for reading data.
+static const size_t THE_BUFFER_SIZE = 4 * 1024 * 1024;
+
+//! Number of records read between progress indicator updates.
+static const int THE_PROGRESS_STEP = 65536;
+
+//! Return TRUE on little endian platform.
+static bool isLittleEndianHost()
+{
+  const uint16_t aValue = 1;
+  return *reinterpret_cast<const uint8_t*>(&aValue) == 1;
+}
+
+//! Return type of property value from the name, or -1 for unknown type.
+static int plyTypeFromString(const std::string& theName)
+{
+  if (theName == "char" || theName == "int8")
+  {
+    return RWPly_Reader::PlyType_Int8;
+  }
+  else if (theName == "uchar" || theName == "uint8")
+  {
+    return RWPly_Reader::PlyType_UInt8;
+  }
+  else if (theName == "short" || theName == "int16")
+  {
+    return RWPly_Reader::PlyType_Int16;
+  }
+  else if (theName == "ushort" || theName == "uint16")
+  {
+    return RWPly_Reader::PlyType_UInt16;
+  }
+  else if (theName == "int" || theName == "int32")
+  {
+    return RWPly_Reader::PlyType_Int32;
+  }
+  else if (theName == "uint" || theName == "uint32")
+  {
+    return RWPly_Reader::PlyType_UInt32;
+  }
+  else if (theName == "float" || theName == "float32")
+  {
+    return RWPly_Reader::PlyType_Float32;
+  }
+  else if (theName == "double" || theName == "float64")
+  {
+    return RWPly_Reader::PlyType_Float64;
+  }
+  return -1;
+}
+
+//! Return size of binary value of specified type.
+static size_t plyTypeSize(const int theType)
+{
+  switch (theType)
+  {
+    case RWPly_Reader::PlyType_Int8:
+    case RWPly_Reader::PlyType_UInt8:
+      return 1;
+    case RWPly_Reader::PlyType_Int16:
+    case RWPly_Reader::PlyType_UInt16:
+      return 2;
+    case RWPly_Reader::PlyType_Int32:
+    case RWPly_Reader::PlyType_UInt32:
+    case RWPly_Reader::PlyType_Float32:
+      return 4;
+    case RWPly_Reader::PlyType_Float64:
+      return 8;
+  }
+  return 0;
+}
+
+//! Decode binary value.
+template <typename Type_t>
+inline double decodeValue(const uint8_t* theBytes)
+{
+  Type_t aValue;
+  memcpy(&aValue, theBytes, sizeof(Type_t));
+  return double(aValue);
+}
+
+//! Return TRUE for white space character.
+inline bool isSpace(const char theChar)
+{
+  return theChar == ' ' || theChar == '\n' || theChar == '\r' || theChar == '\t'
+         || theChar == '\v' || theChar == '\f';
+}
+
+//! Buffered reader of PLY data values.
+class PlyDataReader
+{
+public:
+  //! Main constructor.
+  PlyDataReader(std::istream& theStream, const bool theIsAscii, const bool theToSwap)
+      : myStream(theStream),
+        myBuffer(0, int(THE_BUFFER_SIZE)),
+        myPos(0),
+        myEnd(0),
+        myIsAscii(theIsAscii),
+        myToSwap(theToSwap),
+        myIsEof(false)
+  {
+    myBuffer.ChangeFirst() = '\0';
+  }
+
+  //! Return TRUE if binary values should be swapped to native byte order.
+  bool ToSwap() const { return myToSwap; }
+
+  //! Reads value of specified type.
+  //! @return FALSE on unexpected end of data or invalid Ascii value
+  bool ReadValue(const int theType, double& theValue)
+  {
+    if (myIsAscii)
+    {
+      return readToken(theValue);
+    }
+
+    const size_t aSize = plyTypeSize(theType);
+    while (myEnd - myPos < aSize)
+    {
+      if (!fill())
+      {
+        return false;
+      }
+    }
+
+    uint8_t aBytes[8];
+    memcpy(aBytes, &myBuffer.ChangeFirst() + myPos, aSize);
+    myPos += aSize;
+    if (myToSwap)
+    {
+      std::reverse(aBytes, aBytes + aSize);
+    }
+    switch (theType)
+    {
+      case RWPly_Reader::PlyType_Int8:
+        theValue = decodeValue<int8_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_UInt8:
+        theValue = decodeValue<uint8_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_Int16:
+        theValue = decodeValue<int16_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_UInt16:
+        theValue = decodeValue<uint16_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_Int32:
+        theValue = decodeValue<int32_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_UInt32:
+        theValue = decodeValue<uint32_t>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_Float32:
+        theValue = decodeValue<float>(aBytes);
+        break;
+      case RWPly_Reader::PlyType_Float64:
+        theValue = decodeValue<double>(aBytes);
+        break;
+    }
+    return true;
+  }
+
+  //! Copies binary data as is.
+  //! @return FALSE on unexpected end of data
+  bool ReadBytes(char* theData, const size_t theSize)
+  {
+    const size_t aNbBuffered = std::min(theSize, myEnd - myPos);
+    memcpy(theData, &myBuffer.ChangeFirst() + myPos, aNbBuffered);
+    myPos += aNbBuffered;
+    if (aNbBuffered == theSize)
+    {
+      return true;
+    }
+
+    myStream.read(theData + aNbBuffered, std::streamsize(theSize - aNbBuffered));
+    return size_t(myStream.gcount()) == theSize - aNbBuffered;
+  }
+
+private:
+  //! Moves unread data to the beginning of the buffer and reads the next portion.
+  //! @return FALSE if nothing has been read
+  bool fill()
+  {
+    char* aData = &myBuffer.ChangeFirst();
+    if (myPos > 0)
+    {
+      memmove(aData, aData + myPos, myEnd - myPos);
+      myEnd -= myPos;
+      myPos = 0;
+    }
+    if (myEnd >= THE_BUFFER_SIZE || !myStream.good())
+    {
+      return false;
+    }
+
+    myStream.read(aData + myEnd, std::streamsize(THE_BUFFER_SIZE - myEnd));
+    const size_t aNbRead = size_t(myStream.gcount());
+    myEnd += aNbRead;
+    aData[myEnd] = '\0';
+    return aNbRead > 0;
+  }
+
+  //! Reads the next Ascii value.
+  bool readToken(double& theValue)
+  {
+    for (;;)
+    {
+      const char* aData = &myBuffer.First();
+      while (myPos < myEnd && isSpace(aData[myPos]))
+      {
+        ++myPos;
+      }
+      if (myPos == myEnd)
+      {
+        if (myIsEof || !fill())
+        {
+          myIsEof = true;
+          return false;
+        }
+        continue;
+      }
+
+      size_t aTokenEnd = myPos;
+      while (aTokenEnd < myEnd && !isSpace(aData[aTokenEnd]))
+      {
+        ++aTokenEnd;
+      }
+      if (aTokenEnd == myEnd && !myIsEof)
+      {
+        // token might continue within the next portion of data
+        if (myPos == 0 && myEnd == THE_BUFFER_SIZE)
+        {
+          return false;
+        }
+        if (!fill())
+        {
+          myIsEof = true;
+        }
+        continue;
+      }
+
+      char* aNext = nullptr;
+      theValue    = Strtod(aData + myPos, &aNext);
+      const bool isValid = aNext == aData + aTokenEnd;
+      myPos              = aTokenEnd;
+      return isValid;
+    }
+  }
+
+private:
+  std::istream&            myStream;  //!< input stream
+  NCollection_Array1<char> myBuffer;  //!< data buffer with extra NULL-terminator
+  size_t                   myPos;     //!< position of unread data within the buffer
+  size_t                   myEnd;     //!< end of data within the buffer
+  bool                     myIsAscii; //!< Ascii data flag
+  bool                     myToSwap;  //!< flag to swap binary values
+  bool                     myIsEof;   //!< end of stream flag
+};
+
+//! Reads element record.
+//! Values of scalar properties are stored in theValues at the property index,
+//! items of list property with index theListProp are stored in theList.
+static bool readRecord(PlyDataReader&                   theReader,
+                       const RWPly_Reader::PlyElement& theElem,
+                       NCollection_Array1<double>&      theValues,
+                       const int                        theListProp,
+                       NCollection_Array1<int>&         theList,
+                       int&                             theListSize)
+{
+  theListSize = 0;
+  for (int aPropIter = 1; aPropIter <= theElem.Properties.Length(); ++aPropIter)
+  {
+    const RWPly_Reader::PlyProperty& aProp = theElem.Properties.Value(aPropIter);
+    if (!aProp.IsList)
+    {
+      if (!theReader.ReadValue(aProp.Type, theValues.ChangeValue(aPropIter)))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    double aCount = 0.0;
+    if (!theReader.ReadValue(aProp.CountType, aCount) || aCount < 0.0 || aCount > double(INT_MAX))
+    {
+      return false;
+    }
+
+    // the count declared by the file is not trusted for allocation:
+    // the list grows only with items actually read from the stream
+    const int  aNbItems = int(aCount);
+    const bool toStore  = aPropIter == theListProp;
+    for (int anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+    {
+      double aValue = 0.0;
+      if (!theReader.ReadValue(aProp.Type, aValue))
+      {
+        return false;
+      }
+      if (toStore)
+      {
+        if (size_t(anItemIter) >= theList.Size())
+        {
+          const size_t aNewSize = std::min(2 * theList.Size(), size_t(aNbItems));
+          theList.Resize(0, int(aNewSize - 1), true);
+        }
+        theList.ChangeValue(anItemIter) = int(aValue);
+      }
+    }
+    if (toStore)
+    {
+      theListSize = aNbItems;
+    }
+  }
+  return true;
+}
+
+//! Return TRUE if vertex element defines only single precision coordinates x, y, z.
+static bool isPlainFloatPositions(const RWPly_Reader::PlyElement& theElem,
+                                  const int                       thePosProps[3])
+{
+  if (theElem.Properties.Length() != 3)
+  {
+    return false;
+  }
+  for (int aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+  {
+    if (thePosProps[aCoordIter] != aCoordIter + 1
+        || theElem.Properties.Value(aCoordIter + 1).Type != RWPly_Reader::PlyType_Float32)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+//=================================================================================================
+
+RWPly_Reader::RWPly_Reader()
+    : myDataOffset(0),
+      myFormat(PlyFormat_Ascii),
+      myNbNodes(0),
+      myNbElems(0),
+      myVertexElem(0),
+      myFaceElem(0),
+      myIndicesProp(0),
+      myHasColors(false)
+{
+  memset(myPosProps, 0, sizeof(myPosProps));
+  memset(myNormProps, 0, sizeof(myNormProps));
+  memset(myUVProps, 0, sizeof(myUVProps));
+}
+
+//=================================================================================================
+
+bool RWPly_Reader::ReadHeader(std::istream& theStream)
+{
+  myElements.Clear();
+  myComments.Clear();
+  myDataOffset = 0;
+  myFormat     = PlyFormat_Ascii;
+  myNbNodes    = 0;
+  myNbElems    = 0;
+  myVertexElem = 0;
+  myFaceElem   = 0;
+  memset(myPosProps, 0, sizeof(myPosProps));
+  memset(myNormProps, 0, sizeof(myNormProps));
+  memset(myUVProps, 0, sizeof(myUVProps));
+  myIndicesProp = 0;
+  myHasColors   = false;
+
+  const TCollection_AsciiString anErrorPrefix =
+    TCollection_AsciiString("Error: invalid PLY header in file '") + myFileName + "'";
+  std::string aLine;
+  if (!std::getline(theStream, aLine) || aLine.compare(0, 3, "ply") != 0)
+  {
+    Message::SendFail(anErrorPrefix + "\nFile is not PLY");
+    return false;
+  }
+
+  bool hasFormat = false;
+  for (;;)
+  {
+    if (!std::getline(theStream, aLine))
+    {
+      Message::SendFail(anErrorPrefix + "\nUnexpected end of header");
+      return false;
+    }
+    if (!aLine.empty() && aLine.back() == '\r')
+    {
+      aLine.pop_back();
+    }
+
+    std::istringstream aWords(aLine);
+    std::string        aKey;
+    aWords >> aKey;
+    if (aKey.empty())
+    {
+      continue;
+    }
+    else if (aKey == "end_header")
+    {
+      break;
+    }
+    else if (aKey == "comment" || aKey == "obj_info")
+    {
+      std::string aText;
+      std::getline(aWords >> std::ws, aText);
+      if (!aText.empty())
+      {
+        if (!myComments.IsEmpty())
+        {
+          myComments += "\n";
+        }
+        myComments += aText.c_str();
+      }
+    }
+    else if (aKey == "format")
+    {
+      std::string aFormat;
+      aWords >> aFormat;
+      if (aFormat == "ascii")
+      {
+        myFormat = PlyFormat_Ascii;
+      }
+      else if (aFormat == "binary_little_endian")
+      {
+        myFormat = PlyFormat_BinaryLittleEndian;
+      }
+      else if (aFormat == "binary_big_endian")
+      {
+        myFormat = PlyFormat_BinaryBigEndian;
+      }
+      else
+      {
+        Message::SendFail(anErrorPrefix + "\nUnsupported format '" + aFormat.c_str() + "'");
+        return false;
+      }
+      hasFormat = true;
+    }
+    else if (aKey == "element")
+    {
+      PlyElement  anElem;
+      std::string aName;
+      aWords >> aName >> anElem.NbItems;
+      if (aWords.fail() || anElem.NbItems < 0)
+      {
+        Message::SendFail(anErrorPrefix + "\nInvalid element definition '" + aLine.c_str() + "'");
+        return false;
+      }
+      anElem.Name = aName.c_str();
+      myElements.Append(anElem);
+    }
+    else if (aKey == "property")
+    {
+      PlyProperty aProp;
+      std::string aType, aName;
+      aWords >> aType;
+      int aCountType = PlyType_UInt8;
+      if (aType == "list")
+      {
+        std::string aCountTypeName;
+        aWords >> aCountTypeName >> aType;
+        aCountType   = plyTypeFromString(aCountTypeName);
+        aProp.IsList = true;
+      }
+      aWords >> aName;
+      const int anItemType = plyTypeFromString(aType);
+      if (myElements.IsEmpty() || aName.empty() || anItemType < 0 || aCountType < 0)
+      {
+        Message::SendFail(anErrorPrefix + "\nInvalid property definition '" + aLine.c_str()
+                          + "'");
+        return false;
+      }
+      aProp.Name      = aName.c_str();
+      aProp.Type      = (PlyType)anItemType;
+      aProp.CountType = (PlyType)aCountType;
+      myElements.ChangeLast().Properties.Append(aProp);
+    }
+    else
+    {
+      Message::SendFail(anErrorPrefix + "\nUnknown header record '" + aLine.c_str() + "'");
+      return false;
+    }
+  }
+
+  const std::streampos aDataPos = theStream.tellg();
+  myDataOffset                  = aDataPos != std::streampos(-1) ? int64_t(aDataPos) : 0;
+  if (!hasFormat)
+  {
+    Message::SendFail(anErrorPrefix + "\nFormat is not defined");
+    return false;
+  }
+
+  for (int anElemIter = 1; anElemIter <= myElements.Length(); ++anElemIter)
+  {
+    const PlyElement& anElem = myElements.Value(anElemIter);
+    if (anElem.Name == "vertex" && myVertexElem == 0)
+    {
+      myVertexElem = anElemIter;
+    }
+    else if (anElem.Name == "face" && myFaceElem == 0)
+    {
+      myFaceElem = anElemIter;
+    }
+  }
+  if (myVertexElem == 0 || myElements.Value(myVertexElem).NbItems > INT_MAX)
+  {
+    Message::SendFail(anErrorPrefix + "\nVertex element is not defined");
+    return false;
+  }
+  if (myFaceElem != 0
+      && (myFaceElem < myVertexElem || myElements.Value(myFaceElem).NbItems > INT_MAX))
+  {
+    Message::SendFail(anErrorPrefix + "\nFace element is not supported");
+    return false;
+  }
+
+  const PlyElement& aVertexElem = myElements.Value(myVertexElem);
+  for (int aPropIter = 1; aPropIter <= aVertexElem.Properties.Length(); ++aPropIter)
+  {
+    const PlyProperty& aProp = aVertexElem.Properties.Value(aPropIter);
+    if (aProp.IsList)
+    {
+      continue;
+    }
+
+    const TCollection_AsciiString& aName = aProp.Name;
+    if (aName == "x" || aName == "y" || aName == "z")
+    {
+      myPosProps[aName.Value(1) - 'x'] = aPropIter;
+    }
+    else if (aName == "nx" || aName == "ny" || aName == "nz")
+    {
+      myNormProps[aName.Value(2) - 'x'] = aPropIter;
+    }
+    else if (aName == "s" || aName == "u" || aName == "texture_u" || aName == "texture_s")
+    {
+      myUVProps[0] = aPropIter;
+    }
+    else if (aName == "t" || aName == "v" || aName == "texture_v" || aName == "texture_t")
+    {
+      myUVProps[1] = aPropIter;
+    }
+    else if (aName == "red" || aName == "green" || aName == "blue")
+    {
+      myHasColors = true;
+    }
+  }
+  if (myPosProps[0] == 0 || myPosProps[1] == 0 || myPosProps[2] == 0)
+  {
+    Message::SendFail(anErrorPrefix + "\nVertex coordinates are not defined");
+    return false;
+  }
+  if (myNormProps[0] == 0 || myNormProps[1] == 0 || myNormProps[2] == 0)
+  {
+    memset(myNormProps, 0, sizeof(myNormProps));
+  }
+  if (myUVProps[0] == 0 || myUVProps[1] == 0)
+  {
+    memset(myUVProps, 0, sizeof(myUVProps));
+  }
+  myNbNodes = int(aVertexElem.NbItems);
+
+  if (myFaceElem != 0)
+  {
+    const PlyElement& aFaceElem = myElements.Value(myFaceElem);
+    for (int aPropIter = 1; aPropIter <= aFaceElem.Properties.Length(); ++aPropIter)
+    {
+      const PlyProperty& aProp = aFaceElem.Properties.Value(aPropIter);
+      if (aProp.IsList && (aProp.Name == "vertex_indices" || aProp.Name == "vertex_index"))
+      {
+        myIndicesProp = aPropIter;
+        break;
+      }
+    }
+    if (myIndicesProp == 0)
+    {
+      Message::SendWarning(TCollection_AsciiString("Warning: face element without vertex indices "
+                                                   "is skipped in PLY file '")
+                           + myFileName + "'");
+      myFaceElem = 0;
+    }
+    else
+    {
+      myNbElems = int(aFaceElem.NbItems);
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool RWPly_Reader::ReadData(std::istream&                                  theStream,
+                            const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+                            const occ::handle<Poly_Triangulation>&         theDestMesh,
+                            const Message_ProgressRange&                   theProgress) const
+{
+  Standard_ASSERT_RETURN(!theDestMesh.IsNull(),
+                         "The destination mesh should be initialized before loading data to it",
+                         false);
+  theDestMesh->Clear();
+  theDestMesh->SetDoublePrecision(myIsDoublePrecision);
+  if (!readData(theStream, theSourceMesh, theDestMesh, theProgress))
+  {
+    return false;
+  }
+  return theSourceMesh.IsNull() || finalizeLoading(theSourceMesh, theDestMesh);
+}
+
+//=================================================================================================
+
+bool RWPly_Reader::load(const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+                        const occ::handle<Poly_Triangulation>&         theDestMesh,
+                        const occ::handle<OSD_FileSystem>&             theFileSystem) const
+{
+  if (myVertexElem == 0)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: PLY header of file '") + myFileName
+                      + "' is not read");
+    return false;
+  }
+
+  const occ::handle<OSD_FileSystem>& aFileSystem =
+    !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aSharedStream =
+    aFileSystem->OpenIStream(myFileName, std::ios::in | std::ios::binary, myDataOffset);
+  if (aSharedStream.get() == nullptr || !aSharedStream->good())
+  {
+    Message::SendFail(TCollection_AsciiString("Error: file '") + myFileName
+                      + "' cannot be opened");
+    return false;
+  }
+  return readData(*aSharedStream, theSourceMesh, theDestMesh, Message_ProgressRange());
+}
+
+//=================================================================================================
+
+bool RWPly_Reader::readData(std::istream&                                  theStream,
+                            const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+                            const occ::handle<Poly_Triangulation>&         theDestMesh,
+                            const Message_ProgressRange&                   theProgress) const
+{
+  const TCollection_AsciiString anErrorPrefix =
+    TCollection_AsciiString("Error: invalid PLY data in file '") + myFileName + "'";
+  if (myNbNodes <= 0 || !setNbPositionNodes(theDestMesh, myNbNodes))
+  {
+    Message::SendFail(anErrorPrefix + "\nFile defines no vertices");
+    return false;
+  }
+
+  const bool hasNormals = HasNormals() && setNbNormalNodes(theDestMesh, myNbNodes);
+  const bool hasUV      = HasTexCoords() && setNbUVNodes(theDestMesh, myNbNodes);
+
+  Message_ProgressScope aPS(theProgress,
+                            "Reading PLY data",
+                            std::max(1.0, double(myNbNodes) + double(myNbElems)));
+  PlyDataReader         aReader(theStream,
+                        !IsBinary(),
+                        IsBinary()
+                          && (myFormat == PlyFormat_BinaryLittleEndian) != isLittleEndianHost());
+  NCollection_Array1<double> aValues;
+  NCollection_Array1<int>    aPolygon(0, 15);
+  int                        aPolygonSize = 0;
+  for (int anElemIter = 1; anElemIter <= myElements.Length(); ++anElemIter)
+  {
+    const PlyElement& anElem = myElements.Value(anElemIter);
+    aValues.Resize(1, std::max(1, anElem.Properties.Length()), false);
+    if (anElemIter == myVertexElem)
+    {
+      if (IsBinary() && !aReader.ToSwap() && isPlainFloatPositions(anElem, myPosProps)
+          && !theDestMesh->IsDoublePrecision() && myCoordSysConverter.IsEmpty())
+      {
+        // copy coordinates directly into nodes array
+        Poly_ArrayOfNodes& aNodes = theDestMesh->InternalNodes();
+        if (!aReader.ReadBytes(
+              reinterpret_cast<char*>(&aNodes.ChangeValue<NCollection_Vec3<float>>(0)),
+              aNodes.SizeBytes()))
+        {
+          Message::SendFail(anErrorPrefix + "\nUnexpected end of vertex data");
+          return false;
+        }
+        aPS.Next(double(myNbNodes));
+        continue;
+      }
+
+      for (int aNodeIter = 1; aNodeIter <= myNbNodes; ++aNodeIter)
+      {
+        if (!readRecord(aReader, anElem, aValues, 0, aPolygon, aPolygonSize))
+        {
+          Message::SendFail(anErrorPrefix + "\nUnexpected end of vertex data");
+          return false;
+        }
+
+        gp_XYZ aPos(aValues.Value(myPosProps[0]),
+                    aValues.Value(myPosProps[1]),
+                    aValues.Value(myPosProps[2]));
+        myCoordSysConverter.TransformPosition(aPos);
+        setNodePosition(theDestMesh, aNodeIter, aPos);
+        if (hasNormals)
+        {
+          NCollection_Vec3<float> aNorm((float)aValues.Value(myNormProps[0]),
+                                        (float)aValues.Value(myNormProps[1]),
+                                        (float)aValues.Value(myNormProps[2]));
+          myCoordSysConverter.TransformNormal(aNorm);
+          setNodeNormal(theDestMesh, aNodeIter, aNorm);
+        }
+        if (hasUV)
+        {
+          setNodeUV(theDestMesh,
+                    aNodeIter,
+                    gp_Pnt2d(aValues.Value(myUVProps[0]), aValues.Value(myUVProps[1])));
+        }
+        if (aNodeIter % THE_PROGRESS_STEP == 0)
+        {
+          aPS.Next(THE_PROGRESS_STEP);
+          if (!aPS.More())
+          {
+            return false;
+          }
+        }
+      }
+      aPS.Next(myNbNodes % THE_PROGRESS_STEP);
+    }
+    else if (anElemIter == myFaceElem)
+    {
+      // polygons are split into triangle fans
+      int  aNbTrisAlloc = myNbElems;
+      int  aNbTris      = 0;
+      bool isDone       = true;
+      if (aNbTrisAlloc > 0 && !setNbTriangles(theDestMesh, aNbTrisAlloc))
+      {
+        return false;
+      }
+      for (int aFaceIter = 1; aFaceIter <= myNbElems && isDone; ++aFaceIter)
+      {
+        if (!readRecord(aReader, anElem, aValues, myIndicesProp, aPolygon, aPolygonSize))
+        {
+          Message::SendFail(anErrorPrefix + "\nUnexpected end of face data");
+          isDone = false;
+          break;
+        }
+
+        if (aNbTris + aPolygonSize - 2 > aNbTrisAlloc)
+        {
+          aNbTrisAlloc = std::max(aNbTrisAlloc * 2, aNbTris + aPolygonSize - 2);
+          setNbTriangles(theDestMesh, aNbTrisAlloc, true);
+        }
+        for (int aNodeIter = 2; aNodeIter < aPolygonSize; ++aNodeIter)
+        {
+          const Poly_Triangle aTri(aPolygon.Value(0) + 1,
+                                   aPolygon.Value(aNodeIter - 1) + 1,
+                                   aPolygon.Value(aNodeIter) + 1);
+          const int           aResult = setTriangle(theDestMesh, aNbTris + 1, aTri);
+          if (aResult > 0)
+          {
+            ++aNbTris;
+          }
+          else if (aResult < 0)
+          {
+            if (!theSourceMesh.IsNull())
+            {
+              ++theSourceMesh->ChangeDegeneratedTriNb();
+            }
+          }
+          else
+          {
+            Message::SendFail(anErrorPrefix + "\nFace " + aFaceIter
+                              + " refers to undefined vertex");
+            isDone = false;
+            break;
+          }
+        }
+        if (aFaceIter % THE_PROGRESS_STEP == 0)
+        {
+          aPS.Next(THE_PROGRESS_STEP);
+          if (!aPS.More())
+          {
+            isDone = false;
+          }
+        }
+      }
+
+      if (aNbTris != aNbTrisAlloc)
+      {
+        if (aNbTris > 0)
+        {
+          setNbTriangles(theDestMesh, aNbTris, true);
+        }
+        else
+        {
+          theDestMesh->InternalTriangles().Resize(0, false);
+        }
+      }
+      if (!isDone)
+      {
+        return false;
+      }
+      aPS.Next(myNbElems % THE_PROGRESS_STEP);
+    }
+    else if (anElemIter > myVertexElem && anElemIter > myFaceElem)
+    {
+      // nothing else to read
+      break;
+    }
+    else
+    {
+      for (int64_t anItemIter = 0; anItemIter < anElem.NbItems; ++anItemIter)
+      {
+        if (!readRecord(aReader, anElem, aValues, 0, aPolygon, aPolygonSize))
+        {
+          Message::SendFail(anErrorPrefix + "\nUnexpected end of data of element '"
+                            + anElem.Name + "'");
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
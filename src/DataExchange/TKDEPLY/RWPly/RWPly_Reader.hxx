@@ -0,0 +1,167 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_Reader_HeaderFile
+#define _RWPly_Reader_HeaderFile
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Sequence.hxx>
+#include <RWMesh_TriangulationReader.hxx>
+
+//! PLY (Polygon File Format) mesh reader.
+//!
+//! Supports Ascii and binary (little and big endian) files.
+//! Reads positions, normals and texture coordinates of "vertex" element,
+//! and polygons of "face" element (split into triangles as fans);
+//! other elements and properties are skipped.
+//! Vertex element holding only single precision coordinates of binary file with native byte
+//! order is copied directly into nodes array of single precision triangulation.
+//!
+//! The header is read by ReadHeader(); the data could be read right after it from the same
+//! stream using ReadData(), or later from the file using this object as reader of
+//! RWMesh_TriangulationSource (deferred loading).
+class RWPly_Reader : public RWMesh_TriangulationReader
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_Reader, RWMesh_TriangulationReader)
+public: //! @name definition of file header
+  //! Data format.
+  enum PlyFormat
+  {
+    PlyFormat_Ascii,
+    PlyFormat_BinaryLittleEndian,
+    PlyFormat_BinaryBigEndian
+  };
+
+  //! Scalar type of property value.
+  enum PlyType
+  {
+    PlyType_Int8,
+    PlyType_UInt8,
+    PlyType_Int16,
+    PlyType_UInt16,
+    PlyType_Int32,
+    PlyType_UInt32,
+    PlyType_Float32,
+    PlyType_Float64
+  };
+
+  //! Element property definition.
+  struct PlyProperty
+  {
+    TCollection_AsciiString Name;      //!< property name
+    PlyType                 Type;      //!< value type (or list item type)
+    PlyType                 CountType; //!< list size type
+    bool                    IsList;    //!< flag indicating list property
+
+    PlyProperty()
+        : Type(PlyType_Float32),
+          CountType(PlyType_UInt8),
+          IsList(false)
+    {
+    }
+  };
+
+  //! Element definition.
+  struct PlyElement
+  {
+    TCollection_AsciiString           Name;       //!< element name
+    int64_t                           NbItems;    //!< number of element records
+    NCollection_Sequence<PlyProperty> Properties; //!< properties of element record
+
+    PlyElement()
+        : NbItems(0)
+    {
+    }
+  };
+
+  //! Return elements defined in the header.
+  const NCollection_Sequence<PlyElement>& Elements() const { return myElements; }
+
+public:
+  //! Constructor.
+  Standard_EXPORT RWPly_Reader();
+
+  //! Reads file header from the stream.
+  //! On success, the stream is positioned at the beginning of data.
+  //! @param[in] theStream input stream
+  //! @return FALSE if header is invalid or does not define vertex element
+  Standard_EXPORT bool ReadHeader(std::istream& theStream);
+
+  //! Reads data following the header into triangulation.
+  //! @param[in] theStream     input stream positioned at the beginning of data
+  //! @param[in] theSourceMesh triangulation defining deferred data (for loading statistic)
+  //! @param[in] theDestMesh   triangulation to fill in
+  //! @param[in] theProgress   progress indicator
+  //! @return FALSE on reading error or user break; partially read data is kept in theDestMesh
+  Standard_EXPORT bool ReadData(
+    std::istream&                                  theStream,
+    const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+    const occ::handle<Poly_Triangulation>&         theDestMesh,
+    const Message_ProgressRange&                   theProgress = Message_ProgressRange()) const;
+
+  //! Return data format.
+  PlyFormat Format() const { return myFormat; }
+
+  //! Return TRUE if file data is binary.
+  bool IsBinary() const { return myFormat != PlyFormat_Ascii; }
+
+  //! Return number of vertices defined in the header.
+  int NbHeaderNodes() const { return myNbNodes; }
+
+  //! Return number of faces defined in the header.
+  int NbHeaderElements() const { return myNbElems; }
+
+  //! Return TRUE if vertex element defines normals.
+  bool HasNormals() const { return myNormProps[0] != 0; }
+
+  //! Return TRUE if vertex element defines texture coordinates.
+  bool HasTexCoords() const { return myUVProps[0] != 0; }
+
+  //! Return TRUE if vertex element defines colors (not stored within Poly_Triangulation).
+  bool HasColors() const { return myHasColors; }
+
+  //! Return file comments (lines of "comment" and "obj_info" header records).
+  const TCollection_AsciiString& FileComments() const { return myComments; }
+
+  //! Return offset of data from the beginning of the file.
+  int64_t DataOffset() const { return myDataOffset; }
+
+protected:
+  //! Loads triangulation from the file.
+  Standard_EXPORT bool load(const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+                            const occ::handle<Poly_Triangulation>&         theDestMesh,
+                            const occ::handle<OSD_FileSystem>& theFileSystem) const override;
+
+  //! Reads data following the header.
+  Standard_EXPORT bool readData(std::istream&                                  theStream,
+                                const occ::handle<RWMesh_TriangulationSource>& theSourceMesh,
+                                const occ::handle<Poly_Triangulation>&         theDestMesh,
+                                const Message_ProgressRange&                   theProgress) const;
+
+protected:
+  NCollection_Sequence<PlyElement> myElements;     //!< elements defined in the header
+  TCollection_AsciiString          myComments;     //!< file comments
+  int64_t                          myDataOffset;   //!< offset of data from the beginning of file
+  PlyFormat                        myFormat;       //!< data format
+  int                              myNbNodes;      //!< number of vertices
+  int                              myNbElems;      //!< number of faces
+  int                              myVertexElem;   //!< index of vertex element, 0 if undefined
+  int                              myFaceElem;     //!< index of face element, 0 if undefined
+  int                              myPosProps[3];  //!< indices of x, y, z properties
+  int                              myNormProps[3]; //!< indices of nx, ny, nz properties
+  int                              myUVProps[2];   //!< indices of texture coordinates properties
+  int                              myIndicesProp;  //!< index of vertex indices property
+  bool                             myHasColors;    //!< flag indicating vertex colors
+};
+
+#endif // _RWPly_Reader_HeaderFile
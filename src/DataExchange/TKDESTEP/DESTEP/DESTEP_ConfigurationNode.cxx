@@ -142,6 +142,14 @@ bool DESTEP_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("read.metadata", InternalParameters.ReadMetadata, aScope);
   InternalParameters.ReadProductMetadata =
     theResource->BooleanVal("read.productmetadata", InternalParameters.ReadProductMetadata, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
+  InternalParameters.ReadFastScanner =
+    theResource->BooleanVal("read.fastscanner", InternalParameters.ReadFastScanner, aScope);
+  InternalParameters.ReadParallelTransfer =
+    theResource->BooleanVal("read.paralleltransfer",
+                            InternalParameters.ReadParallelTransfer,
+                            aScope);
 
   InternalParameters.WritePrecisionMode =
     (DESTEP_Parameters::WriteMode_PrecisionMode)theResource->IntegerVal(
@@ -202,6 +210,10 @@ bool DESTEP_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("write.cleanduplicates", InternalParameters.CleanDuplicates, aScope);
   InternalParameters.WriteScalingTrsf =
     theResource->BooleanVal("write.scaling.trsf", InternalParameters.WriteScalingTrsf, aScope);
+  InternalParameters.WriteStreaming =
+    theResource->BooleanVal("write.streaming", InternalParameters.WriteStreaming, aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
 
   return DE_ShapeFixConfigurationNode::Load(theResource);
 }
@@ -454,6 +466,28 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
   aResult += aScope + "read.productmetadata :\t " + InternalParameters.ReadProductMetadata + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the read.parallel parameter which is used to indicate whether to "
+             "decode the file records in parallel threads or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the read.fastscanner parameter which is used to indicate whether to "
+             "parse the file by the in-place scanner instead of flex/bison parser or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.fastscanner :\t " + InternalParameters.ReadFastScanner + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the read.paralleltransfer parameter which is used to indicate whether "
+             "to translate the solids of the model in parallel threads or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult +=
+    aScope + "read.paralleltransfer :\t " + InternalParameters.ReadParallelTransfer + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write Parameters:\n";
   aResult += "!\n";
@@ -605,6 +639,21 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
   aResult += aScope + "write.scaling.trsf :\t " + InternalParameters.WriteScalingTrsf + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the write.streaming parameter which is used to indicate whether to share "
+             "equal geometry of the translated shape and to output entity records as soon as "
+             "they are formatted, to reduce memory used by writing\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "write.streaming :\t " + InternalParameters.WriteStreaming + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the write.parallel parameter which is used to indicate whether to "
+             "format entity records in parallel threads or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += DE_ShapeFixConfigurationNode::Save();
 
   aResult += "!*****************************************************************************\n";
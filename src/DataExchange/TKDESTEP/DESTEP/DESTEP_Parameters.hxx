@@ -182,6 +182,9 @@ public:
   bool ReadProps = true; //<! PropsMode is used to indicate read Validation properties or not
   bool ReadMetadata = true; //! Parameter for metadata reading
   bool ReadProductMetadata = false; //! Parameter for product metadata reading
+  bool ReadParallel = false; //<! Defines whether the file records are decoded in parallel threads
+  bool ReadFastScanner = false; //<! Defines whether the file is parsed by the in-place scanner instead of flex/bison
+  bool ReadParallelTransfer = false; //<! Defines whether the solids are translated in parallel threads
   
   // Write
   WriteMode_PrecisionMode WritePrecisionMode = WriteMode_PrecisionMode_Average; //<! Specifies the mode of writing the resolution value into the STEP file
@@ -205,6 +208,8 @@ public:
   STEPControl_StepModelType WriteModelType = STEPControl_AsIs; //<! Gives you the choice of translation mode for an Open CASCADE shape that is being translated to STEP
   bool CleanDuplicates = false; //<! Indicates whether to remove duplicate entities from the STEP file
   bool WriteScalingTrsf = true; //<! Indicates if scaling should be written as Cartesian Operator or skipped
+  bool WriteStreaming = false; //<! Indicates whether to share equal translated geometry and output entity records as soon as they are formatted
+  bool WriteParallel = false; //<! Indicates whether entity records are formatted in parallel threads
   // clang-format on
 };
 
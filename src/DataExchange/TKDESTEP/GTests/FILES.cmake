@@ -4,7 +4,9 @@ set(OCCT_TKDESTEP_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TKDESTEP_GTests_FILES
     DESTEP_Provider_Test.cxx
     STEPConstruct_RenderingProperties_Test.cxx
+    StepData_StepReaderTool_Test.cxx
     StepData_StepWriter_Test.cxx
+    StepFile_Scanner_Test.cxx
     StepTidy_BaseTestFixture.pxx
     StepTidy_Axis2Placement3dReducer_Test.cxx
     StepTidy_CartesianPointReducer_Test.cxx
@@ -16,5 +18,6 @@ set(OCCT_TKDESTEP_GTests_FILES
     StepTidy_VectorReducer_Test.cxx
     StepToTopoDS_TranslateFace_Test.cxx
     StepTransientReplacements_Test.cxx
+    STEPControl_ActorRead_Test.cxx
     STEPCAFControl_Controller_Test.cxx
 )
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Pnt.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <Transfer_TransientProcess.hxx>
+#include <XSControl_TransferReader.hxx>
+#include <XSControl_WorkSession.hxx>
+#include <NCollection_IndexedMap.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes a compound of several separate solids into a STEP string.
+std::string writeSampleStep()
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(gp_Pnt(50.0, 0.0, 0.0), 5.0, 5.0, 5.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(5.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(3.0, 8.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeTorus(10.0, 2.0).Shape());
+
+  STEPControl_Writer aWriter;
+  EXPECT_EQ(aWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  std::ostringstream aStream;
+  EXPECT_EQ(aWriter.WriteStream(aStream), IFSelect_RetDone);
+  return aStream.str();
+}
+
+//! Reads STEP string into a shape, with or without parallel translation of solids.
+TopoDS_Shape readStep(const std::string& theContent, const bool theIsParallel)
+{
+  DESTEP_Parameters aParams;
+  aParams.ReadParallelTransfer = theIsParallel;
+
+  STEPControl_Reader aReader;
+  std::istringstream aStream(theContent);
+  EXPECT_EQ(aReader.ReadStream("test.step", aParams, aStream), IFSelect_RetDone);
+  EXPECT_GT(aReader.TransferRoots(), 0);
+  return aReader.OneShape();
+}
+
+//! Returns the number of distinct sub-shapes of given type.
+int nbSubShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMap;
+  TopExp::MapShapes(theShape, theType, aMap);
+  return aMap.Extent();
+}
+} // namespace
+
+// Parallel translation of solids should give the same shape as the sequential one
+TEST(STEPControl_ActorReadTest, ParallelTransferMatchesSequential)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+
+  const TopoDS_Shape aSeqShape = readStep(aContent, false);
+  const TopoDS_Shape aParShape = readStep(aContent, true);
+  ASSERT_FALSE(aSeqShape.IsNull());
+  ASSERT_FALSE(aParShape.IsNull());
+
+  EXPECT_EQ(nbSubShapes(aSeqShape, TopAbs_SOLID), 5);
+  for (const TopAbs_ShapeEnum aType : {TopAbs_SOLID, TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+  {
+    EXPECT_EQ(nbSubShapes(aSeqShape, aType), nbSubShapes(aParShape, aType)) << "Type " << aType;
+  }
+
+  GProp_GProps aSeqProps, aParProps;
+  BRepGProp::VolumeProperties(aSeqShape, aSeqProps);
+  BRepGProp::VolumeProperties(aParShape, aParProps);
+  EXPECT_NEAR(aSeqProps.Mass(), aParProps.Mass(), 1.0e-6 * aSeqProps.Mass());
+}
+
+// Transfer of one root should prepare and bind only the items reachable from this root
+TEST(STEPControl_ActorReadTest, ParallelTransferOfOneRoot)
+{
+  // two products, each one with several solids
+  STEPControl_Writer aWriter;
+  for (int aProdIndex = 0; aProdIndex < 2; ++aProdIndex)
+  {
+    TopoDS_Compound aCompound;
+    BRep_Builder    aBuilder;
+    aBuilder.MakeCompound(aCompound);
+    const double aShift = 100.0 * aProdIndex;
+    aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(gp_Pnt(aShift, 0.0, 0.0), 1.0, 2.0, 3.0).Shape());
+    aBuilder.Add(aCompound,
+                 BRepPrimAPI_MakeBox(gp_Pnt(aShift + 10.0, 0.0, 0.0), 3.0, 2.0, 1.0).Shape());
+    aBuilder.Add(aCompound,
+                 BRepPrimAPI_MakeSphere(gp_Pnt(aShift, 20.0, 0.0), 2.0 + aProdIndex).Shape());
+    ASSERT_EQ(aWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  }
+  std::ostringstream anOutStream;
+  ASSERT_EQ(aWriter.WriteStream(anOutStream), IFSelect_RetDone);
+  const std::string aContent = anOutStream.str();
+
+  int          aNbMapped[2] = {0, 0};
+  TopoDS_Shape aShapes[2];
+  for (int aModeIndex = 0; aModeIndex < 2; ++aModeIndex)
+  {
+    DESTEP_Parameters aParams;
+    aParams.ReadParallelTransfer = aModeIndex == 1;
+
+    STEPControl_Reader aReader;
+    std::istringstream aStream(aContent);
+    ASSERT_EQ(aReader.ReadStream("test.step", aParams, aStream), IFSelect_RetDone);
+    ASSERT_EQ(aReader.NbRootsForTransfer(), 2);
+    ASSERT_TRUE(aReader.TransferRoot(2));
+    aShapes[aModeIndex]   = aReader.OneShape();
+    aNbMapped[aModeIndex] = aReader.WS()->TransferReader()->TransientProcess()->NbMapped();
+  }
+
+  EXPECT_EQ(aNbMapped[0], aNbMapped[1]);
+  EXPECT_EQ(nbSubShapes(aShapes[1], TopAbs_SOLID), 3);
+  for (const TopAbs_ShapeEnum aType : {TopAbs_SOLID, TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+  {
+    EXPECT_EQ(nbSubShapes(aShapes[0], aType), nbSubShapes(aShapes[1], aType)) << "Type " << aType;
+  }
+  GProp_GProps aSeqProps, aParProps;
+  BRepGProp::VolumeProperties(aShapes[0], aSeqProps);
+  BRepGProp::VolumeProperties(aShapes[1], aParProps);
+  EXPECT_NEAR(aSeqProps.Mass(), aParProps.Mass(), 1.0e-6 * aSeqProps.Mass());
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepData_StepWriter.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes a compound of several primitives into a STEP string.
+std::string writeSampleStep()
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(5.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(3.0, 8.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeTorus(10.0, 2.0).Shape());
+
+  STEPControl_Writer aWriter;
+  EXPECT_EQ(aWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  std::ostringstream aStream;
+  EXPECT_EQ(aWriter.WriteStream(aStream), IFSelect_RetDone);
+  return aStream.str();
+}
+
+//! Reads STEP string into a model, with or without parallel decoding of records.
+//! The model is owned by theReader, which should be kept alive while the model is used.
+occ::handle<StepData_StepModel> readStep(const std::string&  theContent,
+                                         const bool          theIsParallel,
+                                         STEPControl_Reader& theReader)
+{
+  DESTEP_Parameters aParams;
+  aParams.ReadParallel = theIsParallel;
+
+  std::istringstream aStream(theContent);
+  EXPECT_EQ(theReader.ReadStream("test.step", aParams, aStream), IFSelect_RetDone);
+  return theReader.StepModel();
+}
+
+//! Formats the model back into STEP text, to compare the decoded contents.
+std::string dumpModel(const occ::handle<StepData_StepModel>& theModel)
+{
+  occ::handle<StepData_Protocol> aProtocol =
+    occ::down_cast<StepData_Protocol>(theModel->Protocol());
+  StepData_StepWriter aWriter(theModel);
+  aWriter.SendModel(aProtocol);
+  std::ostringstream aStream;
+  aWriter.Print(aStream);
+  return aStream.str();
+}
+} // namespace
+
+// Parallel decoding of records should give the same model as the sequential one
+TEST(StepData_StepReaderToolTest, ParallelDecodingMatchesSequential)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+
+  STEPControl_Reader              aSeqReader, aParReader;
+  occ::handle<StepData_StepModel> aSeqModel = readStep(aContent, false, aSeqReader);
+  occ::handle<StepData_StepModel> aParModel = readStep(aContent, true, aParReader);
+  ASSERT_FALSE(aSeqModel.IsNull());
+  ASSERT_FALSE(aParModel.IsNull());
+  ASSERT_GT(aSeqModel->NbEntities(), 0);
+  ASSERT_EQ(aSeqModel->NbEntities(), aParModel->NbEntities());
+
+  for (int anIndex = 1; anIndex <= aSeqModel->NbEntities(); ++anIndex)
+  {
+    EXPECT_EQ(aSeqModel->Value(anIndex)->DynamicType(), aParModel->Value(anIndex)->DynamicType())
+      << "Entity " << anIndex;
+    EXPECT_EQ(aSeqModel->IdentLabel(aSeqModel->Value(anIndex)),
+              aParModel->IdentLabel(aParModel->Value(anIndex)))
+      << "Entity " << anIndex;
+  }
+
+  EXPECT_EQ(dumpModel(aSeqModel), dumpModel(aParModel));
+}
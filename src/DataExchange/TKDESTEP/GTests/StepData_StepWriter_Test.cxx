@@ -11,11 +11,95 @@
 // Alternatively, this file may be used under the terms of Open CASCADE
 // commercial license or contractual agreement.
 
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Pnt.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
 #include <StepData_StepWriter.hxx>
 #include <TCollection_AsciiString.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_IndexedMap.hxx>
 
+#include <sstream>
 #include <gtest/gtest.h>
 
+namespace
+{
+//! Returns the number of occurrences of a text in a string.
+int nbOccurrences(const std::string& theContent, const std::string& theText)
+{
+  int aNb = 0;
+  for (size_t aPos = theContent.find(theText); aPos != std::string::npos;
+       aPos        = theContent.find(theText, aPos + theText.size()))
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Writes a shape into a STEP string, with or without streaming write mode.
+std::string writeStep(const TopoDS_Shape& theShape, const bool theIsStreaming)
+{
+  DESTEP_Parameters aParams;
+  aParams.WriteStreaming = theIsStreaming;
+
+  STEPControl_Writer aWriter;
+  EXPECT_EQ(aWriter.Transfer(theShape, STEPControl_AsIs, aParams), IFSelect_RetDone);
+  std::ostringstream aStream;
+  EXPECT_EQ(aWriter.WriteStream(aStream), IFSelect_RetDone);
+  return aStream.str();
+}
+
+//! Reads STEP string into a shape.
+TopoDS_Shape readStep(const std::string& theContent)
+{
+  STEPControl_Reader aReader;
+  std::istringstream aStream(theContent);
+  EXPECT_EQ(aReader.ReadStream("test.step", aStream), IFSelect_RetDone);
+  EXPECT_GT(aReader.TransferRoots(), 0);
+  return aReader.OneShape();
+}
+
+//! Formats the model into STEP text, with or without parallel formatting of entities.
+std::string dumpModel(const occ::handle<StepData_StepModel>& theModel,
+                      const bool                             theIsParallel,
+                      int&                                   theNbChecks)
+{
+  StepData_StepWriter aWriter(theModel);
+  aWriter.SetParallel(theIsParallel);
+  aWriter.SendModel(occ::down_cast<StepData_Protocol>(theModel->Protocol()));
+  theNbChecks = 0;
+  Interface_CheckIterator aChecks = aWriter.CheckList();
+  for (aChecks.Start(); aChecks.More(); aChecks.Next())
+  {
+    ++theNbChecks;
+  }
+  std::ostringstream aStream;
+  EXPECT_TRUE(aWriter.Print(aStream));
+  return aStream.str();
+}
+
+//! Returns the number of distinct sub-shapes of given type.
+int nbSubShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMap;
+  TopExp::MapShapes(theShape, theType, aMap);
+  return aMap.Extent();
+}
+} // namespace
+
 // Test CleanTextForSend with basic character escaping
 TEST(StepData_StepWriterTest, CleanTextForSend_BasicEscaping)
 {
@@ -157,4 +241,86 @@ TEST(StepData_StepWriterTest, CleanTextForSend_HexSequenceDetection)
   TCollection_AsciiString anInput3("start \\X2\\03C0\\X0\\ end");
   TCollection_AsciiString aResult3 = StepData_StepWriter::CleanTextForSend(anInput3);
   EXPECT_STREQ(aResult3.ToCString(), "start \\X2\\03C0\\X0\\ end");
-}
\ No newline at end of file
+}
+// Lines sent directly to the stream should be the same as printed at the end
+TEST(StepData_StepWriterTest, SetStream_MatchesPrint)
+{
+  STEPControl_Writer aWriter;
+  ASSERT_EQ(aWriter.Transfer(BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape(), STEPControl_AsIs),
+            IFSelect_RetDone);
+  const occ::handle<StepData_StepModel> aModel = aWriter.Model();
+  const occ::handle<StepData_Protocol>  aProtocol =
+    occ::down_cast<StepData_Protocol>(aModel->Protocol());
+
+  StepData_StepWriter aPrintWriter(aModel);
+  aPrintWriter.SendModel(aProtocol);
+  EXPECT_GT(aPrintWriter.NbLines(), 0);
+  std::ostringstream aPrintStream;
+  EXPECT_TRUE(aPrintWriter.Print(aPrintStream));
+
+  std::ostringstream  aStream;
+  StepData_StepWriter aStreamWriter(aModel);
+  aStreamWriter.SetStream(&aStream);
+  aStreamWriter.SendModel(aProtocol);
+  EXPECT_EQ(aStreamWriter.NbLines(), 0);
+  EXPECT_TRUE(aStreamWriter.Print(aStream));
+
+  EXPECT_EQ(aPrintStream.str(), aStream.str());
+}
+
+// Streaming write mode should write equal geometry once, without changing the read shape
+TEST(StepData_StepWriterTest, StreamingMode_SharesGeometry)
+{
+  // two adjacent faces lying on the same plane, with separate surfaces
+  const gp_Pln          aPlane;
+  BRepBuilderAPI_Sewing aSewing;
+  aSewing.Add(BRepBuilderAPI_MakeFace(aPlane, 0.0, 10.0, 0.0, 10.0).Face());
+  aSewing.Add(BRepBuilderAPI_MakeFace(aPlane, 10.0, 20.0, 0.0, 10.0).Face());
+  aSewing.Perform();
+  const TopoDS_Shape aShell = aSewing.SewedShape();
+  ASSERT_EQ(aShell.ShapeType(), TopAbs_SHELL);
+
+  const std::string aRegular   = writeStep(aShell, false);
+  const std::string aStreaming = writeStep(aShell, true);
+  EXPECT_EQ(nbOccurrences(aRegular, "= PLANE("), 2);
+  EXPECT_EQ(nbOccurrences(aStreaming, "= PLANE("), 1);
+  EXPECT_LT(nbOccurrences(aStreaming, "= LINE("), nbOccurrences(aRegular, "= LINE("));
+
+  const TopoDS_Shape aRegularShape   = readStep(aRegular);
+  const TopoDS_Shape aStreamingShape = readStep(aStreaming);
+  for (const TopAbs_ShapeEnum aType : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+  {
+    EXPECT_EQ(nbSubShapes(aRegularShape, aType), nbSubShapes(aStreamingShape, aType))
+      << "Type " << aType;
+  }
+
+  GProp_GProps aRegularProps, aStreamingProps;
+  BRepGProp::SurfaceProperties(aRegularShape, aRegularProps);
+  BRepGProp::SurfaceProperties(aStreamingShape, aStreamingProps);
+  EXPECT_NEAR(aRegularProps.Mass(), 200.0, 1.0e-6);
+  EXPECT_NEAR(aStreamingProps.Mass(), 200.0, 1.0e-6);
+}
+
+// Parallel formatting of entities should give the same text as the sequential one
+TEST(StepData_StepWriterTest, ParallelFormatting_MatchesSequential)
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  for (int anIndex = 0; anIndex < 10; ++anIndex)
+  {
+    const gp_Pnt aCorner(anIndex * 20.0, anIndex * 0.123456789, -anIndex / 3.0);
+    aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(aCorner, 10.0, 10.0 + anIndex, 1.0e-3).Shape());
+  }
+
+  STEPControl_Writer aWriter;
+  ASSERT_EQ(aWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  const occ::handle<StepData_StepModel> aModel = aWriter.Model();
+  ASSERT_GT(aModel->NbEntities(), 1024);
+
+  int               aNbSeqChecks = 0, aNbParChecks = 0;
+  const std::string aSeqText = dumpModel(aModel, false, aNbSeqChecks);
+  const std::string aParText = dumpModel(aModel, true, aNbParChecks);
+  EXPECT_EQ(aSeqText, aParText);
+  EXPECT_EQ(aNbSeqChecks, aNbParChecks);
+}
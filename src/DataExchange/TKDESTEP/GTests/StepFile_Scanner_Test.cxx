@@ -0,0 +1,158 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <DESTEP_Parameters.hxx>
+#include <Interface_EntityIterator.hxx>
+#include <STEPControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepData_StepWriter.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Sample file using the less common features of the syntax.
+const char* const THE_SAMPLE_STEP =
+  "ISO-10303-21;\n"
+  "HEADER;\n"
+  "/* comment with * and\n"
+  "   several lines */\n"
+  "FILE_DESCRIPTION(('Test'),'2;1');\n"
+  "FILE_NAME('sample.stp','2025-01-01T00:00:00',('it''s, (me)'),(''),'','','');\n"
+  "file_schema(('AUTOMOTIVE_DESIGN { 1 0 10303 214 1 1 1 1 }'));\n"
+  "ENDSEC;\n"
+  "DATA;\n"
+  "#1=CARTESIAN_POINT('',(0.,-1.5E-03,+2));\n"
+  "#2 = DIRECTION('multi\n"
+  "line',(0.,0.,1.));\n"
+  "#3=(GEOMETRIC_REPRESENTATION_CONTEXT(3)GLOBAL_UNCERTAINTY_ASSIGNED_CONTEXT((#4))\n"
+  "REPRESENTATION_CONTEXT('',''));\n"
+  "#4=UNCERTAINTY_MEASURE_WITH_UNIT(LENGTH_MEASURE(1.E-07),#5,'distance_accuracy_value','');\n"
+  "#5=(LENGTH_UNIT()NAMED_UNIT(*)SI_UNIT(.MILLI.,.METRE.));\n"
+  "#6=AXIS2_PLACEMENT_3D('',#1,#2,$);\n"
+  "#7=DRAUGHTING_PRE_DEFINED_COLOUR('red') ;\n"
+  "#8=SOME_UNKNOWN_ENTITY(\"0FF\",.T.,12,-);\n"
+  "ENDSEC;\n"
+  "END-ISO-10303-21;\n"
+  "any text after the end is ignored\n";
+
+//! Writes a compound of primitives into a STEP string.
+std::string writeSampleStep()
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(3.0, 8.0).Shape());
+
+  STEPControl_Writer aWriter;
+  EXPECT_EQ(aWriter.Transfer(aCompound, STEPControl_AsIs), IFSelect_RetDone);
+  std::ostringstream aStream;
+  EXPECT_EQ(aWriter.WriteStream(aStream), IFSelect_RetDone);
+  return aStream.str();
+}
+
+//! Reads STEP string into a model, with either flex/bison or the fast scanner.
+//! The model is owned by theReader, which should be kept alive while the model is used.
+occ::handle<StepData_StepModel> readStep(const std::string&  theContent,
+                                         const bool          theIsFast,
+                                         STEPControl_Reader& theReader)
+{
+  DESTEP_Parameters aParams;
+  aParams.ReadFastScanner = theIsFast;
+
+  std::istringstream aStream(theContent);
+  EXPECT_EQ(theReader.ReadStream("test.step", aParams, aStream), IFSelect_RetDone);
+  return theReader.StepModel();
+}
+
+//! Formats the model back into STEP text, to compare the decoded contents.
+std::string dumpModel(const occ::handle<StepData_StepModel>& theModel)
+{
+  occ::handle<StepData_Protocol> aProtocol =
+    occ::down_cast<StepData_Protocol>(theModel->Protocol());
+  StepData_StepWriter aWriter(theModel);
+  aWriter.SendModel(aProtocol);
+  std::ostringstream aStream;
+  aWriter.Print(aStream);
+  return aStream.str();
+}
+
+//! Checks that both front ends give the same model.
+void checkSameModel(const std::string& theContent)
+{
+  STEPControl_Reader              aFlexReader, aFastReader;
+  occ::handle<StepData_StepModel> aFlexModel = readStep(theContent, false, aFlexReader);
+  occ::handle<StepData_StepModel> aFastModel = readStep(theContent, true, aFastReader);
+  ASSERT_FALSE(aFlexModel.IsNull());
+  ASSERT_FALSE(aFastModel.IsNull());
+  ASSERT_GT(aFlexModel->NbEntities(), 0);
+  ASSERT_EQ(aFlexModel->NbEntities(), aFastModel->NbEntities());
+  EXPECT_EQ(aFlexModel->Header().NbEntities(), aFastModel->Header().NbEntities());
+  EXPECT_EQ(dumpModel(aFlexModel), dumpModel(aFastModel));
+}
+} // namespace
+
+// The scanner should give the same model as flex/bison on a written file
+TEST(StepFile_ScannerTest, WrittenFileMatchesFlex)
+{
+  const std::string aContent = writeSampleStep();
+  ASSERT_FALSE(aContent.empty());
+  checkSameModel(aContent);
+}
+
+// The scanner should give the same model as flex/bison on unusual syntax
+TEST(StepFile_ScannerTest, SyntaxVariantsMatchFlex)
+{
+  checkSameModel(THE_SAMPLE_STEP);
+}
+
+// On syntax error the file is read again by flex/bison with its error recovery
+TEST(StepFile_ScannerTest, SyntaxErrorFallsBackToFlex)
+{
+  std::string aContent(THE_SAMPLE_STEP);
+  const size_t aPos = aContent.find("(0.,0.,1.)");
+  ASSERT_NE(aPos, std::string::npos);
+  aContent.replace(aPos, 10, "(0.,0. 1.)");
+  checkSameModel(aContent);
+}
+
+// Files larger than the window of the scanner, with tokens and comments crossing its boundaries
+TEST(StepFile_ScannerTest, LargeFileMatchesFlex)
+{
+  std::string  aContent(THE_SAMPLE_STEP);
+  const size_t aPos = aContent.find("ENDSEC;\nEND-ISO");
+  ASSERT_NE(aPos, std::string::npos);
+
+  std::ostringstream aData;
+  for (int anIndex = 10; anIndex < 40000; ++anIndex)
+  {
+    aData << "#" << anIndex << "=CARTESIAN_POINT('point " << anIndex << "',(" << anIndex
+          << ".5,-1.25E-03,.T.));\n";
+    if (anIndex % 10000 == 0)
+    {
+      // string and comment larger than the initial window
+      aData << "#" << anIndex << "0=DRAUGHTING_PRE_DEFINED_COLOUR('"
+            << std::string(1500000, 'a') << "\n'\n);\n/*" << std::string(1500000, '*') << "*/\n";
+    }
+  }
+  aContent.insert(aPos, aData.str());
+  checkSameModel(aContent);
+}
@@ -29,6 +29,7 @@
 #include <MoniTool_Macros.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -36,6 +37,7 @@
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
 #include <StepBasic_ProductDefinition.hxx>
+#include <StepBasic_ProductDefinitionRelationship.hxx>
 #include <StepBasic_ProductRelatedProductCategory.hxx>
 #include <STEPConstruct_Assembly.hxx>
 #include <STEPConstruct_UnitContext.hxx>
@@ -100,6 +102,7 @@
 #include <StepShape_TopologicalRepresentationItem.hxx>
 #include <TopoDS_Shape.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <StepToTopoDS_MakeTransformed.hxx>
 #include <StepToTopoDS_Tool.hxx>
 #include <StepToTopoDS_TranslateFace.hxx>
@@ -216,7 +219,8 @@ bool NM_DETECTED = false;
 STEPControl_ActorRead::STEPControl_ActorRead(const occ::handle<Interface_InterfaceModel>& theModel)
     : myPrecision(0.0),
       myMaxTol(0.0),
-      myModel(theModel)
+      myModel(theModel),
+      myPreparedTP(nullptr)
 {
 }
 
@@ -403,7 +407,34 @@ occ::handle<Transfer_Binder> STEPControl_ActorRead::Transfer(
   }
   // [END] Get version of preprocessor (to detect I-Deas case) (ssv; 23.11.2010)
   bool aTrsfUse = (aStepModel->InternalParameters.ReadRootTransformation == 1);
-  return TransferShape(start, TP, aLocalFactors, true, aTrsfUse, theProgress);
+  if (!aStepModel->InternalParameters.ReadParallelTransfer || myPreparedTP != nullptr)
+  {
+    // nested transfers take over the results prepared for the root being transferred
+    return TransferShape(start, TP, aLocalFactors, true, aTrsfUse, theProgress);
+  }
+
+  // solids reachable from the root are translated in advance in parallel threads;
+  // the results not taken over by the transfer are released at its end
+  Message_ProgressScope        aPS(theProgress, nullptr, 2);
+  occ::handle<Transfer_Binder> aBinder;
+  myPreparedTP = TP.get();
+  try
+  {
+    prepareItems(start, TP, aLocalFactors, aPS.Next());
+    if (!aPS.UserBreak())
+    {
+      aBinder = TransferShape(start, TP, aLocalFactors, true, aTrsfUse, aPS.Next());
+    }
+  }
+  catch (...)
+  {
+    myPreparedItems.Clear();
+    myPreparedTP = nullptr;
+    throw;
+  }
+  myPreparedItems.Clear();
+  myPreparedTP = nullptr;
+  return aBinder;
 }
 
 // ============================================================================
@@ -441,6 +472,19 @@ static occ::handle<StepRepr_Representation> FindContext(
   return rep;
 }
 
+//=======================================================================
+// function : IsSameFactors
+// purpose  : Returns true if the unit factors are equal
+//=======================================================================
+
+static bool IsSameFactors(const StepData_Factors& theFactors1, const StepData_Factors& theFactors2)
+{
+  return theFactors1.LengthFactor() == theFactors2.LengthFactor()
+         && theFactors1.PlaneAngleFactor() == theFactors2.PlaneAngleFactor()
+         && theFactors1.SolidAngleFactor() == theFactors2.SolidAngleFactor()
+         && theFactors1.CascadeUnit() == theFactors2.CascadeUnit();
+}
+
 //=======================================================================
 // function : FindShapeReprType
 // purpose  : Returns integer corresponding to the type of the representation
@@ -1779,10 +1823,6 @@ occ::handle<TransferBRep_ShapeBinder> STEPControl_ActorRead::TransferEntity(
 {
   Message_Messenger::StreamBuffer       sout = TP->Messenger()->SendInfo();
   occ::handle<TransferBRep_ShapeBinder> shbinder;
-  bool                                  found = false;
-  StepToTopoDS_Builder                  myShapeBuilder;
-  TopoDS_Shape                          mappedShape;
-  int                                   nbTPitems = TP->NbMapped();
 #ifdef TRANSLOG
   OSD_Timer chrono;
   if (TP->TraceLevel() > 2)
@@ -1808,120 +1848,208 @@ occ::handle<TransferBRep_ShapeBinder> STEPControl_ActorRead::TransferEntity(
       PrepareUnits(context, TP, aLocalFactors);
     }
   }
-  myShapeBuilder.SetPrecision(myPrecision);
-  myShapeBuilder.SetMaxTol(myMaxTol);
+
+  // Take the result translated in advance if it has been done in the same conditions
+  bool          isDone    = false;
+  PreparedItem* aPrepared = myPreparedItems.ChangeSeek(start);
+  if (aPrepared != nullptr && !aPrepared->TP.IsNull() && isManifold
+      && aPrepared->Context == mySRContext && aPrepared->Precision == myPrecision
+      && aPrepared->MaxTol == myMaxTol && IsSameFactors(aPrepared->Factors, aLocalFactors))
+  {
+    const occ::handle<Transfer_TransientProcess>& aLocalTP = aPrepared->TP;
+    for (int anIndex = 1; anIndex <= aLocalTP->NbMapped(); ++anIndex)
+    {
+      // items sharing entities are not prepared, the check is kept for safety
+      if (!TP->IsBound(aLocalTP->Mapped(anIndex)))
+      {
+        TP->Bind(aLocalTP->Mapped(anIndex), aLocalTP->MapItem(anIndex));
+      }
+    }
+    shbinder = aPrepared->Binder;
+    isDone   = aPrepared->IsDone;
+  }
+  else
+  {
+    isDone = transferItem(start,
+                          TP,
+                          aLocalFactors,
+                          myPrecision,
+                          myMaxTol,
+                          isManifold,
+                          shbinder,
+                          theProgress);
+  }
+  if (aPrepared != nullptr)
+  {
+    myPreparedItems.UnBind(start);
+  }
+  if (!isDone)
+  {
+    return shbinder;
+  }
+#ifdef TRANSLOG
+  chrono.Stop();
+  if (TP->TraceLevel() > 2)
+  {
+    sout << "End transfer STEP -> CASCADE :" << (!shbinder.IsNull() ? "OK" : " : no result")
+         << '\n';
+  }
+  if (TP->TraceLevel() > 2)
+  {
+    chrono.Show();
+  }
+#endif
+  if (oldSRContext.IsNull() && !mySRContext.IsNull())
+  { //: S4136
+    PrepareUnits(oldSRContext, TP, aLocalFactors);
+  }
+  TP->Bind(start, shbinder);
+  return shbinder;
+}
+
+//=================================================================================================
+
+bool STEPControl_ActorRead::transferItem(
+  const occ::handle<StepGeom_GeometricRepresentationItem>& theItem,
+  const occ::handle<Transfer_TransientProcess>&            theTP,
+  const StepData_Factors&                                  theLocalFactors,
+  const double                                             thePrecision,
+  const double                                             theMaxTol,
+  const bool                                               theIsManifold,
+  occ::handle<TransferBRep_ShapeBinder>&                   theBinder,
+  const Message_ProgressRange&                             theProgress)
+{
+  bool                 found = false;
+  StepToTopoDS_Builder myShapeBuilder;
+  TopoDS_Shape         mappedShape;
+  int                  nbTPitems = theTP->NbMapped();
+  occ::handle<StepData_StepModel> aStepModel = occ::down_cast<StepData_StepModel>(theTP->Model());
+  myShapeBuilder.SetPrecision(thePrecision);
+  myShapeBuilder.SetMaxTol(theMaxTol);
 
   // Start progress scope (no need to check if progress exists -- it is safe)
-  Message_ProgressScope aPS(theProgress, "Transfer stage", isManifold ? 2 : 1);
+  Message_ProgressScope aPS(theProgress, "Transfer stage", theIsManifold ? 2 : 1);
   const bool aReadTessellatedWhenNoBRepOnly = (aStepModel->InternalParameters.ReadTessellated == 2);
   bool       aHasGeom                       = true;
   try
   {
     OCC_CATCH_SIGNALS
     Message_ProgressRange aRange = aPS.Next();
-    if (start->IsKind(STANDARD_TYPE(StepShape_FacetedBrep)))
+    if (theItem->IsKind(STANDARD_TYPE(StepShape_FacetedBrep)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_FacetedBrep, start), TP, aLocalFactors, aRange);
+      myShapeBuilder.Init(GetCasted(StepShape_FacetedBrep, theItem),
+                          theTP,
+                          theLocalFactors,
+                          aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_BrepWithVoids)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_BrepWithVoids)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_BrepWithVoids, start), TP, aLocalFactors, aRange);
+      myShapeBuilder.Init(GetCasted(StepShape_BrepWithVoids, theItem),
+                          theTP,
+                          theLocalFactors,
+                          aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_ManifoldSolidBrep, start), TP, aLocalFactors, aRange);
+      myShapeBuilder.Init(GetCasted(StepShape_ManifoldSolidBrep, theItem),
+                          theTP,
+                          theLocalFactors,
+                          aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_ShellBasedSurfaceModel)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_ShellBasedSurfaceModel)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_ShellBasedSurfaceModel, start),
-                          TP,
+      myShapeBuilder.Init(GetCasted(StepShape_ShellBasedSurfaceModel, theItem),
+                          theTP,
                           myNMTool,
-                          aLocalFactors,
+                          theLocalFactors,
                           aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_FacetedBrepAndBrepWithVoids)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_FacetedBrepAndBrepWithVoids)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_FacetedBrepAndBrepWithVoids, start),
-                          TP,
-                          aLocalFactors,
+      myShapeBuilder.Init(GetCasted(StepShape_FacetedBrepAndBrepWithVoids, theItem),
+                          theTP,
+                          theLocalFactors,
                           aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_GeometricSet)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_GeometricSet)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_GeometricSet, start),
-                          TP,
-                          aLocalFactors,
+      myShapeBuilder.Init(GetCasted(StepShape_GeometricSet, theItem),
+                          theTP,
+                          theLocalFactors,
                           this,
-                          isManifold,
+                          theIsManifold,
                           aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_EdgeBasedWireframeModel)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_EdgeBasedWireframeModel)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_EdgeBasedWireframeModel, start), TP, aLocalFactors);
+      myShapeBuilder.Init(GetCasted(StepShape_EdgeBasedWireframeModel, theItem),
+                          theTP,
+                          theLocalFactors);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepShape_FaceBasedSurfaceModel)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepShape_FaceBasedSurfaceModel)))
     {
-      myShapeBuilder.Init(GetCasted(StepShape_FaceBasedSurfaceModel, start), TP, aLocalFactors);
+      myShapeBuilder.Init(GetCasted(StepShape_FaceBasedSurfaceModel, theItem),
+                          theTP,
+                          theLocalFactors);
       found = true;
     }
     // TODO: Normally, StepVisual_Tessellated* entities should be processed after
     //       StepShape_* entities in order to resolve links to BRep topological objects.
     //       Currently it is not guaranteed and might require changes in the processing order.
-    else if (start->IsKind(STANDARD_TYPE(StepVisual_TessellatedSolid)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepVisual_TessellatedSolid)))
     {
-      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedSolid, start),
-                          TP,
+      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedSolid, theItem),
+                          theTP,
                           aReadTessellatedWhenNoBRepOnly,
                           aHasGeom,
-                          aLocalFactors,
+                          theLocalFactors,
                           aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepVisual_TessellatedShell)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepVisual_TessellatedShell)))
     {
-      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedShell, start),
-                          TP,
+      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedShell, theItem),
+                          theTP,
                           aReadTessellatedWhenNoBRepOnly,
                           aHasGeom,
-                          aLocalFactors,
+                          theLocalFactors,
                           aRange);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepVisual_TessellatedFace)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepVisual_TessellatedFace)))
     {
-      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedFace, start),
-                          TP,
+      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedFace, theItem),
+                          theTP,
                           aReadTessellatedWhenNoBRepOnly,
                           aHasGeom,
-                          aLocalFactors);
+                          theLocalFactors);
       found = true;
     }
-    else if (start->IsKind(STANDARD_TYPE(StepVisual_TessellatedSurfaceSet)))
+    else if (theItem->IsKind(STANDARD_TYPE(StepVisual_TessellatedSurfaceSet)))
     {
-      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedSurfaceSet, start),
-                          TP,
+      myShapeBuilder.Init(GetCasted(StepVisual_TessellatedSurfaceSet, theItem),
+                          theTP,
                           aHasGeom,
-                          aLocalFactors);
+                          theLocalFactors);
       found = true;
     }
   }
   catch (Standard_Failure const&)
   {
-    TP->AddFail(start, "Exception is raised. Entity was not translated.");
-    TP->Bind(start, shbinder);
-    return shbinder;
+    theTP->AddFail(theItem, "Exception is raised. Entity was not translated.");
+    return false;
   }
 
   if (aPS.UserBreak())
   {
-    return shbinder;
+    return false;
   }
 
   if (found && myShapeBuilder.IsDone())
@@ -1929,42 +2057,316 @@ occ::handle<TransferBRep_ShapeBinder> STEPControl_ActorRead::TransferEntity(
     mappedShape = myShapeBuilder.Value();
     // Apply ShapeFix (on manifold shapes only. Non-manifold topology is processed separately:
     // ssv; 13.11.2010)
-    if (isManifold && aHasGeom)
+    if (theIsManifold && aHasGeom)
     {
       // Set tolerances for shape processing.
       // These parameters are calculated inside STEPControl_ActorRead::Transfer() and cannot be set
       // from outside.
       XSAlgo_ShapeProcessor::ParameterMap aParameters = GetShapeFixParameters();
-      XSAlgo_ShapeProcessor::SetParameter("FixShape.Tolerance3d", myPrecision, true, aParameters);
-      XSAlgo_ShapeProcessor::SetParameter("FixShape.MaxTolerance3d", myMaxTol, true, aParameters);
+      XSAlgo_ShapeProcessor::SetParameter("FixShape.Tolerance3d", thePrecision, true, aParameters);
+      XSAlgo_ShapeProcessor::SetParameter("FixShape.MaxTolerance3d", theMaxTol, true, aParameters);
       XSAlgo_ShapeProcessor aShapeProcessor(aParameters);
       mappedShape =
         aShapeProcessor.ProcessShape(mappedShape, GetProcessingFlags().first, aPS.Next());
-      aShapeProcessor.MergeTransferInfo(TP, nbTPitems);
+      aShapeProcessor.MergeTransferInfo(theTP, nbTPitems);
     }
   }
-  found = !mappedShape.IsNull();
-  if (found && shbinder.IsNull())
+  if (!mappedShape.IsNull())
   {
-    shbinder = new TransferBRep_ShapeBinder(mappedShape);
+    theBinder = new TransferBRep_ShapeBinder(mappedShape);
   }
-#ifdef TRANSLOG
-  chrono.Stop();
-  if (TP->TraceLevel() > 2)
+  return true;
+}
+
+//=================================================================================================
+
+//! Collects the shape representations which may be reached by the transfer of the root:
+//! representations of the product and of its components, mapped and related ones.
+static void collectRepresentations(
+  const occ::handle<Standard_Transient>&                                 theRoot,
+  const Interface_Graph&                                                 theGraph,
+  NCollection_DynamicArray<occ::handle<StepShape_ShapeRepresentation>>& theReps)
+{
+  NCollection_Array1<bool> aVisited(1, theGraph.Size());
+  aVisited.Init(false);
+  NCollection_DynamicArray<occ::handle<Standard_Transient>> aStack;
+  const auto aPush = [&](const occ::handle<Standard_Transient>& theEnt) {
+    const int aNum = theEnt.IsNull() ? 0 : theGraph.EntityNumber(theEnt);
+    if (aNum != 0 && !aVisited(aNum))
+    {
+      aVisited(aNum) = true;
+      aStack.Append(theEnt);
+    }
+  };
+
+  aPush(theRoot);
+  while (!aStack.IsEmpty())
+  {
+    const occ::handle<Standard_Transient> anEnt = aStack.Last();
+    aStack.EraseLast();
+    if (anEnt->IsKind(STANDARD_TYPE(StepRepr_Representation)))
+    {
+      const occ::handle<StepRepr_Representation> aRep =
+        occ::down_cast<StepRepr_Representation>(anEnt);
+      const occ::handle<StepShape_ShapeRepresentation> aSR =
+        occ::down_cast<StepShape_ShapeRepresentation>(anEnt);
+      if (!aSR.IsNull())
+      {
+        theReps.Append(aSR);
+      }
+      for (int anItemIndex = 1; anItemIndex <= aRep->NbItems(); ++anItemIndex)
+      {
+        const occ::handle<StepRepr_MappedItem> aMappedItem =
+          occ::down_cast<StepRepr_MappedItem>(aRep->ItemsValue(anItemIndex));
+        if (!aMappedItem.IsNull() && !aMappedItem->MappingSource().IsNull())
+        {
+          aPush(aMappedItem->MappingSource()->MappedRepresentation());
+        }
+      }
+      // related representations, except the placements of assembly components
+      // which are reached through the product structure
+      for (Interface_EntityIterator aSharings = theGraph.Sharings(anEnt); aSharings.More();
+           aSharings.Next())
+      {
+        if (aSharings.Value()->IsKind(STANDARD_TYPE(StepRepr_RepresentationRelationship))
+            && theGraph.TypedSharings(aSharings.Value(),
+                                      STANDARD_TYPE(StepShape_ContextDependentShapeRepresentation))
+                 .NbEntities()
+                 == 0)
+        {
+          aPush(aSharings.Value());
+        }
+      }
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepRepr_RepresentationRelationship)))
+    {
+      const occ::handle<StepRepr_RepresentationRelationship> aRel =
+        occ::down_cast<StepRepr_RepresentationRelationship>(anEnt);
+      aPush(aRel->Rep1());
+      aPush(aRel->Rep2());
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepShape_ShapeDefinitionRepresentation)))
+    {
+      aPush(occ::down_cast<StepShape_ShapeDefinitionRepresentation>(anEnt)->UsedRepresentation());
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepShape_ContextDependentShapeRepresentation)))
+    {
+      aPush(occ::down_cast<StepShape_ContextDependentShapeRepresentation>(anEnt)
+              ->RepresentationRelation());
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepBasic_ProductDefinition)))
+    {
+      // shape of the product and its components
+      for (Interface_EntityIterator aSharings = theGraph.Sharings(anEnt); aSharings.More();
+           aSharings.Next())
+      {
+        const occ::handle<StepBasic_ProductDefinitionRelationship> aUsage =
+          occ::down_cast<StepBasic_ProductDefinitionRelationship>(aSharings.Value());
+        if (aSharings.Value()->IsKind(STANDARD_TYPE(StepRepr_ProductDefinitionShape))
+            || (!aUsage.IsNull() && aUsage->RelatingProductDefinition() == anEnt))
+        {
+          aPush(aSharings.Value());
+        }
+      }
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepRepr_ProductDefinitionShape)))
+    {
+      for (Interface_EntityIterator aSharings = theGraph.Sharings(anEnt); aSharings.More();
+           aSharings.Next())
+      {
+        if (aSharings.Value()->IsKind(STANDARD_TYPE(StepShape_ShapeDefinitionRepresentation))
+            || aSharings.Value()->IsKind(
+              STANDARD_TYPE(StepShape_ContextDependentShapeRepresentation)))
+        {
+          aPush(aSharings.Value());
+        }
+      }
+    }
+    else if (anEnt->IsKind(STANDARD_TYPE(StepBasic_ProductDefinitionRelationship)))
+    {
+      // component of assembly and its placement
+      aPush(occ::down_cast<StepBasic_ProductDefinitionRelationship>(anEnt)
+              ->RelatedProductDefinition());
+      for (Interface_EntityIterator aSharings =
+             theGraph.TypedSharings(anEnt, STANDARD_TYPE(StepRepr_ProductDefinitionShape));
+           aSharings.More();
+           aSharings.Next())
+      {
+        aPush(aSharings.Value());
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
+void STEPControl_ActorRead::prepareItems(const occ::handle<Standard_Transient>&        theRoot,
+                                         const occ::handle<Transfer_TransientProcess>& theTP,
+                                         const StepData_Factors&      theLocalFactors,
+                                         const Message_ProgressRange& theProgress)
+{
+  myPreparedItems.Clear();
+  occ::handle<StepData_StepModel> aStepModel = occ::down_cast<StepData_StepModel>(theTP->Model());
+  if (aStepModel.IsNull() || !theTP->HasGraph())
   {
-    sout << "End transfer STEP -> CASCADE :" << (found ? "OK" : " : no result") << '\n';
+    return;
   }
-  if (TP->TraceLevel() > 2)
+  const bool isNMMode = aStepModel->InternalParameters.ReadNonmanifold != 0;
+  if (isNMMode && myNMTool.IsIDEASCase() && aStepModel->InternalParameters.ReadIdeas)
   {
-    chrono.Show();
+    // all items are translated as non-manifold ones
+    return;
   }
-#endif
-  if (oldSRContext.IsNull() && !mySRContext.IsNull())
-  { //: S4136
-    PrepareUnits(oldSRContext, TP, aLocalFactors);
+
+  const Interface_Graph&                                               aGraph = theTP->Graph();
+  NCollection_DynamicArray<occ::handle<StepShape_ShapeRepresentation>> aReps;
+  collectRepresentations(theRoot, aGraph, aReps);
+
+  // Collect the solids of shape representations, with units of their representation.
+  // Solids sharing any entity with other solids or with already translated ones are excluded,
+  // so that these entities are translated once as in the sequential transfer.
+  NCollection_Array1<int> anOwners(1, aStepModel->NbEntities());
+  anOwners.Init(0);
+  NCollection_DynamicArray<occ::handle<StepGeom_GeometricRepresentationItem>> anItems;
+  NCollection_DynamicArray<bool>                                              aSharedFlags;
+  NCollection_DynamicArray<PreparedItem>                                      aPreparedItems;
+
+  occ::handle<Transfer_TransientProcess> aUnitTP = new Transfer_TransientProcess(1);
+  aUnitTP->SetModel(aStepModel);
+  occ::handle<StepRepr_Representation> anOldSRContext = mySRContext;
+  const double                         anOldPrecision = myPrecision;
+  const double                         anOldMaxTol    = myMaxTol;
+  for (const occ::handle<StepShape_ShapeRepresentation>& aSR : aReps)
+  {
+    if (!Recognize(aSR)
+        || (isNMMode
+            && aSR->IsKind(STANDARD_TYPE(StepShape_NonManifoldSurfaceShapeRepresentation))))
+    {
+      continue;
+    }
+
+    PreparedItem aPrepared;
+    aPrepared.Factors   = theLocalFactors;
+    aPrepared.Precision = 0.0;
+    aPrepared.MaxTol    = 0.0;
+    aPrepared.IsDone    = false;
+    for (int anItemIndex = 1; anItemIndex <= aSR->NbItems(); ++anItemIndex)
+    {
+      occ::handle<StepGeom_GeometricRepresentationItem> anItem =
+        occ::down_cast<StepGeom_GeometricRepresentationItem>(aSR->ItemsValue(anItemIndex));
+      // translation of other items depends on the state of the actor
+      if (anItem.IsNull() || !anItem->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep)))
+      {
+        continue;
+      }
+      const int anItemNum = aGraph.EntityNumber(anItem);
+      if (anItemNum == 0 || anOwners(anItemNum) != 0 || theTP->IsBound(anItem))
+      {
+        continue;
+      }
+      if (aPrepared.Context.IsNull())
+      {
+        PrepareUnits(aSR, aUnitTP, aPrepared.Factors);
+        aPrepared.Context   = aSR;
+        aPrepared.Precision = myPrecision;
+        aPrepared.MaxTol    = myMaxTol;
+      }
+
+      const int anOwner = anItems.Length() + 1;
+      anItems.Append(anItem);
+      aSharedFlags.Append(false);
+      aPreparedItems.Append(aPrepared);
+      anOwners(anItemNum) = anOwner;
+      NCollection_DynamicArray<occ::handle<Standard_Transient>> aStack;
+      aStack.Append(anItem);
+      while (!aStack.IsEmpty())
+      {
+        occ::handle<Standard_Transient> anEnt = aStack.Last();
+        aStack.EraseLast();
+        for (Interface_EntityIterator aSubIter = aGraph.Shareds(anEnt); aSubIter.More();
+             aSubIter.Next())
+        {
+          const occ::handle<Standard_Transient>& aSub    = aSubIter.Value();
+          const int                              aSubNum = aGraph.EntityNumber(aSub);
+          if (aSubNum == 0)
+          {
+            continue;
+          }
+          if (anOwners(aSubNum) == 0)
+          {
+            anOwners(aSubNum) = anOwner;
+            aStack.Append(aSub);
+            if (theTP->IsBound(aSub))
+            {
+              aSharedFlags(anOwner - 1) = true;
+            }
+          }
+          else if (anOwners(aSubNum) != anOwner)
+          {
+            aSharedFlags(anOwner - 1)           = true;
+            aSharedFlags(anOwners(aSubNum) - 1) = true;
+          }
+        }
+      }
+    }
   }
-  TP->Bind(start, shbinder);
-  return shbinder;
+  mySRContext = anOldSRContext;
+  myPrecision = anOldPrecision;
+  myMaxTol    = anOldMaxTol;
+
+  NCollection_DynamicArray<occ::handle<StepGeom_GeometricRepresentationItem>> aTasks;
+  for (int anIndex = 0; anIndex < anItems.Length(); ++anIndex)
+  {
+    if (!aSharedFlags(anIndex))
+    {
+      myPreparedItems.Bind(anItems(anIndex), aPreparedItems(anIndex));
+      aTasks.Append(anItems(anIndex));
+    }
+  }
+  if (aTasks.Length() < 2)
+  {
+    myPreparedItems.Clear();
+    return;
+  }
+
+  // Translate each solid with its own transient process;
+  // the items failed by exception are left for the sequential transfer
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int aNbThreads = std::min(aTasks.Length(), aThreadPool->NbDefaultThreadsToLaunch());
+  Message_ProgressScope                     aPS(theProgress, nullptr, aTasks.Length());
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aTasks.Length() - 1);
+  for (Message_ProgressRange& aRange : aRanges)
+  {
+    aRange = aPS.Next();
+  }
+  OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+  aLauncher.Perform(0, aTasks.Length(), [&](int, int theIndex) {
+    PreparedItem& aPrepared = myPreparedItems.ChangeFind(aTasks(theIndex));
+    if (aRanges(theIndex).UserBreak())
+    {
+      return;
+    }
+    try
+    {
+      OCC_CATCH_SIGNALS
+      occ::handle<Transfer_TransientProcess> aLocalTP = new Transfer_TransientProcess(100);
+      aLocalTP->SetGraph(theTP->HGraph());
+      aLocalTP->SetMessenger(theTP->Messenger());
+      aPrepared.IsDone = transferItem(aTasks(theIndex),
+                                      aLocalTP,
+                                      aPrepared.Factors,
+                                      aPrepared.Precision,
+                                      aPrepared.MaxTol,
+                                      true,
+                                      aPrepared.Binder,
+                                      aRanges(theIndex));
+      aPrepared.TP     = aLocalTP;
+    }
+    catch (Standard_Failure const&)
+    {
+      aPrepared.Binder.Nullify();
+    }
+  });
 }
 
 //=================================================================================================
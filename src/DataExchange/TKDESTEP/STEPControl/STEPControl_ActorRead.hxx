@@ -28,6 +28,7 @@
 #include <NCollection_List.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_DataMap.hxx>
 #include <Message_ProgressRange.hxx>
 #include <Interface_InterfaceModel.hxx>
 
@@ -214,6 +215,29 @@ private:
                                NCollection_List<TopoDS_Shape>,
                                TopTools_ShapeMapHasher>& shellClosingMap);
 
+  //! Translates the geometric representation item with given units and tolerances,
+  //! without binding the result to the item.
+  //! Returns false if translation has been stopped by exception or user break.
+  bool transferItem(const occ::handle<StepGeom_GeometricRepresentationItem>& theItem,
+                    const occ::handle<Transfer_TransientProcess>&            theTP,
+                    const StepData_Factors&                                  theLocalFactors,
+                    const double                                             thePrecision,
+                    const double                                             theMaxTol,
+                    const bool                                               theIsManifold,
+                    occ::handle<TransferBRep_ShapeBinder>&                   theBinder,
+                    const Message_ProgressRange&                             theProgress);
+
+  //! Translates in parallel threads the solid items of shape representations
+  //! reachable from the root, each one with its own transient process.
+  //! Solids sharing entities with other solids or with already translated ones are skipped.
+  //! The results are taken over by the main transient process when the items
+  //! are reached by the sequential transfer, so that the order of bindings is kept;
+  //! the scratch processes are released as soon as their results are taken over.
+  void prepareItems(const occ::handle<Standard_Transient>&        theRoot,
+                    const occ::handle<Transfer_TransientProcess>& theTP,
+                    const StepData_Factors&                       theLocalFactors,
+                    const Message_ProgressRange&                  theProgress);
+
   Standard_EXPORT TopoDS_Shape
     TransferRelatedSRR(const occ::handle<Transfer_TransientProcess>&     theTP,
                        const occ::handle<StepShape_ShapeRepresentation>& theRep,
@@ -223,12 +247,28 @@ private:
                        TopoDS_Compound&                                  theCund,
                        Message_ProgressScope&                            thePS);
 
+private:
+  //! Result of the item translation performed in advance
+  struct PreparedItem
+  {
+    occ::handle<StepRepr_Representation>   Context;   //!< shape representation defining units
+    StepData_Factors                       Factors;   //!< unit factors
+    double                                 Precision; //!< precision
+    double                                 MaxTol;    //!< maximum tolerance
+    occ::handle<Transfer_TransientProcess> TP;        //!< scratch process with sub-results
+    occ::handle<TransferBRep_ShapeBinder>  Binder;    //!< resulting binder
+    bool                                   IsDone;    //!< translation is completed
+  };
+
 private:
   StepToTopoDS_NMTool                   myNMTool;
   double                                myPrecision;
   double                                myMaxTol;
   occ::handle<StepRepr_Representation>  mySRContext;
   occ::handle<Interface_InterfaceModel> myModel;
+
+  NCollection_DataMap<occ::handle<Standard_Transient>, PreparedItem> myPreparedItems;
+  const Transfer_TransientProcess* myPreparedTP; //!< process of the root transfer in progress
 };
 
 #endif // _STEPControl_ActorRead_HeaderFile
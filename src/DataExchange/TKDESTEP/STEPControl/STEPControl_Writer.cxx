@@ -190,6 +190,11 @@ IFSelect_ReturnStatus STEPControl_Writer::WriteStream(std::ostream& theOStream)
   }
 
   StepData_StepWriter aWriter(aModel);
+  if (aModel->InternalParameters.WriteStreaming)
+  {
+    aWriter.SetStream(&theOStream);
+  }
+  aWriter.SetParallel(aModel->InternalParameters.WriteParallel);
   aWriter.SendModel(aProtocol);
   APIHeaderSection_MakeHeader aHeaderMaker;
   aHeaderMaker.Apply(aModel);
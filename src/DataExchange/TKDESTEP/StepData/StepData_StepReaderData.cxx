@@ -47,6 +47,7 @@
 #include <Resource_Unicode.hxx>
 
 #include <cstdio>
+#include <mutex>
 IMPLEMENT_STANDARD_RTTIEXT(StepData_StepReaderData, Interface_FileReaderData)
 
 // The Header consists of entities analogous in principle to those
@@ -153,6 +154,7 @@ void StepData_StepReaderData::cleanText(const occ::handle<TCollection_HAsciiStri
         }
         else
         {
+          std::lock_guard<std::mutex> aLock(myGlobalCheckMutex);
           thecheck->AddWarning(
             "String control directive \\P*\\ with an unsupported symbol in place of *");
         }
@@ -221,8 +223,11 @@ void StepData_StepReaderData::cleanText(const occ::handle<TCollection_HAsciiStri
           if (aStrLen % anIterStep)
           {
             aTempExtString.AssignCat('?');
-            thecheck->AddWarning(
-              "String control directive \\X2\\ is followed by number of digits not multiple of 4");
+            {
+              std::lock_guard<std::mutex> aLock(myGlobalCheckMutex);
+              thecheck->AddWarning(
+                "String control directive \\X2\\ is followed by number of digits not multiple of 4");
+            }
           }
           else
           {
@@ -247,8 +252,11 @@ void StepData_StepReaderData::cleanText(const occ::handle<TCollection_HAsciiStri
           if (aStrLen % 8)
           {
             aTempExtString.AssignCat('?');
-            thecheck->AddWarning(
-              "String control directive \\X4\\ is followed by number of digits not multiple of 8");
+            {
+              std::lock_guard<std::mutex> aLock(myGlobalCheckMutex);
+              thecheck->AddWarning(
+                "String control directive \\X4\\ is followed by number of digits not multiple of 8");
+            }
           }
           else
           {
@@ -30,6 +30,8 @@
 #include <Interface_ParamType.hxx>
 #include <NCollection_Sequence.hxx>
 #include <StepData_Logical.hxx>
+
+#include <mutex>
 class Interface_Check;
 class TCollection_AsciiString;
 class StepData_PDescr;
@@ -471,6 +473,9 @@ private:
   int                                             thenbscop;
   occ::handle<Interface_Check>                    thecheck;
   Resource_FormatType                             mySourceCodePage;
+  // clang-format off
+  mutable std::mutex                              myGlobalCheckMutex; //!< protects thecheck while records are read concurrently
+  // clang-format on
 };
 
 #endif // _StepData_StepReaderData_HeaderFile
@@ -83,6 +83,7 @@ public:
   //! fills an entity, given record no; works by using a ReaderLib
   //! to load each entity, which must be a Transient
   //! Actually, returned value is True if no fail, False else
+  //! Can be called concurrently for distinct records (see SetParallel)
   Standard_EXPORT bool AnalyseRecord(const int                              num,
                                      const occ::handle<Standard_Transient>& anent,
                                      occ::handle<Interface_Check>&          acheck) override;
@@ -20,6 +20,8 @@
 #include <Interface_InterfaceMismatch.hxx>
 #include <MoniTool_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Standard_Transient.hxx>
 #include <StepData_ESDescr.hxx>
 #include <StepData_FieldList.hxx>
@@ -64,6 +66,8 @@ StepData_StepWriter::StepData_StepWriter(const occ::handle<StepData_StepModel>&
   themodel   = amodel;
   thelabmode = thetypmode = 0;
   thefile                 = new NCollection_HSequence<occ::handle<TCollection_HAsciiString>>();
+  thestream               = nullptr;
+  theparallel             = false;
   thesect                 = false;
   thefirst                = true;
   themult                 = false;
@@ -84,6 +88,27 @@ Interface_FloatWriter& StepData_StepWriter::FloatWriter()
 
 //=================================================================================================
 
+void StepData_StepWriter::SetStream(Standard_OStream* theStream)
+{
+  thestream = theStream;
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SetParallel(const bool theIsParallel)
+{
+  theparallel = theIsParallel;
+}
+
+//=================================================================================================
+
+bool StepData_StepWriter::IsParallel() const
+{
+  return theparallel;
+}
+
+//=================================================================================================
+
 int& StepData_StepWriter::LabelMode()
 {
   return thelabmode;
@@ -162,7 +187,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
 
   if (!headeronly)
   {
-    thefile->Append(new TCollection_HAsciiString("ISO-10303-21;"));
+    appendLine(new TCollection_HAsciiString("ISO-10303-21;"));
   }
   SendHeader();
 
@@ -250,6 +275,10 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
   //  ....                Output Entities one by one                ....
 
   int nb = themodel->NbEntities();
+  if (theparallel && thescopebeg.IsNull() && sendEntitiesParallel(lib))
+  {
+    nb = 0;
+  }
   for (int i = 1; i <= nb; i++)
   {
     //    Main list: we don't send Entities that are in a Scope
@@ -275,7 +304,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
 void StepData_StepWriter::SendHeader()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("HEADER;"));
+  appendLine(new TCollection_HAsciiString("HEADER;"));
   thesect = true;
 }
 
@@ -288,7 +317,7 @@ void StepData_StepWriter::SendData()
     throw Interface_InterfaceMismatch("StepWriter : Data section");
   }
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("DATA;"));
+  appendLine(new TCollection_HAsciiString("DATA;"));
   thesect = true;
 }
 
@@ -296,7 +325,7 @@ void StepData_StepWriter::SendData()
 
 void StepData_StepWriter::EndSec()
 {
-  thefile->Append(new TCollection_HAsciiString("ENDSEC;"));
+  appendLine(new TCollection_HAsciiString("ENDSEC;"));
   thesect = false;
 }
 
@@ -309,7 +338,7 @@ void StepData_StepWriter::EndFile()
     throw Interface_InterfaceMismatch("StepWriter : EndFile");
   }
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("END-ISO-10303-21;"));
+  appendLine(new TCollection_HAsciiString("END-ISO-10303-21;"));
   thesect = false;
 }
 
@@ -461,6 +490,64 @@ void StepData_StepWriter::SendEntity(const int num, const StepData_WriterLib& li
   }
 }
 
+//=================================================================================================
+
+bool StepData_StepWriter::sendEntitiesParallel(const StepData_WriterLib& theLib)
+{
+  // Entities are formatted by blocks, each one by a separate writer into its own lines;
+  // blocks are processed by batches to limit the text kept before output
+  const int                          aBlockSize  = 512;
+  const int                          aNbEntities = themodel->NbEntities();
+  const int                          aNbBlocks   = (aNbEntities + aBlockSize - 1) / aBlockSize;
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int aNbThreads = std::min(aNbBlocks, aThreadPool->NbDefaultThreadsToLaunch());
+  if (aNbThreads < 2)
+  {
+    return false;
+  }
+
+  const int aBatchSize = aNbThreads * 4;
+  NCollection_Array1<occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>>>
+                                              aLines(0, aBatchSize - 1);
+  NCollection_Array1<Interface_CheckIterator> aChecks(0, aBatchSize - 1);
+  OSD_ThreadPool::Launcher                    aLauncher(*aThreadPool, aNbThreads);
+  for (int aBatchStart = 0; aBatchStart < aNbBlocks; aBatchStart += aBatchSize)
+  {
+    const int aBatchEnd = std::min(aBatchStart + aBatchSize, aNbBlocks);
+    aLauncher.Perform(aBatchStart, aBatchEnd, [&](const int, const int theBlock) {
+      StepData_StepWriter aWriter(themodel);
+      aWriter.thelabmode = thelabmode;
+      aWriter.thetypmode = thetypmode;
+      aWriter.theindent  = theindent;
+      aWriter.thefloatw  = thefloatw;
+      const int aLast    = std::min((theBlock + 1) * aBlockSize, aNbEntities);
+      for (int anEnt = theBlock * aBlockSize + 1; anEnt <= aLast; ++anEnt)
+      {
+        aWriter.SendEntity(anEnt, theLib);
+      }
+      aLines.ChangeValue(theBlock - aBatchStart)  = aWriter.thefile;
+      aChecks.ChangeValue(theBlock - aBatchStart) = aWriter.thechecks;
+    });
+
+    for (int aBlock = aBatchStart; aBlock < aBatchEnd; ++aBlock)
+    {
+      occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>>& aBlockLines =
+        aLines.ChangeValue(aBlock - aBatchStart);
+      for (NCollection_HSequence<occ::handle<TCollection_HAsciiString>>::Iterator aLineIter(
+             *aBlockLines);
+           aLineIter.More();
+           aLineIter.Next())
+      {
+        appendLine(aLineIter.Value());
+      }
+      aBlockLines.Nullify();
+      thechecks.Merge(aChecks.ChangeValue(aBlock - aBatchStart));
+      aChecks.ChangeValue(aBlock - aBatchStart).Clear();
+    }
+  }
+  return true;
+}
+
 //  ###########################################################################
 //  ##    ##    ##        TEXT CONSTITUTION FOR SENDING        ##    ##    ##
 
@@ -472,7 +559,7 @@ void StepData_StepWriter::NewLine(const bool evenempty)
 {
   if (evenempty || thecurr.Length() > 0)
   {
-    thefile->Append(thecurr.Moved());
+    appendLine(thecurr.Moved());
   }
   int indst = thelevel * 2;
   if (theindent)
@@ -524,7 +611,7 @@ void StepData_StepWriter::SendScope()
 void StepData_StepWriter::SendEndscope()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  appendLine(new TCollection_HAsciiString(textendscope));
 }
 
 //=================================================================================================
@@ -932,7 +1019,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
   }
   else
   {
-    thefile->Append(thecurr.Moved());
+    appendLine(thecurr.Moved());
     int anIndst = thelevel * 2;
     if (theindent)
     {
@@ -986,7 +1073,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
           }
         }
         TCollection_AsciiString aBval = aVal.Split(aStop);
-        thefile->Append(new TCollection_HAsciiString(aVal));
+        appendLine(new TCollection_HAsciiString(aVal));
         aVal = aBval;
         aNn -= aStop;
       }
@@ -1229,7 +1316,7 @@ void StepData_StepWriter::AddString(const TCollection_AsciiString& astr, const i
 void StepData_StepWriter::AddString(const char* const astr, const int lnstr, const int more)
 {
   const auto flushLine = [this](const int theRequired) {
-    thefile->Append(thecurr.Moved());
+    appendLine(thecurr.Moved());
     int indst = thelevel * 2;
     if (theindent)
     {
@@ -1276,6 +1363,19 @@ void StepData_StepWriter::AddString(const char* const astr, const int lnstr, con
   }
 }
 
+//=================================================================================================
+
+void StepData_StepWriter::appendLine(const occ::handle<TCollection_HAsciiString>& theLine)
+{
+  if (thestream == nullptr)
+  {
+    thefile->Append(theLine);
+    return;
+  }
+  thestream->write(theLine->ToCString(), theLine->Length());
+  thestream->put('\n');
+}
+
 //   FINAL SENDING
 
 //=================================================================================================
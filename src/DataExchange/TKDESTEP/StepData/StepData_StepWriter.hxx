@@ -78,6 +78,21 @@ public:
   //! because it is returned as the address of its field
   Standard_EXPORT Interface_FloatWriter& FloatWriter();
 
+  //! Sets the stream receiving each line as soon as it is completed,
+  //! instead of keeping all lines until Print() : memory used by the
+  //! text then does not grow with the file size.
+  //! Lines already kept are not written; NbLines() and Line() consider
+  //! only the lines not yet written. nullptr restores the default mode.
+  Standard_EXPORT void SetStream(Standard_OStream* theStream);
+
+  //! Sets the mode formatting entities of the data section in parallel threads,
+  //! by blocks of consecutive entities appended then in their order : the text
+  //! is the same as in sequential mode. Not used for a model with scopes.
+  Standard_EXPORT void SetParallel(const bool theIsParallel);
+
+  //! Returns True if entities are formatted in parallel threads.
+  Standard_EXPORT bool IsParallel() const;
+
   //! Declares the Entity Number <numscope> to correspond to a Scope
   //! which contains the Entity Number <numin>. Several calls to the
   //! same <numscope> add Entities in this Scope, in this order.
@@ -302,6 +317,14 @@ public:
     const TCollection_AsciiString& theText);
 
 private:
+  //! Records a completed line, either in the list of lines or
+  //! directly in the stream, see SetStream()
+  Standard_EXPORT void appendLine(const occ::handle<TCollection_HAsciiString>& theLine);
+
+  //! Sends all entities of the data section, formatted by blocks in parallel threads.
+  //! @return FALSE if the model is too small to use several threads (nothing is sent)
+  Standard_EXPORT bool sendEntitiesParallel(const StepData_WriterLib& theLib);
+
   //! adds a string to current line; first flushes it if full
   //! (72 char); more allows to ask a reserve at end of line : flush
   //! is done if remaining length (to 72) is less than <more>
@@ -312,6 +335,8 @@ private:
 
   occ::handle<StepData_StepModel>                                           themodel;
   occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>> thefile;
+  Standard_OStream*                                                         thestream;
+  bool                                                                      theparallel;
   Interface_LineBuffer                                                      thecurr;
   bool                                                                      thesect;
   bool                                                                      thecomm;
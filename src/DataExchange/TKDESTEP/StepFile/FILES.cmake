@@ -9,4 +9,6 @@ set(OCCT_StepFile_FILES
   StepFile_ReadData.hxx
   StepFile_Read.cxx
   StepFile_Read.hxx
+  StepFile_Scanner.cxx
+  StepFile_Scanner.hxx
 )
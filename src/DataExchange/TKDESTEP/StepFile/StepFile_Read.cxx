@@ -17,6 +17,7 @@
 #include <StepFile_Read.hxx>
 
 #include <StepFile_ReadData.hxx>
+#include <StepFile_Scanner.hxx>
 
 #include <Interface_Check.hxx>
 #include <Interface_InterfaceError.hxx>
@@ -41,6 +42,7 @@
 #include "step.tab.hxx"
 
 #include <cstdio>
+#include <memory>
 #include <mutex>
 
 #ifdef OCCT_DEBUG
@@ -97,19 +99,37 @@ static int StepFile_Read(const char*                                 theName,
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
+  std::unique_ptr<StepFile_ReadData> aFileDataModel(new StepFile_ReadData());
   try
   {
     OCC_CATCH_SIGNALS
-    int           aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
-    if (aLetat != 0)
+    // the stream is read again by flex/bison on syntax error, hence it should be seekable
+    bool                 isParsed  = false;
+    const std::streampos aStartPos = aStreamPtr->tellg();
+    if (theStepModel->InternalParameters.ReadFastScanner && aStartPos != std::streampos(-1))
     {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), true);
-      return 1;
+      StepFile_Scanner aFastScanner(aFileDataModel.get());
+      isParsed = aFastScanner.Init(*aStreamPtr) && aFastScanner.Perform();
+      if (!isParsed)
+      {
+        StepFile_Interrupt(aFastScanner.Error().ToCString(), false);
+        aFileDataModel.reset(new StepFile_ReadData());
+        aStreamPtr->clear();
+        aStreamPtr->seekg(aStartPos);
+      }
+    }
+    if (!isParsed)
+    {
+      int           aLetat = 0;
+      step::scanner aScanner(aFileDataModel.get(), aStreamPtr);
+      aScanner.yyrestart(aStreamPtr);
+      step::parser aParser(&aScanner);
+      aLetat = aParser.parse();
+      if (aLetat != 0)
+      {
+        StepFile_Interrupt(aFileDataModel->GetLastError(), true);
+        return 1;
+      }
     }
   }
   catch (Standard_Failure const& anException)
@@ -128,7 +148,7 @@ static int StepFile_Read(const char*                                 theName,
   std::lock_guard<std::mutex> aLock(GetGlobalReadMutex());
 
   int nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
+  aFileDataModel->GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
   occ::handle<StepData_StepReaderData> undirec =
     // clang-format off
     new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
@@ -138,23 +158,23 @@ static int StepFile_Read(const char*                                 theName,
     int   nbarg;
     char* ident;
     char* typrec = nullptr;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+    aFileDataModel->GetRecordDescription(&ident, &typrec, &nbarg);
     undirec->SetRecord(nr, ident, typrec, nbarg);
 
     if (nbarg > 0)
     {
       Interface_ParamType typa;
       char*               val;
-      while (aFileDataModel.GetArgDescription(&typa, &val) == 1)
+      while (aFileDataModel->GetArgDescription(&typa, &val) == 1)
       {
         undirec->AddStepParam(nr, val, typa);
       }
     }
     undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
+    aFileDataModel->NextRecord();
   }
 
-  aFileDataModel.ErrorHandle(undirec->GlobalCheck());
+  aFileDataModel->ErrorHandle(undirec->GlobalCheck());
   int anFailsCount = undirec->GlobalCheck()->NbFails();
   if (anFailsCount > 0)
   {
@@ -162,7 +182,7 @@ static int StepFile_Read(const char*                                 theName,
                         << " ****";
   }
 
-  aFileDataModel.ClearRecorder(1);
+  aFileDataModel->ClearRecorder(1);
 
   sout << "      ... Step File loaded  ...\n";
   sout << "   " << undirec->NbRecords() << " records (entities,sub-lists,scopes), " << nbpar
@@ -176,6 +196,7 @@ static int StepFile_Read(const char*                                 theName,
 
   StepData_StepReaderTool readtool(undirec, theProtocol);
   readtool.SetErrorHandle(true);
+  readtool.SetParallel(theStepModel->InternalParameters.ReadParallel);
 
   readtool.PrepareHeader(theRecogHeader); // Header. reco nul -> pour Protocol
   readtool.Prepare(theRecogData);         // Data.   reco nul -> pour Protocol
@@ -191,7 +212,7 @@ static int StepFile_Read(const char*                                 theName,
   {
     theStepModel->SetProtocol(theProtocol);
   }
-  aFileDataModel.ClearRecorder(2);
+  aFileDataModel->ClearRecorder(2);
   anFailsCount = undirec->GlobalCheck()->NbFails() - anFailsCount;
   if (anFailsCount > 0)
   {
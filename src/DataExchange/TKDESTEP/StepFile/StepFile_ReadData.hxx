@@ -103,6 +103,9 @@
 //! Reading of several STEP files simultaneously is possible (e.g. in multiple
 //! threads) provided that each file is read using its own instances of Flex, Bison
 //! and StepFile_ReadData tools.
+//!
+//! The same sequence of calls is performed by the hand-written StepFile_Scanner,
+//! which can be used instead of Flex and Bison.
 
 class Interface_Check;
 
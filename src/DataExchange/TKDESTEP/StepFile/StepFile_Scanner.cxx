@@ -0,0 +1,777 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepFile_Scanner.hxx>
+
+#include <StepFile_ReadData.hxx>
+
+#include <Interface_ParamType.hxx>
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+//! Initial capacity of the window over the stream.
+const size_t THE_WINDOW_SIZE = 1 << 20;
+
+//! Minimal amount of data available after the current position before scanning a token:
+//! tokens other than strings are expected to be shorter.
+const size_t THE_LOOKAHEAD_SIZE = 4096;
+
+//! Returns true for characters of entity type names and enumerations.
+inline bool isWordChar(const char theChar)
+{
+  return (theChar >= 'a' && theChar <= 'z') || (theChar >= 'A' && theChar <= 'Z')
+         || (theChar >= '0' && theChar <= '9') || theChar == '_';
+}
+
+//! Returns true for decimal digits.
+inline bool isDigit(const char theChar)
+{
+  return theChar >= '0' && theChar <= '9';
+}
+
+//! Returns true for hexadecimal digits.
+inline bool isHexDigit(const char theChar)
+{
+  return isDigit(theChar) || (theChar >= 'a' && theChar <= 'f')
+         || (theChar >= 'A' && theChar <= 'F');
+}
+
+//! Compares the text with the upper-case keyword, case-insensitively.
+inline bool isKeyword(const char* theText, const char* theEnd, const char* theKeyword)
+{
+  for (; *theKeyword != '\0'; ++theText, ++theKeyword)
+  {
+    if (theText == theEnd)
+    {
+      return false;
+    }
+    const char aChar = *theText;
+    if ((aChar >= 'a' && aChar <= 'z' ? char(aChar - 'a' + 'A') : aChar) != *theKeyword)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+//=================================================================================================
+
+StepFile_Scanner::StepFile_Scanner(StepFile_ReadData* theDataModel)
+    : myDataModel(theDataModel),
+      myStream(nullptr),
+      myBuffer(nullptr),
+      myCapacity(0),
+      myPos(nullptr),
+      myEnd(nullptr),
+      myIsEOF(true),
+      myLine(1),
+      myToken(TokenKind_End)
+{
+}
+
+//=================================================================================================
+
+StepFile_Scanner::~StepFile_Scanner()
+{
+  Standard::Free(myBuffer);
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::Init(std::istream& theStream)
+{
+  Standard::Free(myBuffer);
+  myStream   = &theStream;
+  myCapacity = THE_WINDOW_SIZE;
+  myBuffer   = static_cast<char*>(Standard::Allocate(myCapacity + 1));
+  myPos      = myBuffer;
+  myEnd      = myBuffer;
+  myIsEOF    = false;
+  myLine     = 1;
+  return refill();
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::refill()
+{
+  const size_t aNbPending = size_t(myEnd - myPos);
+  if (myPos != myBuffer)
+  {
+    memmove(myBuffer, myPos, aNbPending);
+  }
+  if (aNbPending > myCapacity / 2)
+  {
+    myCapacity *= 2;
+    myBuffer = static_cast<char*>(Standard::Reallocate(myBuffer, myCapacity + 1));
+  }
+
+  myStream->read(myBuffer + aNbPending, static_cast<std::streamsize>(myCapacity - aNbPending));
+  const size_t aNbRead = static_cast<size_t>(myStream->gcount());
+  myPos                = myBuffer;
+  myEnd                = myBuffer + aNbPending + aNbRead;
+  *myEnd               = '\0';
+  myIsEOF              = !myStream->good();
+  if (myStream->bad())
+  {
+    myError = "Error: cannot read the stream";
+    return false;
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void StepFile_Scanner::setText(char* theBegin, char* theEnd)
+{
+  const char aNext = *theEnd;
+  *theEnd          = '\0';
+  myDataModel->CreateNewText(theBegin, int(theEnd - theBegin));
+  *theEnd = aNext;
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::skipBlanks()
+{
+  for (;;)
+  {
+    if (myPos >= myEnd)
+    {
+      if (myIsEOF)
+      {
+        return true;
+      }
+      if (!refill())
+      {
+        return false;
+      }
+      continue;
+    }
+
+    const char aChar = *myPos;
+    if (aChar == '\n')
+    {
+      ++myLine;
+    }
+    else if (aChar == '/' && myPos + 1 == myEnd && !myIsEOF)
+    {
+      // the next character is not read yet
+      if (!refill())
+      {
+        return false;
+      }
+      continue;
+    }
+    else if (aChar == '/' && myPos[1] == '*')
+    {
+      for (myPos += 2;;)
+      {
+        if (myPos + 1 >= myEnd)
+        {
+          if (myIsEOF || !refill())
+          {
+            return false;
+          }
+          continue;
+        }
+        if (*myPos == '\n')
+        {
+          ++myLine;
+        }
+        else if (*myPos == '*' && myPos[1] == '/')
+        {
+          break;
+        }
+        ++myPos;
+      }
+      ++myPos;
+    }
+    else if (aChar != ' ' && aChar != '\t' && aChar != '\r' && aChar != '\0')
+    {
+      return true;
+    }
+    ++myPos;
+  }
+}
+
+//=================================================================================================
+
+StepFile_Scanner::TokenKind StepFile_Scanner::lex()
+{
+  if (!skipBlanks())
+  {
+    return TokenKind_Error;
+  }
+  if (!myIsEOF && size_t(myEnd - myPos) < THE_LOOKAHEAD_SIZE && !refill())
+  {
+    return TokenKind_Error;
+  }
+  if (myPos >= myEnd)
+  {
+    return TokenKind_End;
+  }
+
+  char*      aBegin = myPos;
+  const char aFirst = *aBegin;
+  switch (aFirst)
+  {
+    case '(':
+      ++myPos;
+      return TokenKind_Open;
+    case ')':
+      ++myPos;
+      return TokenKind_Close;
+    case ',':
+      ++myPos;
+      myDataModel->PrepareNewArg();
+      return TokenKind_Comma;
+    case '=':
+      ++myPos;
+      return TokenKind_Equal;
+    case ';':
+      ++myPos;
+      return TokenKind_Semicolon;
+    case '/':
+      ++myPos;
+      return TokenKind_Slash;
+    default:
+      break;
+  }
+
+  switch (aFirst)
+  {
+    case '#': {
+      char* aCur = aBegin + 1;
+      while (isDigit(*aCur))
+      {
+        ++aCur;
+      }
+      if (aCur == aBegin + 1)
+      {
+        break; // single character
+      }
+      char* aNext = aCur;
+      while (*aNext == ' ' || *aNext == '\t')
+      {
+        ++aNext;
+      }
+      if (aNext >= myEnd && !myIsEOF)
+      {
+        return TokenKind_Error; // too long token
+      }
+      const TokenKind aKind = *aNext == '=' ? TokenKind_Entity : TokenKind_Ident;
+      myPos                 = aCur;
+      setText(aBegin, aCur);
+      return aKind;
+    }
+    case '\'': {
+      // the string ends with the apostrophe followed by comma or closing parenthesis;
+      // it might be longer than the window, which is refilled then from its beginning
+      for (char* aCur = aBegin + 1;; ++aCur)
+      {
+        if (aCur >= myEnd)
+        {
+          if (myIsEOF)
+          {
+            return TokenKind_Error;
+          }
+          const size_t aNbScanned = size_t(aCur - aBegin);
+          if (!refill())
+          {
+            return TokenKind_Error;
+          }
+          aBegin = myPos;
+          aCur   = aBegin + aNbScanned - 1;
+          continue;
+        }
+        if (*aCur == '\n')
+        {
+          ++myLine;
+        }
+        else if (*aCur == '\'')
+        {
+          const char* aNext = aCur + 1;
+          while (*aNext == '"' || *aNext == ' ' || *aNext == '\n' || *aNext == '\r')
+          {
+            ++aNext;
+          }
+          if (aNext >= myEnd && !myIsEOF)
+          {
+            // the characters following the apostrophe are not read yet:
+            // refill the window and check this apostrophe again
+            const size_t aNbScanned = size_t(aCur - aBegin);
+            if (!refill())
+            {
+              return TokenKind_Error;
+            }
+            aBegin = myPos;
+            aCur   = aBegin + aNbScanned - 1;
+            continue;
+          }
+          if (*aNext == ')' || *aNext == ',')
+          {
+            myPos = aCur + 1;
+            setText(aBegin, myPos);
+            myDataModel->SetTypeArg(Interface_ParamText);
+            return TokenKind_Value;
+          }
+        }
+      }
+    }
+    default:
+      break;
+  }
+
+  // other tokens are recognized as flex does: the longest match,
+  // or the first rule in step.lex among matches of the same length
+  const char*         aCur   = aBegin + 1;
+  size_t              aLen   = 1;
+  TokenKind           aKind  = TokenKind_Value;
+  Interface_ParamType aType  = Interface_ParamMisc;
+  bool                toSkip = false;
+
+  // integer and real numbers
+  if (isDigit(aFirst) || aFirst == '-' || aFirst == '+' || aFirst == '.')
+  {
+    if (aFirst != '.')
+    {
+      while (isDigit(*aCur))
+      {
+        ++aCur;
+      }
+      aLen  = aCur - aBegin;
+      aType = Interface_ParamInteger;
+    }
+    const char* aReal = aBegin + 1;
+    while (isDigit(*aReal) || *aReal == '.')
+    {
+      ++aReal;
+    }
+    if (aReal - aBegin > 1)
+    {
+      const char* anExp = aReal;
+      if ((*anExp == 'E' || *anExp == 'e')
+          && (isDigit(anExp[1]) || anExp[1] == '-' || anExp[1] == '+'))
+      {
+        anExp += 2;
+        while (isDigit(*anExp))
+        {
+          ++anExp;
+        }
+        aReal = anExp;
+      }
+      if (size_t(aReal - aBegin) > aLen || aType != Interface_ParamInteger)
+      {
+        aLen  = aReal - aBegin;
+        aType = Interface_ParamReal;
+      }
+    }
+  }
+  // hexadecimal
+  else if (aFirst == '"')
+  {
+    const char* aHexa = aBegin + 1;
+    while (isHexDigit(*aHexa))
+    {
+      ++aHexa;
+    }
+    if (aHexa > aBegin + 1 && *aHexa == '"')
+    {
+      aLen  = aHexa + 1 - aBegin;
+      aType = Interface_ParamHexa;
+    }
+  }
+  else if (aFirst == '$')
+  {
+    aType = Interface_ParamVoid;
+  }
+
+  // enumeration
+  {
+    const char* anEnum = aBegin;
+    while (*anEnum == '.')
+    {
+      ++anEnum;
+    }
+    const char* aWord = anEnum;
+    while (isWordChar(*anEnum))
+    {
+      ++anEnum;
+    }
+    if (anEnum > aWord && *anEnum == '.' && size_t(anEnum + 1 - aBegin) > aLen)
+    {
+      aLen  = anEnum + 1 - aBegin;
+      aType = Interface_ParamEnum;
+    }
+  }
+
+  // keywords and entity types
+  const char* aWordEnd = aBegin + (aFirst == '!' || aFirst == '&' ? 1 : 0);
+  while (isWordChar(*aWordEnd))
+  {
+    ++aWordEnd;
+  }
+  const size_t aWordLen = aWordEnd - aBegin;
+  if (aFirst == '&')
+  {
+    if (aWordLen == 6 && isKeyword(aBegin + 1, aWordEnd, "SCOPE"))
+    {
+      aLen  = 6;
+      aKind = TokenKind_Scope;
+    }
+  }
+  else if (aFirst == '!')
+  {
+    if (aWordLen > 1)
+    {
+      aLen  = aWordLen;
+      aKind = TokenKind_Type;
+    }
+  }
+  else if (aWordLen > 0 && aWordLen + 1 > aLen && *aWordEnd == ';')
+  {
+    // keywords including the final semicolon are longer than any other match
+    static const struct
+    {
+      const char* Keyword;
+      TokenKind   Kind;
+    } THE_KEYWORDS[] = {{"STEP", TokenKind_Step},
+                        {"HEADER", TokenKind_Header},
+                        {"ENDSEC", TokenKind_EndSec},
+                        {"DATA", TokenKind_Data},
+                        {"ENDSTEP", TokenKind_EndStep}};
+    for (const auto& aKeyword : THE_KEYWORDS)
+    {
+      if (aWordLen == strlen(aKeyword.Keyword) && isKeyword(aBegin, aWordEnd, aKeyword.Keyword))
+      {
+        aLen  = aWordLen + 1;
+        aKind = aKeyword.Kind;
+        break;
+      }
+    }
+    if (aKind == TokenKind_EndStep)
+    {
+      // the rest of line is ignored
+      while (aBegin + aLen < myEnd && aBegin[aLen] != '\n')
+      {
+        ++aLen;
+      }
+    }
+  }
+  if (aKind == TokenKind_Value && aFirst != '!' && aFirst != '&')
+  {
+    // ISO-10303-21; and END-ISO-10303-21;
+    const bool  isEnd = isKeyword(aBegin, myEnd, "END-ISO");
+    const char* anIso = aBegin + (isEnd ? 7 : 3);
+    if (isEnd || isKeyword(aBegin, myEnd, "ISO"))
+    {
+      while (isDigit(*anIso) || *anIso == '-')
+      {
+        ++anIso;
+      }
+      if (*anIso == ';' && size_t(anIso + 1 - aBegin) > aLen)
+      {
+        aLen   = anIso + 1 - aBegin;
+        aKind  = isEnd ? TokenKind_EndStep : TokenKind_Step;
+        toSkip = isEnd;
+      }
+    }
+  }
+  if (aKind == TokenKind_Value && aFirst != '&' && aFirst != '!' && aWordLen > 0)
+  {
+    // ENDSCOPE and entity type take precedence over a single character only
+    if (aWordLen == 8 && aLen <= 8 && isKeyword(aBegin, aWordEnd, "ENDSCOPE"))
+    {
+      aLen  = 8;
+      aKind = TokenKind_EndScope;
+    }
+    else if (aWordLen > aLen || aType == Interface_ParamMisc)
+    {
+      aLen  = aWordLen;
+      aKind = TokenKind_Type;
+    }
+  }
+
+  if (toSkip)
+  {
+    // everything after the end of the data is ignored
+    myPos   = myEnd;
+    myIsEOF = true;
+    return aKind;
+  }
+  if (aBegin + aLen >= myEnd && !myIsEOF)
+  {
+    return TokenKind_Error; // too long token
+  }
+  myPos = aBegin + aLen;
+  if (aKind == TokenKind_Value || aKind == TokenKind_Type)
+  {
+    setText(aBegin, myPos);
+    if (aKind == TokenKind_Value)
+    {
+      myDataModel->SetTypeArg(aType);
+    }
+  }
+  return aKind;
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::expect(const TokenKind theKind)
+{
+  myToken = lex();
+  return myToken == theKind || syntaxError();
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::syntaxError()
+{
+  char aMessage[120];
+  Sprintf(aMessage, "Undefined Parsing: Line %d: Incorrect syntax", myLine);
+  myError = aMessage;
+  return false;
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::Perform()
+{
+  myError.Clear();
+  if (myStream == nullptr || !expect(TokenKind_Step) || !expect(TokenKind_Header))
+  {
+    return false;
+  }
+
+  // header entities
+  if (!parseHeader())
+  {
+    return false;
+  }
+
+  if (!expect(TokenKind_Data))
+  {
+    return false;
+  }
+  myDataModel->FinalOfHead();
+
+  // data entities, at least one
+  myToken = lex();
+  if (myToken != TokenKind_Entity)
+  {
+    return syntaxError();
+  }
+  if (!parseModel())
+  {
+    return false;
+  }
+  if (myToken != TokenKind_EndSec)
+  {
+    return syntaxError();
+  }
+  return expect(TokenKind_EndStep) && expect(TokenKind_End);
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseHeader()
+{
+  for (;;)
+  {
+    myToken = lex();
+    if (myToken == TokenKind_EndSec)
+    {
+      return true;
+    }
+    if (myToken != TokenKind_Type)
+    {
+      return syntaxError();
+    }
+    myDataModel->RecordType();
+    if (!expect(TokenKind_Open) || !parseList() || !expect(TokenKind_Semicolon))
+    {
+      return false;
+    }
+  }
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseModel()
+{
+  while (myToken == TokenKind_Entity)
+  {
+    if (!parseBloc())
+    {
+      return false;
+    }
+    myToken = lex();
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseBloc()
+{
+  myDataModel->RecordIdent();
+  if (!expect(TokenKind_Equal))
+  {
+    return false;
+  }
+
+  myToken = lex();
+  if (myToken == TokenKind_Scope)
+  {
+    myDataModel->AddNewScope();
+    myToken = lex();
+    if (myToken == TokenKind_Entity && !parseModel())
+    {
+      return false;
+    }
+    if (myToken != TokenKind_EndScope)
+    {
+      return syntaxError();
+    }
+
+    myToken = lex();
+    if (myToken == TokenKind_Slash)
+    {
+      // export list is taken as argument of the end of scope
+      myDataModel->RecordListStart();
+      do
+      {
+        if (!expect(TokenKind_Ident))
+        {
+          return false;
+        }
+        myDataModel->SetTypeArg(Interface_ParamIdent);
+        myDataModel->CreateNewArg();
+        myToken = lex();
+      } while (myToken == TokenKind_Comma);
+      if (myToken != TokenKind_Slash)
+      {
+        return syntaxError();
+      }
+      myDataModel->RecordNewEntity();
+      myToken = lex();
+    }
+    myDataModel->FinalOfScope();
+  }
+  return parseEntity();
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseEntity()
+{
+  if (myToken == TokenKind_Type)
+  {
+    myDataModel->RecordType();
+    return expect(TokenKind_Open) && parseList() && expect(TokenKind_Semicolon);
+  }
+  if (myToken != TokenKind_Open)
+  {
+    return syntaxError();
+  }
+
+  // complex entity: list of at least one type with its arguments
+  myToken = lex();
+  do
+  {
+    if (myToken != TokenKind_Type)
+    {
+      return syntaxError();
+    }
+    myDataModel->RecordType();
+    if (!expect(TokenKind_Open) || !parseList())
+    {
+      return false;
+    }
+    myToken = lex();
+  } while (myToken != TokenKind_Close);
+  return expect(TokenKind_Semicolon);
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseList()
+{
+  myDataModel->RecordListStart();
+  myToken = lex();
+  if (myToken != TokenKind_Close)
+  {
+    for (;;)
+    {
+      if (!parseArg(myToken))
+      {
+        return false;
+      }
+      myToken = lex();
+      if (myToken == TokenKind_Close)
+      {
+        break;
+      }
+      if (myToken != TokenKind_Comma)
+      {
+        return syntaxError();
+      }
+      myToken = lex();
+    }
+  }
+
+  if (myDataModel->GetModePrint() > 0)
+  {
+    printf("Record no : %d -- ", myDataModel->GetNbRecord() + 1);
+    myDataModel->PrintCurrentRecord();
+  }
+  myDataModel->RecordNewEntity();
+  return true;
+}
+
+//=================================================================================================
+
+bool StepFile_Scanner::parseArg(const TokenKind theToken)
+{
+  switch (theToken)
+  {
+    case TokenKind_Ident:
+      myDataModel->SetTypeArg(Interface_ParamIdent);
+      break;
+    case TokenKind_Value:
+      break;
+    case TokenKind_Open:
+      if (!parseList())
+      {
+        return false;
+      }
+      break;
+    case TokenKind_Type:
+      // typed parameter
+      myDataModel->RecordTypeText();
+      if (!expect(TokenKind_Open) || !parseList())
+      {
+        return false;
+      }
+      break;
+    default:
+      return syntaxError();
+  }
+  myDataModel->CreateNewArg();
+  return true;
+}
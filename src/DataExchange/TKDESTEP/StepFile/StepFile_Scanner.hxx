@@ -0,0 +1,141 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepFile_Scanner_HeaderFile
+#define _StepFile_Scanner_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <iostream>
+
+class StepFile_ReadData;
+
+//! Hand-written scanner and parser of STEP physical files (ISO 10303-21),
+//! alternative to the front end generated by flex and bison.
+//!
+//! The stream is read through a window of limited size, which slides along the file
+//! as it is parsed: only the pending tokens are kept when the window is refilled,
+//! so that memory used by the scanner does not depend on the size of the file.
+//! The window grows only to hold a single token (e.g. a long string) which is larger.
+//! Each token is terminated in place within the window while it is copied
+//! into the character pages of StepFile_ReadData, as the flex scanner does.
+//!
+//! StepFile_ReadData receives exactly the same sequence of calls as from
+//! the flex/bison front end, so that resulting records are identical.
+//! Contrary to bison, the scanner performs no error recovery: it stops
+//! on the first syntax error, so that the file can be read again by flex/bison.
+class StepFile_Scanner
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor.
+  //! @param theDataModel the data model to fill
+  StepFile_Scanner(StepFile_ReadData* theDataModel);
+
+  //! Destructor, releases the window.
+  ~StepFile_Scanner();
+
+  //! Attaches the stream and reads the first block of data from its current position.
+  //! The stream should be kept alive until the end of Perform().
+  //! @return FALSE if the stream cannot be read
+  bool Init(std::istream& theStream);
+
+  //! Parses the stream and fills the data model.
+  //! @return FALSE on the first syntax error or read failure, see Error()
+  bool Perform();
+
+  //! Returns the message describing the syntax error, empty if none.
+  const TCollection_AsciiString& Error() const { return myError; }
+
+private:
+  //! Kinds of tokens, named as in the bison grammar
+  enum TokenKind
+  {
+    TokenKind_End,       //!< end of the stream
+    TokenKind_Error,     //!< unexpected sequence of characters
+    TokenKind_Step,      //!< ISO-10303-21;
+    TokenKind_Header,    //!< HEADER;
+    TokenKind_EndSec,    //!< ENDSEC;
+    TokenKind_Data,      //!< DATA;
+    TokenKind_EndStep,   //!< END-ISO-10303-21;
+    TokenKind_Scope,     //!< &SCOPE
+    TokenKind_EndScope,  //!< ENDSCOPE
+    TokenKind_Entity,    //!< #123 followed by '='
+    TokenKind_Ident,     //!< #123 as a parameter
+    TokenKind_Type,      //!< entity type or keyword of typed parameter
+    TokenKind_Value,     //!< any other parameter (number, text, enumeration ...)
+    TokenKind_Open,      //!< (
+    TokenKind_Close,     //!< )
+    TokenKind_Comma,     //!< ,
+    TokenKind_Equal,     //!< =
+    TokenKind_Semicolon, //!< ;
+    TokenKind_Slash      //!< /
+  };
+
+  //! Moves the data not yet parsed (starting from the current position) to the beginning
+  //! of the window and reads the next block of the stream after it.
+  //! The window is enlarged when the pending data fills more than its half.
+  //! @return FALSE if the stream cannot be read
+  bool refill();
+
+  //! Passes the token [theBegin, theEnd) to the data model, which copies it.
+  void setText(char* theBegin, char* theEnd);
+
+  //! Skips spaces, line ends and comments, refilling the window when needed.
+  //! @return FALSE if a comment is not closed or the stream cannot be read
+  bool skipBlanks();
+
+  //! Scans the next token, sending text values to the data model as flex does.
+  TokenKind lex();
+
+  //! Scans the next token and checks its kind.
+  bool expect(const TokenKind theKind);
+
+  //! Parses the header section after HEADER keyword, up to ENDSEC.
+  bool parseHeader();
+
+  //! Parses the entities until the token which is not an entity label.
+  bool parseModel();
+
+  //! Parses one entity instance, after its label.
+  bool parseBloc();
+
+  //! Parses a simple or complex entity, up to the final ';'.
+  bool parseEntity();
+
+  //! Parses a list of parameters, after the opening parenthesis.
+  bool parseList();
+
+  //! Parses one parameter, starting with the already scanned token.
+  bool parseArg(const TokenKind theToken);
+
+  //! Records a syntax error at the current line.
+  bool syntaxError();
+
+private:
+  StepFile_ReadData*      myDataModel; //!< data model to fill
+  std::istream*           myStream;    //!< stream being parsed
+  char*                   myBuffer;    //!< window over the stream, terminated by zero
+  size_t                  myCapacity;  //!< capacity of the window
+  char*                   myPos;       //!< current position in the window
+  char*                   myEnd;       //!< end of data in the window
+  bool                    myIsEOF;     //!< flag indicating that the stream is read up to the end
+  int                     myLine;      //!< current line number
+  TokenKind               myToken;     //!< last scanned token (look-ahead)
+  TCollection_AsciiString myError;     //!< syntax error message
+};
+
+#endif // _StepFile_Scanner_HeaderFile
@@ -128,6 +128,11 @@ bool StepSelect_WorkLibrary::WriteFile(IFSelect_ContextWrite& ctx) const
   }
 
   //  Envoi
+  if (stepmodel->InternalParameters.WriteStreaming)
+  {
+    SW.SetStream(aStream.get());
+  }
+  SW.SetParallel(stepmodel->InternalParameters.WriteParallel);
   SW.SendModel(stepro);
   Interface_CheckIterator chl = SW.CheckList();
   for (chl.Start(); chl.More(); chl.Next())
@@ -257,8 +257,22 @@ void TopoDSToStep_MakeStepEdge::Init(const TopoDS_Edge&
       }
     }
 
-    GeomToStep_MakeCurve MkCurve(C, theLocalFactors);
-    Gpms = MkCurve.Value();
+    // In streaming write mode, equal curves are translated once and shared
+    const bool isShared =
+      occ::down_cast<StepData_StepModel>(FP->Model())->InternalParameters.WriteStreaming;
+    if (isShared)
+    {
+      Gpms = aTool.FindCurve(C);
+    }
+    if (Gpms.IsNull())
+    {
+      GeomToStep_MakeCurve MkCurve(C, theLocalFactors);
+      Gpms = MkCurve.Value();
+      if (isShared && !Gpms.IsNull())
+      {
+        aTool.BindCurve(C, Gpms);
+      }
+    }
   }
   else
   {
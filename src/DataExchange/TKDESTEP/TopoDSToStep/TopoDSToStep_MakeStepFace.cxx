@@ -186,8 +186,27 @@ void TopoDSToStep_MakeStepFace::Init(const TopoDS_Face&
     // Surfaces with indirect Axes are already reversed
     aTool.SetSurfaceReversed(false);
 
-    GeomToStep_MakeSurface        MkSurface(Su, theLocalFactors);
-    occ::handle<StepGeom_Surface> Spms = MkSurface.Value();
+    // In streaming write mode, equal surfaces are translated once and shared,
+    // except offset and degenerated toroidal ones which are recoded below for this face
+    const occ::handle<Geom_ToroidalSurface> aTorus = occ::down_cast<Geom_ToroidalSurface>(Su);
+    const bool isShared =
+      occ::down_cast<StepData_StepModel>(FP->Model())->InternalParameters.WriteStreaming
+      && !Su->IsKind(STANDARD_TYPE(Geom_OffsetSurface))
+      && (aTorus.IsNull() || aTorus->MajorRadius() >= aTorus->MinorRadius());
+    occ::handle<StepGeom_Surface> Spms;
+    if (isShared)
+    {
+      Spms = aTool.FindSurface(Su);
+    }
+    if (Spms.IsNull())
+    {
+      GeomToStep_MakeSurface MkSurface(Su, theLocalFactors);
+      Spms = MkSurface.Value();
+      if (isShared && !Spms.IsNull())
+      {
+        aTool.BindSurface(Su, Spms);
+      }
+    }
 
     //%pdn 30 Nov 98: TestRally 9 issue on r1001_ec.stp:
     // toruses with major_radius < minor are re-coded as degenerate
@@ -15,6 +15,7 @@
 // commercial license or contractual agreement.
 
 #include <BRep_Tool.hxx>
+#include <Geom_ElementarySurface.hxx>
 #include <StepData_StepModel.hxx>
 #include <StepShape_TopologicalRepresentationItem.hxx>
 #include <TopoDSToStep_Tool.hxx>
@@ -272,3 +273,58 @@ int TopoDSToStep_Tool::PCurveMode() const
 {
   return myPCurveMode;
 }
+
+//=================================================================================================
+
+occ::handle<StepGeom_Curve> TopoDSToStep_Tool::FindCurve(
+  const occ::handle<Geom_Curve>& theCurve) const
+{
+  const occ::handle<StepGeom_Curve>* aStepCurve = myCurves.Seek(theCurve);
+  return aStepCurve != nullptr ? *aStepCurve : occ::handle<StepGeom_Curve>();
+}
+
+//=================================================================================================
+
+void TopoDSToStep_Tool::BindCurve(const occ::handle<Geom_Curve>&     theCurve,
+                                  const occ::handle<StepGeom_Curve>& theStepCurve)
+{
+  myCurves.Bind(theCurve, theStepCurve);
+}
+
+//=================================================================================================
+
+occ::handle<StepGeom_Surface> TopoDSToStep_Tool::FindSurface(
+  const occ::handle<Geom_Surface>& theSurface) const
+{
+  const occ::handle<StepGeom_Surface>* aStepSurface = mySurfaces.Seek(theSurface);
+  return aStepSurface != nullptr ? *aStepSurface : occ::handle<StepGeom_Surface>();
+}
+
+//=================================================================================================
+
+void TopoDSToStep_Tool::BindSurface(const occ::handle<Geom_Surface>&     theSurface,
+                                    const occ::handle<StepGeom_Surface>& theStepSurface)
+{
+  mySurfaces.Bind(theSurface, theStepSurface);
+}
+
+//=================================================================================================
+
+bool TopoDSToStep_Tool::SurfaceHasher::operator()(
+  const occ::handle<Geom_Surface>& theSurface1,
+  const occ::handle<Geom_Surface>& theSurface2) const noexcept
+{
+  if (!GeomHash_SurfaceHasher::operator()(theSurface1, theSurface2))
+  {
+    return false;
+  }
+  const occ::handle<Geom_ElementarySurface> anElem1 =
+    occ::down_cast<Geom_ElementarySurface>(theSurface1);
+  const occ::handle<Geom_ElementarySurface> anElem2 =
+    occ::down_cast<Geom_ElementarySurface>(theSurface2);
+  if (anElem1.IsNull() || anElem2.IsNull())
+  {
+    return anElem1.IsNull() && anElem2.IsNull();
+  }
+  return anElem1->Position().Direct() == anElem2->Position().Direct();
+}
@@ -31,6 +31,12 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Standard_Integer.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <GeomHash_CurveHasher.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
+#include <StepGeom_Curve.hxx>
+#include <StepGeom_Surface.hxx>
 class StepData_StepModel;
 class TopoDS_Shape;
 class StepShape_TopologicalRepresentationItem;
@@ -100,7 +106,38 @@ public:
   //! (initialized by parameter write.surfacecurve.mode)
   Standard_EXPORT int PCurveMode() const;
 
+  //! Returns the STEP curve already translated from a curve equal to the given one
+  //! (within tolerances of GeomHash_CurveHasher), or a null handle.
+  //! Used to share geometry in streaming write mode (parameter write.streaming).
+  Standard_EXPORT occ::handle<StepGeom_Curve> FindCurve(
+    const occ::handle<Geom_Curve>& theCurve) const;
+
+  //! Records the STEP curve translated from the given curve.
+  //! The curve should not be modified afterwards.
+  Standard_EXPORT void BindCurve(const occ::handle<Geom_Curve>&     theCurve,
+                                 const occ::handle<StepGeom_Curve>& theStepCurve);
+
+  //! Returns the STEP surface already translated from a surface equal to the given one
+  //! (within tolerances of GeomHash_SurfaceHasher, and with the same handedness), or a null handle.
+  Standard_EXPORT occ::handle<StepGeom_Surface> FindSurface(
+    const occ::handle<Geom_Surface>& theSurface) const;
+
+  //! Records the STEP surface translated from the given surface.
+  //! The surface should not be modified afterwards.
+  Standard_EXPORT void BindSurface(const occ::handle<Geom_Surface>&     theSurface,
+                                   const occ::handle<StepGeom_Surface>& theStepSurface);
+
 private:
+  //! Surface hasher distinguishing also elementary surfaces with opposite
+  //! handedness of the position, which are written with opposite normals.
+  struct SurfaceHasher : public GeomHash_SurfaceHasher
+  {
+    using GeomHash_SurfaceHasher::operator();
+
+    Standard_EXPORT bool operator()(const occ::handle<Geom_Surface>& theSurface1,
+                                    const occ::handle<Geom_Surface>& theSurface2) const noexcept;
+  };
+
   NCollection_DataMap<TopoDS_Shape, occ::handle<Standard_Transient>, TopTools_ShapeMapHasher>
                 myDataMap;
   bool          myFacetedContext;
@@ -112,6 +149,10 @@ private:
   TopoDS_Vertex myCurrentVertex;
   bool          myReversedSurface;
   int           myPCurveMode;
+  NCollection_DataMap<occ::handle<Geom_Curve>, occ::handle<StepGeom_Curve>, GeomHash_CurveHasher>
+    myCurves;
+  NCollection_DataMap<occ::handle<Geom_Surface>, occ::handle<StepGeom_Surface>, SurfaceHasher>
+    mySurfaces;
 };
 
 #endif // _TopoDSToStep_Tool_HeaderFile
@@ -55,6 +55,8 @@ bool DESTL_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>& t
     theResource->RealVal("read.merge.angle", InternalParameters.ReadMergeAngle, aScope);
   InternalParameters.ReadBRep =
     theResource->BooleanVal("read.brep", InternalParameters.ReadBRep, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
   InternalParameters.WriteAscii =
     theResource->BooleanVal("write.ascii", InternalParameters.WriteAscii, aScope);
   return true;
@@ -87,6 +89,12 @@ TCollection_AsciiString DESTL_ConfigurationNode::Save() const
   aResult += aScope + "read.brep :\t " + InternalParameters.ReadBRep + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to use multithreading for reading Ascii file\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
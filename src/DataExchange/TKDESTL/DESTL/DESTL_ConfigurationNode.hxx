@@ -91,6 +91,7 @@ public:
     // Read
     double ReadMergeAngle = 90.;   //!< Input merge angle value
     bool   ReadBRep       = false; //!< Setting up Boundary Representation flag
+    bool   ReadParallel   = false; //!< Flag to use multithreading for reading Ascii file
 
     // Write
     bool WriteAscii = true; //!< Setting up writing mode (Ascii or Binary)
@@ -196,7 +196,10 @@ bool DESTL_Provider::Read(const TCollection_AsciiString& thePath,
   if (!aNode->InternalParameters.ReadBRep)
   {
     occ::handle<Poly_Triangulation> aTriangulation =
-      RWStl::ReadFile(thePath.ToCString(), aMergeAngle, theProgress);
+      RWStl::ReadFile(thePath.ToCString(),
+                      aMergeAngle,
+                      aNode->InternalParameters.ReadParallel,
+                      theProgress);
 
     TopoDS_Face  aFace;
     BRep_Builder aB;
@@ -0,0 +1,153 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_DynamicArray.hxx>
+#include <NCollection_Vec3.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWStl.hxx>
+#include <RWStl_Reader.hxx>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Reader collecting nodes, triangles and solids.
+class TestStlReader : public RWStl_Reader
+{
+public:
+  int AddNode(const gp_XYZ& thePnt) override
+  {
+    myNodes.Append(thePnt);
+    return myNodes.Length();
+  }
+
+  void AddTriangle(int theN1, int theN2, int theN3) override
+  {
+    myTriangles.Append(NCollection_Vec3<int>(theN1, theN2, theN3));
+  }
+
+  void AddSolid() override { mySolids.Append(myTriangles.Length()); }
+
+  //! Checks that the same data have been read as by another reader.
+  void CheckSame(const TestStlReader& theOther) const
+  {
+    ASSERT_EQ(myNodes.Length(), theOther.myNodes.Length());
+    ASSERT_EQ(myTriangles.Length(), theOther.myTriangles.Length());
+    ASSERT_EQ(mySolids.Length(), theOther.mySolids.Length());
+    for (int aNodeIter = 0; aNodeIter < myNodes.Length(); ++aNodeIter)
+    {
+      EXPECT_EQ(0.0, (myNodes.Value(aNodeIter) - theOther.myNodes.Value(aNodeIter)).SquareModulus())
+        << "Node " << aNodeIter;
+    }
+    for (int aTriIter = 0; aTriIter < myTriangles.Length(); ++aTriIter)
+    {
+      EXPECT_TRUE(myTriangles.Value(aTriIter) == theOther.myTriangles.Value(aTriIter))
+        << "Triangle " << aTriIter;
+    }
+    for (int aSolidIter = 0; aSolidIter < mySolids.Length(); ++aSolidIter)
+    {
+      EXPECT_EQ(mySolids.Value(aSolidIter), theOther.mySolids.Value(aSolidIter));
+    }
+  }
+
+  NCollection_DynamicArray<gp_XYZ>                myNodes;
+  NCollection_DynamicArray<NCollection_Vec3<int>> myTriangles;
+  NCollection_DynamicArray<int>                   mySolids;
+};
+
+//! Returns Ascii STL solid of a regular grid of theNbCells x theNbCells squares.
+std::string makeAsciiSolid(const char* theName, const int theNbCells, const double theZ)
+{
+  std::ostringstream aStream;
+  aStream.precision(12);
+  aStream << "solid " << theName << "\n";
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const double aX[4] = {aCol * 0.1, (aCol + 1) * 0.1, (aCol + 1) * 0.1, aCol * 0.1};
+      const double aY[4] = {aRow * 0.1, aRow * 0.1, (aRow + 1) * 0.1, (aRow + 1) * 0.1};
+      for (int aTri = 0; aTri < 2; ++aTri)
+      {
+        const int aNodes[3] = {0, aTri == 0 ? 1 : 2, aTri == 0 ? 2 : 3};
+        aStream << "  facet normal 0 0 1\n    outer loop\n";
+        for (int aNode = 0; aNode < 3; ++aNode)
+        {
+          aStream << "      vertex " << aX[aNodes[aNode]] << " " << aY[aNodes[aNode]] << " "
+                  << theZ << "\n";
+        }
+        aStream << "    endloop\n  endfacet\n";
+      }
+    }
+  }
+  aStream << "endsolid " << theName << "\n";
+  return aStream.str();
+}
+
+//! Writes the text into temporary file.
+std::filesystem::path writeFile(const std::string& theContent, const char* theName)
+{
+  const std::filesystem::path aFile = std::filesystem::temp_directory_path() / theName;
+  std::ofstream               aStream(aFile, std::ios::binary);
+  aStream << theContent;
+  return aFile;
+}
+} // namespace
+
+// Parallel parsing of multi-domain Ascii file should give the same data as sequential one
+TEST(RWStl_ReaderTest, ParallelAsciiMatchesSequential)
+{
+  const std::string aContent =
+    makeAsciiSolid("first", 70, 0.0) + "\n" + makeAsciiSolid("second", 50, 1.0);
+  const std::filesystem::path aFile = writeFile(aContent, "occt_rwstl_reader_test.stl");
+
+  TestStlReader aSeqReader, aParReader;
+  aSeqReader.Read(aFile.string().c_str(), Message_ProgressRange());
+  aParReader.SetParallel(true);
+  EXPECT_TRUE(aParReader.Read(aFile.string().c_str(), Message_ProgressRange()));
+  EXPECT_EQ(aSeqReader.mySolids.Length(), 2);
+  EXPECT_EQ(aSeqReader.myTriangles.Length(), 2 * 70 * 70 + 2 * 50 * 50);
+  aSeqReader.CheckSame(aParReader);
+
+  const occ::handle<Poly_Triangulation> aSeqMesh =
+    RWStl::ReadFile(aFile.string().c_str(), M_PI / 2.0, false);
+  const occ::handle<Poly_Triangulation> aParMesh =
+    RWStl::ReadFile(aFile.string().c_str(), M_PI / 2.0, true);
+  std::filesystem::remove(aFile);
+  ASSERT_FALSE(aSeqMesh.IsNull());
+  ASSERT_FALSE(aParMesh.IsNull());
+  EXPECT_EQ(aSeqMesh->NbNodes(), aParMesh->NbNodes());
+  EXPECT_EQ(aSeqMesh->NbTriangles(), aParMesh->NbTriangles());
+}
+
+// Parallel parsing should stop at invalid vertex after the same facets as sequential one
+TEST(RWStl_ReaderTest, ParallelAsciiStopsAtError)
+{
+  std::string  aContent = makeAsciiSolid("first", 40, 0.0) + makeAsciiSolid("second", 40, 1.0);
+  const size_t aPos     = aContent.rfind("vertex", aContent.size() / 4 * 3);
+  ASSERT_NE(aPos, std::string::npos);
+  aContent.replace(aPos, aContent.find('\n', aPos) - aPos, "vertex 1 2");
+  const std::filesystem::path aFile = writeFile(aContent, "occt_rwstl_reader_error_test.stl");
+
+  TestStlReader aSeqReader, aParReader;
+  aSeqReader.Read(aFile.string().c_str(), Message_ProgressRange());
+  aParReader.SetParallel(true);
+  EXPECT_FALSE(aParReader.Read(aFile.string().c_str(), Message_ProgressRange()));
+  std::filesystem::remove(aFile);
+  EXPECT_EQ(aSeqReader.mySolids.Length(), 1);
+  EXPECT_GT(aSeqReader.myTriangles.Length(), 2 * 40 * 40);
+  aSeqReader.CheckSame(aParReader);
+}
@@ -149,9 +149,20 @@ private:
 occ::handle<Poly_Triangulation> RWStl::ReadFile(const char* const            theFile,
                                                 const double                 theMergeAngle,
                                                 const Message_ProgressRange& theProgress)
+{
+  return ReadFile(theFile, theMergeAngle, false, theProgress);
+}
+
+//=================================================================================================
+
+occ::handle<Poly_Triangulation> RWStl::ReadFile(const char* const            theFile,
+                                                const double                 theMergeAngle,
+                                                const bool                   theToParallel,
+                                                const Message_ProgressRange& theProgress)
 {
   Reader aReader;
   aReader.SetMergeAngle(theMergeAngle);
+  aReader.SetParallel(theToParallel);
   aReader.Read(theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
   // but some data have been read, we at least will return these data
@@ -80,6 +80,19 @@ public:
     const double                 theMergeAngle,
     const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+  //! Read specified STL file and returns its content as triangulation.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes;
+  //! M_PI/2 means ignore angle
+  //! @param[in] theToParallel flag to parse Ascii file in parallel threads
+  //! @param[in] theProgress progress indicator
+  //! @return result triangulation or NULL in case of error
+  Standard_EXPORT static occ::handle<Poly_Triangulation> ReadFile(
+    const char* const            theFile,
+    const double                 theMergeAngle,
+    const bool                   theToParallel,
+    const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   //! Read specified STL file and fills triangulation list for multi-domain case.
   //! @param[in] theFile file path to read
   //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes;
@@ -18,15 +18,19 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
@@ -41,6 +45,12 @@ static const size_t THE_STL_MIN_FILE_SIZE = THE_STL_HEADER_SIZE + THE_STL_SIZEOF
 // The length of buffer to read (in bytes)
 static const size_t THE_BUFFER_SIZE = 1024;
 
+// The length of block of Ascii data parsed at once in parallel mode (in bytes)
+static const size_t THE_ASCII_BLOCK_SIZE = 64 * 1024 * 1024;
+
+// The approximate length of chunk of Ascii data parsed by one thread (in bytes)
+static const size_t THE_ASCII_CHUNK_SIZE = 1024 * 1024;
+
 //! Auxiliary tool for merging nodes during STL reading.
 class MergeNodeTool : public Poly_MergeNodesTool
 {
@@ -121,7 +131,8 @@ inline static gp_XYZ readStlFloatVec3(const char* theData)
 
 RWStl_Reader::RWStl_Reader()
     : myMergeAngle(M_PI / 2.0),
-      myMergeTolearance(0.0)
+      myMergeTolearance(0.0),
+      myToParallel(false)
 {
 }
 
@@ -148,6 +159,11 @@ bool RWStl_Reader::Read(const char* theFile, const Message_ProgressRange& thePro
   // (probing may bring stream to fail state if EOF is reached)
   bool isAscii = ((size_t)theEnd < THE_STL_MIN_FILE_SIZE || IsAscii(*aStream, true));
 
+  if (isAscii && myToParallel)
+  {
+    return readAsciiParallel(*aStream, theEnd, theProgress);
+  }
+
   Standard_ReadLineBuffer aBuffer(THE_BUFFER_SIZE);
 
   // Note: here we are trying to handle rare but realistic case of
@@ -398,6 +414,338 @@ bool RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
   return aPS.More();
 }
 
+namespace
+{
+//! Returns true if the line starts a facet or ends a solid, so that Ascii data can be split before.
+static bool isAsciiSplitLine(const char* theLine)
+{
+  return str_starts_with(theLine, "facet", 5) || str_starts_with(theLine, "endsolid", 8);
+}
+
+//! Returns the position of the first line starting after theFrom, which can split Ascii data,
+//! or theEnd if there is no such line.
+static size_t findAsciiSplitLine(const char* theData, const size_t theFrom, const size_t theEnd)
+{
+  for (size_t aPos = theFrom; aPos < theEnd;)
+  {
+    const char* aLineEnd = (const char*)::memchr(theData + aPos, '\n', theEnd - aPos);
+    if (aLineEnd == nullptr)
+    {
+      break;
+    }
+    aPos = size_t(aLineEnd - theData) + 1;
+    if (aPos < theEnd && isAsciiSplitLine(theData + aPos))
+    {
+      return aPos;
+    }
+  }
+  return theEnd;
+}
+
+//! Returns the position of the last line which can split zero-terminated Ascii data,
+//! or 0 if there is no such line.
+static size_t findLastAsciiSplitLine(const char* theData, const size_t theEnd)
+{
+  for (size_t aPos = theEnd - 1; aPos > 0; --aPos)
+  {
+    if (theData[aPos - 1] == '\n' && isAsciiSplitLine(theData + aPos))
+    {
+      return aPos;
+    }
+  }
+  return 0;
+}
+
+//! Chunk of Ascii STL data parsed by one thread.
+struct AsciiChunk
+{
+  char*                            Begin;         //!< first character of the chunk
+  char*                            End;           //!< end of the chunk
+  NCollection_DynamicArray<gp_XYZ> Vertices;      //!< vertices of parsed facets, three per facet
+  NCollection_DynamicArray<int>    SolidEnds;     //!< number of vertices before each "endsolid"
+  int                              NbLines;       //!< number of lines in the chunk
+  int                              ErrorLine;     //!< index of the line with syntax error, or -1
+  bool                             IsVertexError; //!< flag indicating invalid vertex coordinates
+  bool                             IsTruncated;   //!< flag indicating data ending within a facet
+  bool                             IsHeader;      //!< flag indicating expected header "solid ..."
+
+  AsciiChunk()
+      : Begin(nullptr),
+        End(nullptr),
+        Vertices(4096),
+        SolidEnds(16),
+        NbLines(0),
+        ErrorLine(-1),
+        IsVertexError(false),
+        IsTruncated(false),
+        IsHeader(false)
+  {
+  }
+
+  //! Returns the next line terminated in place by zero, or NULL at the end of the chunk.
+  char* NextLine(char*& thePos)
+  {
+    if (thePos >= End)
+    {
+      return nullptr;
+    }
+
+    char* aLine    = thePos;
+    char* aLineEnd = (char*)::memchr(thePos, '\n', End - thePos);
+    if (aLineEnd == nullptr)
+    {
+      // the last line of the stream, followed by terminating zero
+      aLineEnd = End;
+    }
+    thePos = aLineEnd + 1;
+    if (aLineEnd > aLine && aLineEnd[-1] == '\r')
+    {
+      aLineEnd[-1] = '\0';
+    }
+    *aLineEnd = '\0';
+    ++NbLines;
+    return aLine;
+  }
+
+  //! Parses the facets of the chunk, stopping at the first syntax error.
+  void Perform()
+  {
+    char* aPos = Begin;
+    for (;;)
+    {
+      const int   aLineIndex = NbLines;
+      const char* aLine      = NextLine(aPos);
+      if (aLine == nullptr)
+      {
+        return;
+      }
+      if (IsHeader)
+      {
+        // skip header "solid ..." after blank lines
+        while (isspace((unsigned char)*aLine))
+        {
+          ++aLine;
+        }
+        IsHeader = *aLine == '\0';
+        continue;
+      }
+      if (str_starts_with(aLine, "endsolid", 8))
+      {
+        SolidEnds.Append(Vertices.Length());
+        IsHeader = true;
+        continue;
+      }
+      if (!str_starts_with(aLine, "facet", 5))
+      {
+        ErrorLine = aLineIndex;
+        return;
+      }
+
+      aLine = NextLine(aPos); // "outer loop"
+      if (aLine == nullptr || !str_starts_with(aLine, "outer", 5))
+      {
+        ErrorLine = aLineIndex;
+        return;
+      }
+
+      gp_XYZ aVertex[3];
+      for (int i = 0; i < 3; i++)
+      {
+        aLine = NextLine(aPos);
+        if (aLine == nullptr)
+        {
+          IsTruncated = true;
+          return;
+        }
+        if (!ReadVertex(aLine,
+                        aVertex[i].ChangeCoord(1),
+                        aVertex[i].ChangeCoord(2),
+                        aVertex[i].ChangeCoord(3)))
+        {
+          ErrorLine     = NbLines - 1;
+          IsVertexError = true;
+          return;
+        }
+      }
+      Vertices.Append(aVertex[0]);
+      Vertices.Append(aVertex[1]);
+      Vertices.Append(aVertex[2]);
+
+      NextLine(aPos); // skip "endloop"
+      NextLine(aPos); // skip "endfacet"
+    }
+  }
+};
+} // namespace
+
+//=================================================================================================
+
+bool RWStl_Reader::readAsciiParallel(Standard_IStream&            theStream,
+                                     const std::streampos         theUntilPos,
+                                     const Message_ProgressRange& theProgress)
+{
+  const int64_t aStartPos = GETPOS(theStream.tellg());
+
+  // report progress every 1 MiB of read data
+  const int             aStepB   = 1024 * 1024;
+  const int             aNbSteps = 1 + int((GETPOS(theUntilPos) - aStartPos) / aStepB);
+  Message_ProgressScope aPS(theProgress, "Reading text STL file", aNbSteps);
+  int64_t               aProgressPos = aStartPos + aStepB;
+
+  occ::handle<MergeNodeTool> aMergeTool = new MergeNodeTool(this);
+  aMergeTool->SetMergeAngle(myMergeAngle);
+  aMergeTool->SetMergeTolerance(myMergeTolearance);
+
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+
+  // the block is read after the tail of previous one, starting with incomplete facet;
+  // one more character is reserved for terminating zero
+  const int64_t            aNbTotal = GETPOS(theUntilPos) - aStartPos;
+  NCollection_Array1<char> aBlock(0,
+                                  aNbTotal > 0 && aNbTotal < int64_t(THE_ASCII_BLOCK_SIZE)
+                                    ? int(aNbTotal) + 1
+                                    : int(THE_ASCII_BLOCK_SIZE));
+  size_t                   aNbData   = 0;
+  int64_t                  aNbRead   = aStartPos;
+  int                      aNbLines  = 0;
+  int                      aNbSolids = 0;
+  bool                     isHeader  = true;
+  bool                     isEOF     = false;
+  while (!isEOF)
+  {
+    const size_t aNbToRead = size_t(aBlock.Size()) - 1 - aNbData;
+    const size_t aNbBytes =
+      (size_t)theStream.read(&aBlock.ChangeFirst() + aNbData, std::streamsize(aNbToRead)).gcount();
+    if (theStream.bad())
+    {
+      Message::SendFail("Error: Cannot read file");
+      return false;
+    }
+    isEOF = aNbBytes < aNbToRead;
+    aNbData += aNbBytes;
+    aNbRead += aNbBytes;
+
+    char* aData     = &aBlock.ChangeFirst();
+    aData[aNbData]  = '\0';
+    size_t aDataEnd = aNbData;
+    if (!isEOF)
+    {
+      // keep the last facet, which might be incomplete, for the next block
+      aDataEnd = findLastAsciiSplitLine(aData, aNbData);
+      if (aDataEnd == 0)
+      {
+        if (aBlock.Size() > std::numeric_limits<int>::max() / 2)
+        {
+          Message::SendFail(TCollection_AsciiString("Error: unexpected format of facet at line ")
+                            + (aNbLines + 1));
+          return false;
+        }
+        aBlock.Resize(0, aBlock.Upper() * 2, true);
+        continue;
+      }
+    }
+
+    // split the block at facet boundaries
+    NCollection_DynamicArray<size_t> aSplits;
+    aSplits.Append(0);
+    for (;;)
+    {
+      const size_t aSplit =
+        findAsciiSplitLine(aData, aSplits.Last() + THE_ASCII_CHUNK_SIZE, aDataEnd);
+      if (aSplit >= aDataEnd)
+      {
+        break;
+      }
+      aSplits.Append(aSplit);
+    }
+
+    const int                      aNbChunks = aSplits.Length();
+    NCollection_Array1<AsciiChunk> aChunks(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      AsciiChunk& aChunk = aChunks.ChangeValue(aChunkIter);
+      aChunk.Begin       = aData + aSplits.Value(aChunkIter);
+      aChunk.End =
+        aData + (aChunkIter + 1 < aNbChunks ? aSplits.Value(aChunkIter + 1) : aDataEnd);
+    }
+    aChunks.ChangeFirst().IsHeader = isHeader;
+
+    const int aNbThreads = std::min(aNbChunks, aThreadPool->NbDefaultThreadsToLaunch());
+
+    OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+    aLauncher.Perform(0, aNbChunks, [&aChunks](int, int theIndex) {
+      aChunks.ChangeValue(theIndex).Perform();
+    });
+
+    // merge nodes in the order of the file
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      const AsciiChunk& aChunk    = aChunks.Value(aChunkIter);
+      int               aVertIter = 0;
+      for (int aSolidIter = 0; aSolidIter <= aChunk.SolidEnds.Length(); ++aSolidIter)
+      {
+        const bool isSolidEnd = aSolidIter < aChunk.SolidEnds.Length();
+        const int  aVertEnd =
+          isSolidEnd ? aChunk.SolidEnds.Value(aSolidIter) : aChunk.Vertices.Length();
+        for (; aVertIter < aVertEnd; aVertIter += 3)
+        {
+          const gp_XYZ aVertex[3] = {aChunk.Vertices.Value(aVertIter),
+                                     aChunk.Vertices.Value(aVertIter + 1),
+                                     aChunk.Vertices.Value(aVertIter + 2)};
+          aMergeTool->AddTriangle(aVertex);
+        }
+        if (isSolidEnd)
+        {
+          ++aNbSolids;
+          AddSolid();
+          aMergeTool = new MergeNodeTool(this);
+          aMergeTool->SetMergeAngle(myMergeAngle);
+          aMergeTool->SetMergeTolerance(myMergeTolearance);
+        }
+      }
+
+      if (aChunk.ErrorLine >= 0)
+      {
+        const char* anError = aChunk.IsVertexError
+                                ? "Error: cannot read vertex coordinates at line "
+                                : "Error: unexpected format of facet at line ";
+        Message::SendFail(TCollection_AsciiString(anError) + (aNbLines + aChunk.ErrorLine + 1));
+        return false;
+      }
+      if (aChunk.IsTruncated)
+      {
+        // stop reading if end of file is reached;
+        // note that well-formatted file never ends by the vertex line
+        AddSolid();
+        return true;
+      }
+      aNbLines += aChunk.NbLines;
+    }
+    isHeader = aChunks.Last().IsHeader;
+
+    for (const int64_t aPos = aNbRead - int64_t(aNbData - aDataEnd); aProgressPos < aPos;
+         aProgressPos += aStepB)
+    {
+      aPS.Next();
+    }
+    if (!aPS.More())
+    {
+      return false;
+    }
+
+    // move the tail to the beginning of the block
+    std::memmove(aData, aData + aDataEnd, aNbData - aDataEnd);
+    aNbData -= aDataEnd;
+  }
+
+  if (!isHeader || aNbSolids == 0)
+  {
+    Message::SendFail("Error: premature end of file");
+    return false;
+  }
+  return true;
+}
+
 //=================================================================================================
 
 bool RWStl_Reader::ReadBinary(Standard_IStream& theStream, const Message_ProgressRange& theProgress)
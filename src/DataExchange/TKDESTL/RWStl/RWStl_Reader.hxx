@@ -106,9 +106,27 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance(double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return flag to use multithreading for reading Ascii STL file by Read(); FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set flag to use multithreading for reading Ascii STL file by Read().
+  //! The text is then read by large blocks split at facet boundaries into chunks,
+  //! which are parsed by parallel threads; the nodes are still merged sequentially
+  //! in the order of the file, so that the result is the same as in single-threaded mode.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+private:
+  //! Reads Ascii STL data from the stream positioned at the header of the first solid
+  //! up to the end of the stream, parsing the facets in parallel threads.
+  //! Returns true if success, false on error or user break.
+  bool readAsciiParallel(Standard_IStream&            theStream,
+                         const std::streampos         theUntilPos,
+                         const Message_ProgressRange& theProgress);
+
 protected:
   double myMergeAngle;
   double myMergeTolearance;
+  bool   myToParallel;
 };
 
 #endif
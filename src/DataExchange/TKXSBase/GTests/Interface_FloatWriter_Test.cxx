@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_FloatWriter.hxx>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Checks that Write() gives the same text as Convert() with the formats of the writer.
+void checkSameText(const Interface_FloatWriter& theWriter, const double theValue)
+{
+  bool   isZeroSup = false, isRange = false;
+  double aR1 = 0.0, aR2 = 0.0;
+  theWriter.Options(isZeroSup, isRange, aR1, aR2);
+
+  char aText[32]    = {};
+  char aRefText[32] = {};
+
+  const int aLength    = theWriter.Write(theValue, aText);
+  const int aRefLength = Interface_FloatWriter::Convert(theValue,
+                                                        aRefText,
+                                                        isZeroSup,
+                                                        aR1,
+                                                        aR2,
+                                                        theWriter.MainFormat(),
+                                                        theWriter.FormatForRange());
+  EXPECT_EQ(aLength, aRefLength) << "Value " << theValue;
+  EXPECT_STREQ(aText, aRefText) << "Value " << theValue;
+}
+} // namespace
+
+// Default options give values without trailing zeros and null exponent
+TEST(Interface_FloatWriterTest, DefaultOptions)
+{
+  Interface_FloatWriter aWriter(12);
+  char                  aText[32] = {};
+  aWriter.Write(0.0, aText);
+  EXPECT_STREQ(aText, "0.");
+  aWriter.Write(-1.0, aText);
+  EXPECT_STREQ(aText, "-1.");
+  aWriter.Write(0.5, aText);
+  EXPECT_STREQ(aText, "0.5");
+  aWriter.Write(100.0, aText);
+  EXPECT_STREQ(aText, "100.");
+  aWriter.Write(1.0e-7, aText);
+  EXPECT_STREQ(aText, "1.E-07");
+  aWriter.Write(-2500.0, aText);
+  EXPECT_STREQ(aText, "-2.5E+03");
+  aWriter.Write(1.0 / 3.0, aText);
+  EXPECT_STREQ(aText, "0.333333333333");
+}
+
+// Write() should give the same text as formatting by Convert()
+TEST(Interface_FloatWriterTest, WriteMatchesConvert)
+{
+  const double aSpecialValues[] = {0.0,
+                                   -0.0,
+                                   0.1,
+                                   -0.1,
+                                   1000.0,
+                                   -1000.0,
+                                   999.9999999999999,
+                                   0.09999999999999999,
+                                   123.456789012345,
+                                   -123.456789012345,
+                                   -12.3456789012345,
+                                   1.0e100,
+                                   -1.0e-300,
+                                   std::numeric_limits<double>::denorm_min(),
+                                   std::numeric_limits<double>::max(),
+                                   std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::quiet_NaN()};
+
+  Interface_FloatWriter aWriters[2] = {Interface_FloatWriter(12), Interface_FloatWriter(6)};
+  for (const Interface_FloatWriter& aWriter : aWriters)
+  {
+    for (const double aValue : aSpecialValues)
+    {
+      checkSameText(aWriter, aValue);
+    }
+
+    std::mt19937                           aGenerator(12345);
+    std::uniform_real_distribution<double> aMantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int>     anExponent(-10, 10);
+    for (int anIter = 0; anIter < 20000; ++anIter)
+    {
+      const double aValue = aMantissa(aGenerator) * std::pow(10.0, anExponent(aGenerator));
+      checkSameText(aWriter, aValue);
+      checkSameText(aWriter, std::round(aValue * 1000.0) / 1000.0);
+    }
+  }
+}
+
+// Changed formats are used as given
+TEST(Interface_FloatWriterTest, ChangedFormat)
+{
+  Interface_FloatWriter aWriter(12);
+  aWriter.SetFormat("%g");
+  char aText[32] = {};
+  aWriter.Write(0.5, aText);
+  EXPECT_STREQ(aText, "0.5");
+  aWriter.Write(1.0e-7, aText);
+  EXPECT_STREQ(aText, "1e-07");
+}
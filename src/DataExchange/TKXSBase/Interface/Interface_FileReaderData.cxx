@@ -32,12 +32,8 @@ IMPLEMENT_STANDARD_RTTIEXT(Interface_FileReaderData, Standard_Transient)
 //  Each standard can use it as a base (literal parameter lists,
 //  associated entities) and add its own data to it.
 //  Works under the control of FileReaderTool
-//  Optimization : Fields not possible, because Param is const. Too bad
-//  So, we assume that we read one file at a time (reasonable assumption)
-//  We note in field a file number, relative to which we optimize
-static int thefic = 0;
-static int thenm0 = -1;
-static int thenp0 = -1;
+//  Parameters are accessed without any shared cache, so that several
+//  records can be consulted concurrently (see Interface_FileReaderTool::SetParallel)
 
 Interface_FileReaderData::Interface_FileReaderData(const int nbr, const int npar)
     : therrload(0),
@@ -46,8 +42,6 @@ Interface_FileReaderData::Interface_FileReaderData(const int nbr, const int npar
 {
   theparams = new Interface_ParamSet(npar);
   thenumpar.Init(0);
-  thenm0  = -1;
-  thenum0 = ++thefic;
 }
 
 int Interface_FileReaderData::NbRecords() const
@@ -135,30 +129,12 @@ occ::handle<Interface_ParamList> Interface_FileReaderData::Params(const int num)
 
 const Interface_FileParameter& Interface_FileReaderData::Param(const int num, const int nump) const
 {
-  if (thefic != thenum0)
-  {
-    return theparams->Param(thenumpar(num - 1) + nump);
-  }
-  if (thenm0 != num)
-  {
-    thenp0 = thenumpar(num - 1);
-    thenm0 = num;
-  }
-  return theparams->Param(thenp0 + nump);
+  return theparams->Param(thenumpar(num - 1) + nump);
 }
 
 Interface_FileParameter& Interface_FileReaderData::ChangeParam(const int num, const int nump)
 {
-  if (thefic != thenum0)
-  {
-    return theparams->ChangeParam(thenumpar(num - 1) + nump);
-  }
-  if (thenm0 != num)
-  {
-    thenp0 = thenumpar(num - 1);
-    thenm0 = num;
-  }
-  return theparams->ChangeParam(thenp0 + nump);
+  return theparams->ChangeParam(thenumpar(num - 1) + nump);
 }
 
 Interface_ParamType Interface_FileReaderData::ParamType(const int num, const int nump) const
@@ -196,7 +196,6 @@ protected:
   Standard_EXPORT void ParamPosition(const int numpar, int& num, int& nump) const;
 
 private:
-  int                                                 thenum0;
   int                                                 therrload;
   occ::handle<Interface_ParamSet>                     theparams;
   NCollection_Array1<int>                             thenumpar;
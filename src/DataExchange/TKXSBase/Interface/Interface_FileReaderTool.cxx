@@ -26,6 +26,8 @@
 #include <Interface_ReportEntity.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
@@ -35,6 +37,7 @@
 #else
   #include <OSD_Signal.hxx>
 #endif
+#include <algorithm>
 #include <cstdio>
 
 // MGE 16/06/98
@@ -55,6 +58,7 @@ Interface_FileReaderTool::Interface_FileReaderTool()
 {
   themessenger = Message::DefaultMessenger();
   theerrhand   = true;
+  theparallel  = false;
   thetrace     = 0;
   thenbrep0 = thenbreps = 0;
 }
@@ -145,6 +149,20 @@ bool Interface_FileReaderTool::ErrorHandle() const
   return theerrhand;
 }
 
+//=================================================================================================
+
+void Interface_FileReaderTool::SetParallel(const bool theIsParallel)
+{
+  theparallel = theIsParallel;
+}
+
+//=================================================================================================
+
+bool Interface_FileReaderTool::IsParallel() const
+{
+  return theparallel;
+}
+
 //  ....            Actions Related to MODEL LOADING            ....
 
 // SetEntities calls methods to be provided :
@@ -315,6 +333,13 @@ void Interface_FileReaderTool::LoadModel(const occ::handle<Interface_InterfaceMo
 
   amodel->Reservate(thereader->NbEntities());
 
+  //  ..            Parallel Decoding (if required)            ..
+  //  Records are analysed beforehand; the loop below then only fills the model
+  if (theparallel)
+  {
+    analyseRecordsParallel();
+  }
+
   int num, num0 = thereader->FindNextRecord(0);
   num = num0;
 
@@ -489,6 +514,8 @@ void Interface_FileReaderTool::LoadModel(const occ::handle<Interface_InterfaceMo
     }
   }
 
+  thechecks = NCollection_Array1<occ::handle<Interface_Check>>();
+
   //   Conclusion : may do nothing : according to necessity
   if (theerrhand)
   {
@@ -545,7 +572,25 @@ occ::handle<Standard_Transient> Interface_FileReaderTool::LoadedEntity(const int
     }
   }
   //  ..        Actual Loading : Standard Specific        ..
-  AnalyseRecord(num, anent, ach);
+  //  (already done if the record has been analysed in parallel)
+  occ::handle<Interface_Check> aDecodedCheck;
+  if (!thechecks.IsEmpty())
+  {
+    aDecodedCheck = thechecks.Value(num);
+    thechecks.ChangeValue(num).Nullify();
+  }
+  if (aDecodedCheck.IsNull())
+  {
+    AnalyseRecord(num, anent, ach);
+  }
+  else if (irep == 0)
+  {
+    ach = aDecodedCheck;
+  }
+  else
+  {
+    ach->GetMessages(aDecodedCheck);
+  }
 
   //  ..        Adding to the model the entity as is        ..
   //            WARNING, ReportEntity processed in block after Load
@@ -603,6 +648,50 @@ occ::handle<Standard_Transient> Interface_FileReaderTool::LoadedEntity(const int
 
 //=================================================================================================
 
+void Interface_FileReaderTool::analyseRecordsParallel()
+{
+  NCollection_DynamicArray<int> aRecords;
+  for (int num = thereader->FindNextRecord(0); num > 0; num = thereader->FindNextRecord(num))
+  {
+    aRecords.Append(num);
+  }
+  thechecks = NCollection_Array1<occ::handle<Interface_Check>>(0, thereader->NbRecords());
+  if (aRecords.IsEmpty())
+  {
+    return;
+  }
+
+  // records are decoded by blocks, to not contend on the job counter for tiny entities
+  const int aBlockSize = 256;
+  const int aNbBlocks  = (aRecords.Length() + aBlockSize - 1) / aBlockSize;
+
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const int                          aNbThreads =
+    std::min(aNbBlocks, aThreadPool->NbDefaultThreadsToLaunch());
+  OSD_ThreadPool::Launcher aLauncher(*aThreadPool, aNbThreads);
+  aLauncher.Perform(0, aNbBlocks, [&](int, int theBlockIndex) {
+    const int aLast = std::min((theBlockIndex + 1) * aBlockSize, aRecords.Length());
+    for (int anIndex = theBlockIndex * aBlockSize; anIndex < aLast; ++anIndex)
+    {
+      const int                       num   = aRecords.Value(anIndex);
+      occ::handle<Standard_Transient> anent = thereader->BoundEntity(num);
+      occ::handle<Interface_Check>    ach   = new Interface_Check(anent);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        AnalyseRecord(num, anent, ach);
+        thechecks.ChangeValue(num) = ach;
+      }
+      catch (Standard_Failure const&)
+      {
+        // left for the sequential loop, which manages error recovery and trace
+      }
+    }
+  });
+}
+
+//=================================================================================================
+
 Interface_FileReaderTool::~Interface_FileReaderTool() = default;
 
 void Interface_FileReaderTool::Clear()
@@ -611,4 +700,5 @@ void Interface_FileReaderTool::Clear()
   thereader.Nullify();
   themodel.Nullify();
   thereports.Nullify();
+  thechecks = NCollection_Array1<occ::handle<Interface_Check>>();
 }
@@ -25,11 +25,11 @@
 #include <Standard_Transient.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <Interface_Check.hxx>
 class Interface_Protocol;
 class Interface_FileReaderData;
 class Interface_InterfaceModel;
 class Message_Messenger;
-class Interface_Check;
 class Standard_Transient;
 class Interface_GeneralLib;
 class Interface_ReaderLib;
@@ -97,6 +97,18 @@ public:
   //! Returns ErrorHandle flag
   Standard_EXPORT bool ErrorHandle() const;
 
+  //! Allows decoding the records in parallel threads by LoadModel.
+  //! Once SetEntities has bound an empty entity to each record,
+  //! all references can be resolved, hence records are independent :
+  //! they are analysed concurrently (by AnalyseRecord), then added to
+  //! the model in their file order, as in sequential mode.
+  //! Requires AnalyseRecord of the concrete tool to be reentrant.
+  //! Default is False
+  Standard_EXPORT void SetParallel(const bool theIsParallel);
+
+  //! Returns Parallel flag
+  Standard_EXPORT bool IsParallel() const;
+
   //! Fills records with empty entities; once done, each entity can
   //! ask the FileReaderTool for any entity referenced through an
   //! identifier. Calls Recognize which is specific to each specific
@@ -193,6 +205,13 @@ protected:
   //! Constructor; sets default fields
   Standard_EXPORT Interface_FileReaderTool();
 
+private:
+  //! Analyses all the records in parallel threads (called by LoadModel
+  //! in Parallel mode). Resulting checks are kept to be consumed by
+  //! LoadedEntity; a record which raised an exception gets no check
+  //! and is analysed again sequentially, with the usual recovery.
+  void analyseRecordsParallel();
+
 private:
   occ::handle<Interface_Protocol>                                   theproto;
   occ::handle<Interface_FileReaderData>                             thereader;
@@ -200,9 +219,11 @@ private:
   occ::handle<Message_Messenger>                                    themessenger;
   int                                                               thetrace;
   bool                                                              theerrhand;
+  bool                                                              theparallel;
   int                                                               thenbrep0;
   int                                                               thenbreps;
   occ::handle<NCollection_HArray1<occ::handle<Standard_Transient>>> thereports;
+  NCollection_Array1<occ::handle<Interface_Check>>                  thechecks;
 };
 
 #endif // _Interface_FileReaderTool_HeaderFile
@@ -15,6 +15,206 @@
 
 #include <Interface_FloatWriter.hxx>
 
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  #define OCCT_FLOATWRITER_TO_CHARS
+#endif
+
+namespace
+{
+//! Suppresses trailing zeros of the mantissa and null exponent ("E+00")
+//! of a text produced by Sprintf. Only the first 16 characters are considered.
+void suppressZeros(char* theText)
+{
+  const int anMasSize = 5; // change 6 to 5: index 5 is not used below
+  char      lxp[anMasSize];
+  int       i0 = 0, j0 = 0;
+
+  for (int i = 0; i < anMasSize; ++i)
+  {
+    lxp[i] = '\0';
+  }
+
+  for (int i = 0; i < 16; i++)
+  {
+    i0 = i;
+    if (theText[i] == 'e' || theText[i] == 'E')
+    {
+      lxp[0] = 'E';
+      lxp[1] = theText[i + 1];
+      lxp[2] = theText[i + 2];
+      lxp[3] = theText[i + 3];
+      lxp[4] = theText[i + 4];
+
+      if (lxp[1] == '+' && lxp[2] == '0' && lxp[3] == '0' && lxp[4] == '\0')
+      {
+        lxp[0] = '\0';
+      }
+
+      theText[i] = '\0';
+    }
+    if (theText[i] == '\0')
+    {
+      break;
+    }
+  }
+  // #52 rln 23.12.98 converting 1e-07 throws exception
+  for (int j = i0 - 1; j >= 0; j--)
+  {
+    j0 = j;
+
+    if (theText[j] != '0')
+    {
+      break;
+    }
+
+    theText[j] = '\0';
+  }
+
+  theText[j0 + 1] = lxp[0];
+  theText[j0 + 2] = lxp[1];
+  theText[j0 + 3] = lxp[2];
+  theText[j0 + 4] = lxp[3];
+  theText[j0 + 5] = lxp[4];
+  theText[j0 + 6] = '\0';
+}
+
+#ifdef OCCT_FLOATWRITER_TO_CHARS
+//! Converts a finite value as Sprintf with format "%.<thePrecision>f" (for values in range)
+//! or "%.<thePrecision>E" followed by suppressZeros(), but without formatting by Sprintf.
+//! Returns the length of the text, 0 if it cannot be produced.
+int convertFast(const double theVal, char* theText, const int thePrecision, const bool theInRange)
+{
+  // Shortest representation restoring the value : "[-]d[.ddd]e[+|-]dd"
+  char                       aBuf[40];
+  const std::to_chars_result aRes =
+    std::to_chars(aBuf, aBuf + sizeof(aBuf) - 1, theVal, std::chars_format::scientific);
+  if (aRes.ec != std::errc())
+  {
+    return 0;
+  }
+  *aRes.ptr = '\0';
+
+  const char* aPos   = aBuf;
+  const bool  isNeg  = (*aPos == '-');
+  char        aDigits[24];
+  int         aNbDig = 0;
+  if (isNeg)
+  {
+    ++aPos;
+  }
+  for (; *aPos != 'e' && *aPos != '\0'; ++aPos)
+  {
+    if (*aPos != '.' && aNbDig < 24)
+    {
+      aDigits[aNbDig++] = *aPos;
+    }
+  }
+  const int anExp = (*aPos == 'e' ? atoi(aPos + 1) : 0);
+
+  // When the shortest representation has not more digits than the format,
+  // Sprintf only adds trailing zeros which are suppressed
+  // (not for subnormal values, whose shortest representation may be far from the exact value)
+  char* anOut = theText;
+  if (isNeg)
+  {
+    *anOut++ = '-';
+  }
+  const bool isNormal   = (std::fpclassify(theVal) != FP_SUBNORMAL);
+  bool       isShortest = false;
+  if (theInRange)
+  {
+    // Sprintf text longer than 15 characters is truncated by suppressZeros()
+    isShortest = isNormal && aNbDig - 1 - anExp <= thePrecision
+                 && (isNeg ? 1 : 0) + std::max(anExp + 1, 1) + 1 + std::max(aNbDig - anExp - 1, 0)
+                      <= 15;
+    if (isShortest)
+    {
+      if (anExp < 0)
+      {
+        *anOut++ = '0';
+        *anOut++ = '.';
+        for (int i = 1; i < -anExp; ++i)
+        {
+          *anOut++ = '0';
+        }
+        for (int i = 0; i < aNbDig; ++i)
+        {
+          *anOut++ = aDigits[i];
+        }
+      }
+      else
+      {
+        for (int i = 0; i <= anExp; ++i)
+        {
+          *anOut++ = (i < aNbDig ? aDigits[i] : '0');
+        }
+        *anOut++ = '.';
+        for (int i = anExp + 1; i < aNbDig; ++i)
+        {
+          *anOut++ = aDigits[i];
+        }
+      }
+    }
+  }
+  else if (isNormal && aNbDig - 1 <= thePrecision)
+  {
+    isShortest = true;
+    *anOut++   = aDigits[0];
+    *anOut++   = '.';
+    for (int i = 1; i < aNbDig; ++i)
+    {
+      *anOut++ = aDigits[i];
+    }
+    if (anExp != 0)
+    {
+      const int anAbsExp = std::abs(anExp);
+      *anOut++           = 'E';
+      *anOut++           = (anExp < 0 ? '-' : '+');
+      if (anAbsExp >= 100)
+      {
+        *anOut++ = char('0' + anAbsExp / 100);
+      }
+      *anOut++ = char('0' + (anAbsExp / 10) % 10);
+      *anOut++ = char('0' + anAbsExp % 10);
+    }
+  }
+  if (isShortest)
+  {
+    *anOut = '\0';
+    return int(anOut - theText);
+  }
+
+  // Same digits as Sprintf, with the same zero suppression
+  const std::to_chars_result aResPrec =
+    std::to_chars(theText,
+                  theText + 30,
+                  theVal,
+                  theInRange ? std::chars_format::fixed : std::chars_format::scientific,
+                  thePrecision);
+  if (aResPrec.ec != std::errc())
+  {
+    return 0;
+  }
+  *aResPrec.ptr = '\0';
+  for (char* aChar = theText; aChar != aResPrec.ptr; ++aChar)
+  {
+    if (*aChar == 'e')
+    {
+      *aChar = 'E';
+    }
+  }
+  suppressZeros(theText);
+  return (int)strlen(theText);
+}
+#endif
+} // namespace
+
 Interface_FloatWriter::Interface_FloatWriter(const int chars)
 {
   SetDefaults(chars);
@@ -25,6 +225,7 @@ Interface_FloatWriter::Interface_FloatWriter(const int chars)
 void Interface_FloatWriter::SetFormat(const char* const form, const bool reset)
 {
   strcpy(themainform, form);
+  theprecision = 0;
   if (!reset)
   {
     return;
@@ -38,7 +239,8 @@ void Interface_FloatWriter::SetFormatForRange(const char* const form,
                                               const double      R2)
 {
   strcpy(therangeform, form);
-  therange1 = R1;
+  theprecision = 0;
+  therange1    = R1;
   therange2 = R2;
 }
 
@@ -61,9 +263,11 @@ void Interface_FloatWriter::SetDefaults(const int chars)
     Sprintf(themainform, "%c%d%c%dE", pourcent, chars + 2, point, chars);
     Sprintf(therangeform, "%c%d%c%df", pourcent, chars + 2, point, chars);
   }
-  therange1  = 0.1;
-  therange2  = 1000.;
-  thezerosup = true;
+  // exponent of main format should be within the first 16 characters, see Convert()
+  theprecision = (chars > 0 && chars <= 12 ? chars : 0);
+  therange1    = 0.1;
+  therange2    = 1000.;
+  thezerosup   = true;
 }
 
 void Interface_FloatWriter::Options(bool& zerosup, bool& range, double& R1, double& R2) const
@@ -90,6 +294,18 @@ const char* Interface_FloatWriter::FormatForRange() const
 
 int Interface_FloatWriter::Write(const double val, const char* const text) const
 {
+#ifdef OCCT_FLOATWRITER_TO_CHARS
+  if (theprecision > 0 && thezerosup && std::isfinite(val))
+  {
+    const bool isInRange =
+      (val >= therange1 && val < therange2) || (val <= -therange1 && val > -therange2);
+    const int aLength = convertFast(val, (char*)text, theprecision, isInRange);
+    if (aLength > 0)
+    {
+      return aLength;
+    }
+  }
+#endif
   const char* const mainform  = static_cast<const char*>(themainform);
   const char* const rangeform = static_cast<const char*>(therangeform);
   return Convert(val, text, thezerosup, therange1, therange2, mainform, rangeform);
@@ -106,16 +322,7 @@ int Interface_FloatWriter::Convert(const double      val,
                                    const char* const rangeform)
 {
   //    Float value, purged of trailing "0000" and "E+00"
-  const int anMasSize = 5; // change 6 to 5: index 5 is not used below
-  char      lxp[anMasSize], *pText;
-  int       i0 = 0, j0 = 0;
-
-  for (int i = 0; i < anMasSize; ++i)
-  {
-    lxp[i] = '\0';
-  }
-
-  pText = (char*)text;
+  char* pText = (char*)text;
   //
   if ((val >= R1 && val < R2) || (val <= -R1 && val > -R2))
   {
@@ -128,48 +335,7 @@ int Interface_FloatWriter::Convert(const double      val,
 
   if (zsup)
   {
-    for (int i = 0; i < 16; i++)
-    {
-      i0 = i;
-      if (text[i] == 'e' || text[i] == 'E')
-      {
-        lxp[0] = 'E';
-        lxp[1] = text[i + 1];
-        lxp[2] = text[i + 2];
-        lxp[3] = text[i + 3];
-        lxp[4] = text[i + 4];
-
-        if (lxp[1] == '+' && lxp[2] == '0' && lxp[3] == '0' && lxp[4] == '\0')
-        {
-          lxp[0] = '\0';
-        }
-
-        pText[i] = '\0';
-      }
-      if (text[i] == '\0')
-      {
-        break;
-      }
-    }
-    // #52 rln 23.12.98 converting 1e-07 throws exception
-    for (int j = i0 - 1; j >= 0; j--)
-    {
-      j0 = j;
-
-      if (text[j] != '0')
-      {
-        break;
-      }
-
-      pText[j] = '\0';
-    }
-
-    pText[j0 + 1] = lxp[0];
-    pText[j0 + 2] = lxp[1];
-    pText[j0 + 3] = lxp[2];
-    pText[j0 + 4] = lxp[3];
-    pText[j0 + 5] = lxp[4];
-    pText[j0 + 6] = '\0';
+    suppressZeros(pText);
   }
   return (int)strlen(text);
 }
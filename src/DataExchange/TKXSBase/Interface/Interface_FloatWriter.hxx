@@ -85,7 +85,10 @@ public:
 
   //! Writes a Real value <val> to a string <text> by using the
   //! options. Returns the useful Length of produced string.
-  //! It calls the class method Convert.
+  //! It calls the class method Convert, or with the default options
+  //! for a count of characters (see SetDefaults), produces the same
+  //! text without formatting by Sprintf : the shortest representation
+  //! restoring the value is used when it is not longer than the format.
   //! Warning : <text> is assumed to be wide enough (20-30 is correct)
   //! And, even if declared in, its content will be modified
   Standard_EXPORT int Write(const double val, const char* const text) const;
@@ -107,6 +110,7 @@ private:
   double therange2;
   char   therangeform[12];
   bool   thezerosup;
+  int    theprecision; //!< count of characters of default formats, 0 if formats are changed
 };
 
 #endif // _Interface_FloatWriter_HeaderFile
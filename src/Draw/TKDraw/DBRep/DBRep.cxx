@@ -1969,7 +1969,8 @@ void DBRep::BasicCommands(Draw_Interpretor& theCommands)
     "\n\t\t:  -binary  write into the binary format (ASCII when unspecified)"
     "\n\t\t:  -version a number of format version to save;"
     "\n\t\t:           ASCII  versions: 1, 2 and 3    (3 for ASCII  when unspecified);"
-    "\n\t\t:           Binary versions: 1, 2, 3 and 4 (4 for Binary when unspecified)."
+    "\n\t\t:           Binary versions: 1, 2, 3, 4, 5 (4 for Binary when unspecified);"
+    "\n\t\t:           version 5 stores triangulations in compact form."
     "\n\t\t:  -triangles write triangulation data (TRUE when unspecified)."
     "\n\t\t:           Ignored (always written) if face defines only triangulation (no surface)."
     "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when "
@@ -10,6 +10,8 @@ set(OCCT_TopLoc_FILES
   TopLoc_Location.cxx
   TopLoc_Location.hxx
   TopLoc_Location.lxx
+  TopLoc_LocationCache.cxx
+  TopLoc_LocationCache.hxx
 
   TopLoc_SListNodeOfItemLocation.cxx
   TopLoc_SListNodeOfItemLocation.hxx
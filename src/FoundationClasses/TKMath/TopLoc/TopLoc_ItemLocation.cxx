@@ -24,7 +24,8 @@
 TopLoc_ItemLocation::TopLoc_ItemLocation(const occ::handle<TopLoc_Datum3D>& D, const int P)
     : myDatum(D),
       myPower(P),
-      myTrsf(D->Transformation().Powered(P))
+      myTrsf(D->Transformation().Powered(P)),
+      myHash(0)
 {
 }
 
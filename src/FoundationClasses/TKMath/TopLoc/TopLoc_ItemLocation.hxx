@@ -51,7 +51,8 @@ public:
 private:
   occ::handle<TopLoc_Datum3D> myDatum;
   int                         myPower;
-  gp_Trsf                     myTrsf;
+  gp_Trsf                     myTrsf; //!< transformation of the chain starting with this item
+  size_t                      myHash; //!< hash code of the chain starting with this item
 };
 
 #endif // _TopLoc_ItemLocation_HeaderFile
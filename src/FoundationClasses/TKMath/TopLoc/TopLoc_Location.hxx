@@ -125,7 +125,8 @@ public:
   [[nodiscard]] Standard_EXPORT TopLoc_Location Powered(const int pwr) const;
 
   //! Returns a hashed value for this local coordinate system. This value is used, with map tables,
-  //! to store and retrieve the object easily
+  //! to store and retrieve the object easily.
+  //! The hash code is computed once on construction of the chain of elementary data.
   //! @return a computed hash code
   size_t HashCode() const noexcept;
 
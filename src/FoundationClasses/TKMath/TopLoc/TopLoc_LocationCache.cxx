@@ -0,0 +1,49 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TopLoc_LocationCache.hxx>
+
+//=================================================================================================
+
+const TopLoc_Location& TopLoc_LocationCache::Intern(const TopLoc_Location& theLocation)
+{
+  static const TopLoc_Location THE_IDENTITY;
+  if (theLocation.IsIdentity())
+  {
+    return THE_IDENTITY;
+  }
+  return myLocations.Added(theLocation);
+}
+
+//=================================================================================================
+
+const TopLoc_Location& TopLoc_LocationCache::Multiplied(const TopLoc_Location& theLeft,
+                                                        const TopLoc_Location& theRight)
+{
+  if (theRight.IsIdentity())
+  {
+    return Intern(theLeft);
+  }
+  else if (theLeft.IsIdentity())
+  {
+    return Intern(theRight);
+  }
+
+  const LocationPair            aKey(Intern(theLeft), Intern(theRight));
+  const TopLoc_Location* const* aProduct = myProducts.Seek(aKey);
+  if (aProduct == nullptr)
+  {
+    aProduct = myProducts.Bound(aKey, &Intern(aKey.first.Multiplied(aKey.second)));
+  }
+  return **aProduct;
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TopLoc_LocationCache_HeaderFile
+#define _TopLoc_LocationCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
+#include <TopLoc_Location.hxx>
+
+#include <utility>
+
+//! Interning table of locations.
+//!
+//! Equal locations (the same series of datums and powers) created independently
+//! share nothing, so that their comparison has to walk both chains.
+//! The table returns the single stored instance for equal locations, which makes
+//! comparison of interned locations trivial and shares memory of their chains.
+//! Products of interned locations are memorized, so that traversal of deep assemblies
+//! does not rebuild the same chains for every occurrence of a sub-assembly.
+//!
+//! The table is not thread-safe; use a dedicated instance per thread.
+class TopLoc_LocationCache
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty table.
+  TopLoc_LocationCache() = default;
+
+  //! Returns the stored location equal to the given one, adding it if missing.
+  Standard_EXPORT const TopLoc_Location& Intern(const TopLoc_Location& theLocation);
+
+  //! Returns the interned product theLeft * theRight, computing it only once
+  //! for each pair of locations.
+  Standard_EXPORT const TopLoc_Location& Multiplied(const TopLoc_Location& theLeft,
+                                                    const TopLoc_Location& theRight);
+
+  //! Returns the number of interned locations.
+  int Extent() const { return myLocations.Extent(); }
+
+  //! Removes all locations and products.
+  void Clear()
+  {
+    myProducts.Clear();
+    myLocations.Clear();
+  }
+
+private:
+  typedef std::pair<TopLoc_Location, TopLoc_Location> LocationPair;
+
+  //! Hasher of pair of locations.
+  struct LocationPairHasher
+  {
+    size_t operator()(const LocationPair& thePair) const noexcept
+    {
+      size_t aCombined[2] = {thePair.first.HashCode(), thePair.second.HashCode()};
+      return opencascade::hashBytes(aCombined, sizeof(aCombined));
+    }
+
+    bool operator()(const LocationPair& thePair1, const LocationPair& thePair2) const noexcept
+    {
+      return thePair1.first == thePair2.first && thePair1.second == thePair2.second;
+    }
+  };
+
+private:
+  NCollection_Map<TopLoc_Location> myLocations; //!< interned locations
+  NCollection_DataMap<LocationPair, const TopLoc_Location*, LocationPairHasher>
+    myProducts; //!< interned products of interned locations
+};
+
+#endif // _TopLoc_LocationCache_HeaderFile
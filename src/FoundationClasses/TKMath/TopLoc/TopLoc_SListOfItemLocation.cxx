@@ -14,7 +14,9 @@
 // Alternatively, this file may be used under the terms of Open CASCADE
 // commercial license or contractual agreement.
 
+#include <Standard_HashUtils.hxx>
 #include <Standard_NoSuchObject.hxx>
+#include <TopLoc_Datum3D.hxx>
 #include <TopLoc_ItemLocation.hxx>
 #include <TopLoc_SListNodeOfItemLocation.hxx>
 #include <TopLoc_SListOfItemLocation.hxx>
@@ -25,11 +27,20 @@ TopLoc_SListOfItemLocation::TopLoc_SListOfItemLocation(const TopLoc_ItemLocation
                                                        const TopLoc_SListOfItemLocation& aTail)
     : myNode(new TopLoc_SListNodeOfItemLocation(anItem, aTail))
 {
+  // compose transformation and hash code of the whole chain,
+  // so that they are not recomputed by TopLoc_Location
+  TopLoc_ItemLocation& aValue    = myNode->Value();
+  size_t               aTailHash = opencascade::MurmurHash::optimalSeed<size_t>();
   if (!myNode->Tail().IsEmpty())
   {
-    const gp_Trsf& aT = myNode->Tail().Value().myTrsf;
-    myNode->Value().myTrsf.PreMultiply(aT);
+    const TopLoc_ItemLocation& aTail = myNode->Tail().Value();
+    aValue.myTrsf.PreMultiply(aTail.myTrsf);
+    aTailHash = aTail.myHash;
   }
+  size_t aCombined[3] = {std::hash<occ::handle<TopLoc_Datum3D>>{}(aValue.myDatum),
+                         opencascade::hash(aValue.myPower),
+                         aTailHash};
+  aValue.myHash       = opencascade::hashBytes(aCombined, sizeof(aCombined));
 }
 
 //=================================================================================================
@@ -17,6 +17,7 @@ set(OCCT_TKernel_GTests_FILES
   NCollection_FlatDataMap_Test.cxx
   NCollection_FlatMap_Test.cxx
   NCollection_ForwardRange_Test.cxx
+  NCollection_IncAllocatorArenas_Test.cxx
   NCollection_IndexedDataMap_Test.cxx
   NCollection_IndexedMap_Test.cxx
   NCollection_KDTree_Test.cxx
@@ -32,6 +33,7 @@ set(OCCT_TKernel_GTests_FILES
   NCollection_UBTree_Test.cxx
   NCollection_Vec4_Test.cxx
   OSD_Parallel_Test.cxx
+  OSD_ThreadPool_Test.cxx
   OSD_Path_Test.cxx
   OSD_PerfMeter_Test.cxx
   Resource_Manager_Test.cxx
@@ -46,6 +48,7 @@ set(OCCT_TKernel_GTests_FILES
   Standard_Failure_Test.cxx
   Standard_GUID_Test.cxx
   Standard_Handle_Test.cxx
+  Standard_MMgrThreadCache_Test.cxx
   Standard_Strtod_Test.cxx
   TCollection_AsciiString_Test.cxx
   TCollection_ExtendedString_Test.cxx
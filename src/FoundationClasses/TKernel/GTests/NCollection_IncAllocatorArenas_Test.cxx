@@ -0,0 +1,86 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_IncAllocatorArenas.hxx>
+#include <NCollection_List.hxx>
+#include <OSD_ThreadPool.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(NCollection_IncAllocatorArenasTest, Statistics)
+{
+  occ::handle<NCollection_IncAllocator> anAlloc = new NCollection_IncAllocator();
+  EXPECT_EQ(0u, anAlloc->GetStatistics().NbBlocks);
+
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    anAlloc->Allocate(64);
+  }
+  NCollection_IncAllocator::Statistics aStats = anAlloc->GetStatistics();
+  EXPECT_GT(aStats.NbBlocks, 0u);
+  EXPECT_EQ(64000u, aStats.UsedSize);
+  EXPECT_GE(aStats.ReservedSize, aStats.UsedSize);
+
+  // reset keeps memory blocks for reuse
+  anAlloc->Reset(false);
+  const NCollection_IncAllocator::Statistics aResetStats = anAlloc->GetStatistics();
+  EXPECT_EQ(aStats.NbBlocks, aResetStats.NbBlocks);
+  EXPECT_EQ(aStats.ReservedSize, aResetStats.ReservedSize);
+  EXPECT_EQ(0u, aResetStats.UsedSize);
+
+  anAlloc->Reset(true);
+  EXPECT_EQ(0u, anAlloc->GetStatistics().NbBlocks);
+}
+
+TEST(NCollection_IncAllocatorArenasTest, ParallelLauncher)
+{
+  const int                aNbItems = 200;
+  OSD_ThreadPool::Launcher aLauncher(*OSD_ThreadPool::DefaultPool());
+
+  NCollection_IncAllocatorArenas anArenas(aLauncher.LowerThreadIndex(),
+                                          aLauncher.UpperThreadIndex());
+  EXPECT_EQ(0, anArenas.NbArenas());
+
+  NCollection_Array1<NCollection_List<int>*> aLists(0, aNbItems - 1);
+  aLauncher.Perform(0, aNbItems, [&](int theThreadIndex, int theItemIndex) {
+    const occ::handle<NCollection_IncAllocator>& anAlloc = anArenas.Allocator(theThreadIndex);
+    NCollection_List<int>* aList = new (anAlloc->Allocate(sizeof(NCollection_List<int>)))
+      NCollection_List<int>(anAlloc);
+    for (int anIter = 0; anIter < theItemIndex; ++anIter)
+    {
+      aList->Append(anIter);
+    }
+    aLists.SetValue(theItemIndex, aList);
+  });
+
+  EXPECT_GE(anArenas.NbArenas(), 1);
+  EXPECT_LE(anArenas.NbArenas(), aLauncher.NbThreads());
+  for (int anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+  {
+    ASSERT_EQ(anItemIter, aLists.Value(anItemIter)->Extent());
+    int anExpected = 0;
+    for (const int aValue : *aLists.Value(anItemIter))
+    {
+      EXPECT_EQ(anExpected++, aValue);
+    }
+  }
+
+  const NCollection_IncAllocator::Statistics aStats = anArenas.GetStatistics();
+  EXPECT_GT(aStats.UsedSize, 0u);
+  EXPECT_GE(aStats.ReservedSize, aStats.UsedSize);
+
+  // lists are allocated in arenas, so they are dropped without destruction
+  anArenas.Reset(false);
+  EXPECT_EQ(0u, anArenas.GetStatistics().UsedSize);
+  EXPECT_EQ(aStats.ReservedSize, anArenas.GetStatistics().ReservedSize);
+}
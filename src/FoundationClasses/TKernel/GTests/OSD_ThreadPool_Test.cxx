@@ -0,0 +1,129 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+TEST(OSD_ThreadPoolTest, GrainSize)
+{
+  occ::handle<OSD_ThreadPool> aPool = new OSD_ThreadPool(4);
+  for (int aGrainSize = 1; aGrainSize <= 64; aGrainSize *= 4)
+  {
+    std::vector<std::atomic<int>> aCounters(1000);
+    OSD_ThreadPool::Launcher      aLauncher(*aPool);
+    aLauncher.Perform(
+      0,
+      1000,
+      [&aCounters](int, int theIndex) { ++aCounters[theIndex]; },
+      aGrainSize);
+    for (const std::atomic<int>& aCounter : aCounters)
+    {
+      ASSERT_EQ(1, aCounter.load());
+    }
+  }
+}
+
+TEST(OSD_ThreadPoolTest, NestedLaunchers)
+{
+  const int                   aNbOuter = 8;
+  const int                   aNbInner = 200;
+  occ::handle<OSD_ThreadPool> aPool    = new OSD_ThreadPool(4);
+
+  std::vector<std::atomic<int>> aCounters(aNbOuter * aNbInner);
+  std::atomic<bool>             isIndexShared(false);
+  std::atomic<bool>             isIndexOutOfRange(false);
+
+  OSD_ThreadPool::Launcher anOuter(*aPool);
+  anOuter.Perform(0, aNbOuter, [&](int, int theOuterIndex) {
+    OSD_ThreadPool::Launcher anInner(*aPool);
+    EXPECT_EQ(aPool->NbThreads(), anInner.NbThreads());
+
+    // each thread index should be used by a single thread at a time
+    std::vector<std::atomic<int>> aUsage(anInner.NbThreads());
+    anInner.Perform(0, aNbInner, [&](int theThreadIndex, int theInnerIndex) {
+      if (theThreadIndex < anInner.LowerThreadIndex()
+          || theThreadIndex > anInner.UpperThreadIndex())
+      {
+        isIndexOutOfRange = true;
+        return;
+      }
+      if (aUsage[theThreadIndex].fetch_add(1) != 0)
+      {
+        isIndexShared = true;
+      }
+      ++aCounters[theOuterIndex * aNbInner + theInnerIndex];
+      aUsage[theThreadIndex].fetch_sub(1);
+    });
+  });
+
+  EXPECT_FALSE(isIndexOutOfRange);
+  EXPECT_FALSE(isIndexShared);
+  for (const std::atomic<int>& aCounter : aCounters)
+  {
+    ASSERT_EQ(1, aCounter.load());
+  }
+}
+
+TEST(OSD_ThreadPoolTest, NestedFailure)
+{
+  occ::handle<OSD_ThreadPool> aPool = new OSD_ThreadPool(4);
+  OSD_ThreadPool::Launcher    anOuter(*aPool);
+  EXPECT_THROW(anOuter.Perform(0,
+                               4,
+                               [&](int, int) {
+                                 OSD_ThreadPool::Launcher anInner(*aPool);
+                                 anInner.Perform(0, 100, [](int, int theIndex) {
+                                   if (theIndex == 50)
+                                   {
+                                     throw Standard_ProgramError("Nested failure");
+                                   }
+                                 });
+                               }),
+               Standard_ProgramError);
+}
+
+TEST(OSD_ThreadPoolTest, TaskGroup)
+{
+  occ::handle<OSD_ThreadPool> aPool = new OSD_ThreadPool(4);
+  std::atomic<int>            aSum(0);
+
+  OSD_ThreadPool::TaskGroup aGroup(*aPool);
+  for (int aTaskIter = 1; aTaskIter <= 10; ++aTaskIter)
+  {
+    aGroup.Run([&aPool, &aSum, aTaskIter]() {
+      // nested group within a task
+      OSD_ThreadPool::TaskGroup aNested(*aPool);
+      for (int aSubIter = 0; aSubIter < aTaskIter; ++aSubIter)
+      {
+        aNested.Run([&aSum]() { ++aSum; });
+      }
+      aNested.Wait();
+    });
+  }
+  // tasks are deferred until Wait()
+  EXPECT_EQ(10, aGroup.NbTasks());
+  EXPECT_EQ(0, aSum.load());
+  aGroup.Wait();
+  EXPECT_EQ(0, aGroup.NbTasks());
+  EXPECT_EQ(55, aSum.load());
+
+  // the group can be reused
+  aGroup.Run([&aSum]() { aSum = 0; });
+  aGroup.Wait();
+  EXPECT_EQ(0, aSum.load());
+}
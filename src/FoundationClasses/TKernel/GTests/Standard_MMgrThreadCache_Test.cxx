@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(Standard_MMgrThreadCacheTest, AllocateFreeReallocate)
+{
+  Standard_MMgrThreadCache aMMgr(true, 256, 8);
+
+  std::vector<char*> aBlocks;
+  for (size_t aSize = 0; aSize <= 1024; aSize += 7)
+  {
+    char* aBlock = static_cast<char*>(aMMgr.Allocate(aSize));
+    ASSERT_NE(nullptr, aBlock);
+    EXPECT_EQ(0u, reinterpret_cast<size_t>(aBlock) % 16);
+    for (size_t anIter = 0; anIter < aSize; ++anIter)
+    {
+      EXPECT_EQ(0, aBlock[anIter]);
+    }
+    memset(aBlock, int(aSize % 128), aSize);
+    aBlocks.push_back(aBlock);
+  }
+
+  // grow small blocks into large ones and check that the contents are preserved
+  for (size_t anIndex = 0; anIndex < aBlocks.size(); ++anIndex)
+  {
+    const size_t aSize = anIndex * 7;
+    aBlocks[anIndex]   = static_cast<char*>(aMMgr.Reallocate(aBlocks[anIndex], aSize + 300));
+    for (size_t anIter = 0; anIter < aSize; ++anIter)
+    {
+      ASSERT_EQ(char(aSize % 128), aBlocks[anIndex][anIter]);
+    }
+  }
+  for (char* aBlock : aBlocks)
+  {
+    aMMgr.Free(aBlock);
+  }
+  aMMgr.Purge(false);
+
+  Standard::AllocatorStatistics aStats;
+  aMMgr.Statistics(aStats);
+  EXPECT_EQ(aStats.NbSmallAllocations, aStats.NbSmallFrees);
+  EXPECT_EQ(aStats.NbLargeAllocations, aStats.NbLargeFrees);
+  EXPECT_EQ(0u, aStats.LargeBytes);
+  EXPECT_GT(aStats.ReservedBytes, 0u);
+  EXPECT_EQ(1u, aStats.NbThreadCaches);
+}
+
+TEST(Standard_MMgrThreadCacheTest, CrossThreadFree)
+{
+  const int aNbThreads = 4;
+  const int aNbBlocks  = 5000;
+
+  Standard_MMgrThreadCache          aMMgr(false, 512, 16);
+  std::vector<std::vector<size_t*>> aBlocks(aNbThreads);
+  {
+    // each thread allocates blocks which are freed by another thread
+    std::vector<std::thread> aThreads;
+    for (int aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+    {
+      aThreads.emplace_back([&aMMgr, &aBlocks, aThreadIter, aNbBlocks]() {
+        for (int aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+        {
+          const size_t aSize  = sizeof(size_t) * (1 + aBlockIter % 40);
+          size_t*      aBlock = static_cast<size_t*>(aMMgr.Allocate(aSize));
+          aBlock[0]           = size_t(aThreadIter * aNbBlocks + aBlockIter);
+          aBlocks[aThreadIter].push_back(aBlock);
+        }
+      });
+    }
+    for (std::thread& aThread : aThreads)
+    {
+      aThread.join();
+    }
+  }
+
+  std::vector<std::thread> aThreads;
+  for (int aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    aThreads.emplace_back([&aMMgr, &aBlocks, aThreadIter, aNbThreads, aNbBlocks]() {
+      const int anOwner = (aThreadIter + 1) % aNbThreads;
+      for (int aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+      {
+        size_t* aBlock = aBlocks[anOwner][aBlockIter];
+        EXPECT_EQ(size_t(anOwner * aNbBlocks + aBlockIter), aBlock[0]);
+        aMMgr.Free(aBlock);
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+
+  // all threads have exited and returned their caches
+  Standard::AllocatorStatistics aStats;
+  aMMgr.Statistics(aStats);
+  EXPECT_EQ(0u, aStats.NbThreadCaches);
+  EXPECT_EQ(size_t(aNbThreads * aNbBlocks), aStats.NbSmallAllocations);
+  EXPECT_EQ(size_t(aNbThreads * aNbBlocks), aStats.NbSmallFrees);
+  EXPECT_GT(aStats.NbRefills, 0u);
+  EXPECT_GT(aStats.NbSpills, 0u);
+}
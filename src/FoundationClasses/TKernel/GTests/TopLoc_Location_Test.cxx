@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <TopLoc_Location.hxx>
+#include <TopLoc_LocationCache.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS.hxx>
@@ -21,6 +22,7 @@
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 #include <gp_Pnt.hxx>
+#include <Precision.hxx>
 #include <OSD_Parallel.hxx>
 
 #include <gtest/gtest.h>
@@ -89,3 +91,64 @@ TEST(TopLoc_Location_Test, OCC25545_ConcurrentTransformationAccess)
   EXPECT_EQ(aFunc.myIsRaceDetected, 0)
     << "Data race detected in concurrent TopLoc_Location::Transformation() access";
 }
+
+TEST(TopLoc_Location_Test, HashCode_EqualChains)
+{
+  gp_Trsf aTrsf1, aTrsf2;
+  aTrsf1.SetTranslation(gp_Vec(1.0, 2.0, 3.0));
+  aTrsf2.SetRotation(gp::OZ(), 0.5);
+  const TopLoc_Location aLoc1(aTrsf1), aLoc2(aTrsf2);
+
+  // equal chains built independently
+  const TopLoc_Location aProd1 = aLoc1 * aLoc2 * aLoc1;
+  const TopLoc_Location aProd2 = aLoc1 * (aLoc2 * aLoc1);
+  EXPECT_EQ(aProd1, aProd2);
+  EXPECT_EQ(aProd1.HashCode(), aProd2.HashCode());
+
+  // different chains
+  const TopLoc_Location aProd3 = aLoc2 * aLoc1 * aLoc1;
+  EXPECT_NE(aProd1, aProd3);
+  EXPECT_NE(aProd1.HashCode(), aProd3.HashCode());
+  EXPECT_NE(aProd1, aLoc1 * aLoc2);
+
+  // cancelled chain is identity
+  const TopLoc_Location anIdentity = aProd1 * aProd2.Inverted();
+  EXPECT_TRUE(anIdentity.IsIdentity());
+  EXPECT_EQ(anIdentity.HashCode(), TopLoc_Location().HashCode());
+}
+
+TEST(TopLoc_Location_Test, LocationCache_Intern)
+{
+  gp_Trsf aTrsf1, aTrsf2;
+  aTrsf1.SetTranslation(gp_Vec(1.0, 0.0, 0.0));
+  aTrsf2.SetRotation(gp::OX(), 0.25);
+  const TopLoc_Location aLoc1(aTrsf1), aLoc2(aTrsf2);
+
+  TopLoc_LocationCache   aCache;
+  const TopLoc_Location& anInterned1 = aCache.Intern(aLoc1 * aLoc2);
+  const TopLoc_Location& anInterned2 = aCache.Intern(aLoc1 * aLoc2);
+  EXPECT_EQ(&anInterned1, &anInterned2);
+  EXPECT_EQ(aCache.Extent(), 1);
+  EXPECT_TRUE(aCache.Intern(TopLoc_Location()).IsIdentity());
+
+  const TopLoc_Location& aProd1 = aCache.Multiplied(aLoc1, aLoc2);
+  const TopLoc_Location& aProd2 = aCache.Multiplied(TopLoc_Location(aLoc1), aLoc2);
+  EXPECT_EQ(&aProd1, &anInterned1);
+  EXPECT_EQ(&aProd1, &aProd2);
+
+  // deep chain: repeated products are computed once
+  TopLoc_Location aChain;
+  for (int anIter = 0; anIter < 10; ++anIter)
+  {
+    aChain = aCache.Multiplied(aChain, anIter % 2 == 0 ? aLoc1 : aLoc2);
+  }
+  const TopLoc_Location& aChainProd = aCache.Multiplied(aChain, aLoc1);
+  EXPECT_EQ(aChainProd, aChain * aLoc1);
+  EXPECT_TRUE(aChainProd.Transformation().TranslationPart().IsEqual(
+    (aChain * aLoc1).Transformation().TranslationPart(),
+    Precision::Confusion()));
+  EXPECT_EQ(&aChainProd, &aCache.Multiplied(aChain, aLoc1));
+
+  aCache.Clear();
+  EXPECT_EQ(aCache.Extent(), 0);
+}
@@ -40,6 +40,8 @@ set(OCCT_NCollection_FILES
   NCollection_HSequence.hxx
   NCollection_IncAllocator.cxx
   NCollection_IncAllocator.hxx
+  NCollection_IncAllocatorArenas.cxx
+  NCollection_IncAllocatorArenas.hxx
   NCollection_IndexedDataMap.hxx
   NCollection_IndexedIterator.hxx
   NCollection_IndexedMap.hxx
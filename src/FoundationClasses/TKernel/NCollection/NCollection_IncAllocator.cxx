@@ -291,6 +291,23 @@ void NCollection_IncAllocator::Reset(const bool theReleaseMemory)
 
 //=================================================================================================
 
+NCollection_IncAllocator::Statistics NCollection_IncAllocator::GetStatistics() const
+{
+  Statistics aStats;
+  for (const IBlock* aBlock = myOrderedBlocks; aBlock != nullptr; aBlock = aBlock->NextOrderedBlock)
+  {
+    const char*  aBlockStart = reinterpret_cast<const char*>(aBlock) + sizeof(IBlock);
+    const size_t aUsedSize =
+      static_cast<size_t>(aBlock->CurPointer.load(std::memory_order_relaxed) - aBlockStart);
+    ++aStats.NbBlocks;
+    aStats.UsedSize += aUsedSize;
+    aStats.ReservedSize += aUsedSize + aBlock->AvailableSize.load(std::memory_order_relaxed);
+  }
+  return aStats;
+}
+
+//=================================================================================================
+
 NCollection_IncAllocator::IBlock::IBlock(void* thePointer, const size_t theSize)
     : CurPointer(static_cast<char*>(thePointer) + sizeof(IBlock)),
       AvailableSize(theSize)
@@ -92,6 +92,18 @@ public:
   //!   for future allocations.
   Standard_EXPORT void Reset(const bool theReleaseMemory = false);
 
+  //! Memory usage of the allocator.
+  struct Statistics
+  {
+    size_t NbBlocks     = 0; //!< number of memory blocks
+    size_t ReservedSize = 0; //!< size of memory blocks, in bytes
+    size_t UsedSize     = 0; //!< size of allocated memory, in bytes
+  };
+
+  //! Returns memory usage of the allocator.
+  //! Must not be called concurrently with allocations.
+  Standard_EXPORT Statistics GetStatistics() const;
+
 private:
   // Prohibited methods
   NCollection_IncAllocator(const NCollection_IncAllocator&)            = delete;
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_IncAllocatorArenas.hxx>
+
+//=================================================================================================
+
+NCollection_IncAllocatorArenas::NCollection_IncAllocatorArenas(const int    theLower,
+                                                               const int    theUpper,
+                                                               const size_t theBlockSize)
+    : myArenas(theLower, theUpper),
+      myBlockSize(theBlockSize)
+{
+}
+
+//=================================================================================================
+
+void NCollection_IncAllocatorArenas::Reset(const bool theReleaseMemory)
+{
+  for (const occ::handle<NCollection_IncAllocator>& anArena : myArenas)
+  {
+    if (!anArena.IsNull())
+    {
+      anArena->Reset(theReleaseMemory);
+    }
+  }
+}
+
+//=================================================================================================
+
+NCollection_IncAllocator::Statistics NCollection_IncAllocatorArenas::GetStatistics() const
+{
+  NCollection_IncAllocator::Statistics aStats;
+  for (const occ::handle<NCollection_IncAllocator>& anArena : myArenas)
+  {
+    if (!anArena.IsNull())
+    {
+      const NCollection_IncAllocator::Statistics anArenaStats = anArena->GetStatistics();
+      aStats.NbBlocks += anArenaStats.NbBlocks;
+      aStats.ReservedSize += anArenaStats.ReservedSize;
+      aStats.UsedSize += anArenaStats.UsedSize;
+    }
+  }
+  return aStats;
+}
+
+//=================================================================================================
+
+int NCollection_IncAllocatorArenas::NbArenas() const
+{
+  int aNbArenas = 0;
+  for (const occ::handle<NCollection_IncAllocator>& anArena : myArenas)
+  {
+    if (!anArena.IsNull())
+    {
+      ++aNbArenas;
+    }
+  }
+  return aNbArenas;
+}
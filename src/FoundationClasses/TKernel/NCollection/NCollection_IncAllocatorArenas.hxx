@@ -0,0 +1,90 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_IncAllocatorArenas_HeaderFile
+#define NCollection_IncAllocatorArenas_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_IncAllocator.hxx>
+
+//! Set of incremental allocators (arenas), one per working thread of a parallel algorithm.
+//!
+//! NCollection_IncAllocator::SetThreadSafe() makes a single allocator usable
+//! from several threads at the cost of synchronization on each allocation.
+//! Instead, each job of a parallel algorithm may allocate from its own arena
+//! taking no lock at all, provided that the thread index passed to the job
+//! identifies the arena (as OSD_ThreadPool::Launcher does, see OSD_ThreadPool::Launcher::Arenas()):
+//! @code
+//!   OSD_ThreadPool::Launcher        aLauncher(*OSD_ThreadPool::DefaultPool());
+//!   NCollection_IncAllocatorArenas& anArenas = aLauncher.Arenas();
+//!   aLauncher.Perform(0, aNbItems, [&](int theThreadIndex, int theItemIndex) {
+//!     const occ::handle<NCollection_IncAllocator>& anAlloc = anArenas.Allocator(theThreadIndex);
+//!     ...
+//!   });
+//! @endcode
+//! Arenas are created on first request, so that idle threads do not reserve memory.
+//! Memory allocated in one arena may be read by other threads once the job is completed;
+//! it is released by Reset(true) or destruction of the set (and of all handles to the arenas).
+class NCollection_IncAllocatorArenas
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates a set of arenas for thread indices within [theLower, theUpper] range.
+  //! @param theBlockSize size of memory blocks of arenas, see NCollection_IncAllocator
+  Standard_EXPORT NCollection_IncAllocatorArenas(
+    const int    theLower,
+    const int    theUpper,
+    const size_t theBlockSize = NCollection_IncAllocator::THE_DEFAULT_BLOCK_SIZE);
+
+  //! Returns the lower thread index.
+  int Lower() const { return myArenas.Lower(); }
+
+  //! Returns the upper thread index.
+  int Upper() const { return myArenas.Upper(); }
+
+  //! Returns the arena of the thread with the given index, creating it on first call.
+  //! Each index should be used by a single thread at a time.
+  const occ::handle<NCollection_IncAllocator>& Allocator(const int theThreadIndex)
+  {
+    occ::handle<NCollection_IncAllocator>& anArena = myArenas.ChangeValue(theThreadIndex);
+    if (anArena.IsNull())
+    {
+      anArena = new NCollection_IncAllocator(myBlockSize);
+    }
+    return anArena;
+  }
+
+  //! Resets all arenas, see NCollection_IncAllocator::Reset().
+  //! Must not be called concurrently with allocations.
+  //! @param theReleaseMemory True - release memory of arenas, False - preserve it
+  //!                         for future allocations.
+  Standard_EXPORT void Reset(const bool theReleaseMemory = false);
+
+  //! Returns memory usage summed over all arenas.
+  //! Must not be called concurrently with allocations.
+  Standard_EXPORT NCollection_IncAllocator::Statistics GetStatistics() const;
+
+  //! Returns the number of created arenas.
+  Standard_EXPORT int NbArenas() const;
+
+private:
+  NCollection_IncAllocatorArenas(const NCollection_IncAllocatorArenas&)            = delete;
+  NCollection_IncAllocatorArenas& operator=(const NCollection_IncAllocatorArenas&) = delete;
+
+private:
+  NCollection_Array1<occ::handle<NCollection_IncAllocator>> myArenas;    //!< arenas of threads
+  size_t                                                    myBlockSize; //!< block size of arenas
+};
+
+#endif
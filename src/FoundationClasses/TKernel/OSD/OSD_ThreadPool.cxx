@@ -21,6 +21,12 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(OSD_ThreadPool, Standard_Transient)
 
+namespace
+{
+//! Launcher whose job is performed by the calling thread.
+thread_local OSD_ThreadPool::Launcher* THE_CURRENT_LAUNCHER = nullptr;
+} // namespace
+
 //=================================================================================================
 
 bool OSD_ThreadPool::EnumeratedThread::Lock()
@@ -37,15 +43,19 @@ void OSD_ThreadPool::EnumeratedThread::Free()
 
 //=================================================================================================
 
-void OSD_ThreadPool::EnumeratedThread::WakeUp(JobInterface* theJob, bool theToCatchFpe)
+void OSD_ThreadPool::EnumeratedThread::WakeUp(Launcher*     theLauncher,
+                                              JobInterface* theJob,
+                                              bool          theToCatchFpe)
 {
+  myLauncher   = theLauncher;
   myJob        = theJob;
   myToCatchFpe = theToCatchFpe;
   if (myIsSelfThread)
   {
+    myFailure.reset();
     if (theJob != nullptr)
     {
-      OSD_ThreadPool::performJob(myFailure, myJob, myThreadIndex);
+      OSD_ThreadPool::performJob(myFailure, myLauncher, myJob, myThreadIndex);
     }
     return;
   }
@@ -81,7 +91,9 @@ const occ::handle<OSD_ThreadPool>& OSD_ThreadPool::DefaultPool(int theNbThreads)
 
 OSD_ThreadPool::OSD_ThreadPool(int theNbThreads)
     : myNbDefThreads(0),
-      myShutDown(false)
+      myShutDown(false),
+      myPublished(nullptr),
+      myNbPublished(0)
 {
   Init(theNbThreads);
   myNbDefThreads = NbThreads();
@@ -181,7 +193,7 @@ void OSD_ThreadPool::release()
   for (NCollection_Array1<EnumeratedThread>::Iterator aThreadIter(myThreads); aThreadIter.More();
        aThreadIter.Next())
   {
-    aThreadIter.ChangeValue().WakeUp(nullptr, false);
+    aThreadIter.ChangeValue().WakeUp(nullptr, nullptr, false);
     aThreadIter.ChangeValue().Wait();
   }
 }
@@ -190,6 +202,12 @@ void OSD_ThreadPool::release()
 
 void OSD_ThreadPool::Launcher::perform(JobInterface& theJob)
 {
+  myJob = &theJob;
+  myNbActive.store(myFirstHelper + 1);
+  if (myNbHelperSlots > 0)
+  {
+    myPool->publish(*this);
+  }
   run(theJob);
   wait();
 }
@@ -203,7 +221,7 @@ void OSD_ThreadPool::Launcher::run(JobInterface& theJob)
        aThreadIter.More() && aThreadIter.Value() != nullptr;
        aThreadIter.Next())
   {
-    aThreadIter.ChangeValue()->WakeUp(&theJob, toCatchFpe);
+    aThreadIter.ChangeValue()->WakeUp(this, &theJob, toCatchFpe);
   }
 }
 
@@ -211,7 +229,15 @@ void OSD_ThreadPool::Launcher::run(JobInterface& theJob)
 
 void OSD_ThreadPool::Launcher::wait()
 {
-  int aNbFailures = 0;
+  // the self-thread has completed its part of the job
+  myPool->finishJob(*this);
+  myPool->helpJobs(*this);
+  if (myNbHelperSlots > 0)
+  {
+    myPool->unpublish(*this);
+  }
+
+  int aNbFailures = myHelperFailures.Extent();
   for (NCollection_Array1<EnumeratedThread*>::Iterator aThreadIter(myThreads);
        aThreadIter.More() && aThreadIter.Value() != nullptr;
        aThreadIter.Next())
@@ -226,6 +252,12 @@ void OSD_ThreadPool::Launcher::wait()
   {
     return;
   }
+  else if (aNbFailures == 1 && !myHelperFailures.IsEmpty())
+  {
+    const Standard_ProgramError aFailure = myHelperFailures.First();
+    myHelperFailures.Clear();
+    throw aFailure;
+  }
 
   TCollection_AsciiString aFailures;
   for (NCollection_Array1<EnumeratedThread*>::Iterator aThreadIter(myThreads);
@@ -247,6 +279,17 @@ void OSD_ThreadPool::Launcher::wait()
       aFailures += aThreadIter.Value()->myFailure->what();
     }
   }
+  for (NCollection_List<Standard_ProgramError>::Iterator aFailureIter(myHelperFailures);
+       aFailureIter.More();
+       aFailureIter.Next())
+  {
+    if (!aFailures.IsEmpty())
+    {
+      aFailures += "\n";
+    }
+    aFailures += aFailureIter.Value().what();
+  }
+  myHelperFailures.Clear();
 
   aFailures = TCollection_AsciiString("Multiple exceptions:\n") + aFailures;
   throw Standard_ProgramError(aFailures.ToCString(), nullptr);
@@ -255,9 +298,24 @@ void OSD_ThreadPool::Launcher::wait()
 //=================================================================================================
 
 void OSD_ThreadPool::performJob(std::optional<Standard_ProgramError>& theFailure,
+                                Launcher*                             theLauncher,
                                 OSD_ThreadPool::JobInterface*         theJob,
                                 int                                   theThreadIndex)
 {
+  // remember the launcher to detect nested launchers created by the job
+  struct CurrentLauncherSentry
+  {
+    CurrentLauncherSentry(Launcher* theCurrent)
+        : myPrevious(THE_CURRENT_LAUNCHER)
+    {
+      THE_CURRENT_LAUNCHER = theCurrent;
+    }
+
+    ~CurrentLauncherSentry() { THE_CURRENT_LAUNCHER = myPrevious; }
+
+    Launcher* myPrevious;
+  } aSentry(theLauncher);
+
   try
   {
     OCC_CATCH_SIGNALS
@@ -299,8 +357,11 @@ void OSD_ThreadPool::EnumeratedThread::performThread()
     if (myJob != nullptr)
     {
       OSD::SetThreadLocalSignal(OSD::SignalMode(), myToCatchFpe);
-      OSD_ThreadPool::performJob(myFailure, myJob, myThreadIndex);
-      myJob = nullptr;
+      OSD_ThreadPool::performJob(myFailure, myLauncher, myJob, myThreadIndex);
+      myPool->finishJob(*myLauncher);
+      myPool->helpJobs(*myLauncher);
+      myJob      = nullptr;
+      myLauncher = nullptr;
     }
     myIdleEvent.Set();
   }
@@ -319,7 +380,16 @@ void* OSD_ThreadPool::EnumeratedThread::runThread(void* theTask)
 
 OSD_ThreadPool::Launcher::Launcher(OSD_ThreadPool& thePool, int theMaxThreads)
     : mySelfThread(true),
-      myNbThreads(0)
+      myNbThreads(0),
+      myPool(&thePool),
+      myRoot(this),
+      myNextPublished(nullptr),
+      myJob(nullptr),
+      myNbActive(0),
+      myFirstHelper(0),
+      myNbHelperSlots(0),
+      myNextHelper(0),
+      myNbHelpers(0)
 {
   const int aNbThreads =
     theMaxThreads > 0 ? std::min(theMaxThreads, thePool.NbThreads())
@@ -347,6 +417,17 @@ OSD_ThreadPool::Launcher::Launcher(OSD_ThreadPool& thePool, int theMaxThreads)
 
   // self thread should be executed last
   myThreads.SetValue(myNbThreads, &mySelfThread);
+  myFirstHelper = myNbThreads;
+
+  // within a job of the same pool, reserve indices for threads joining after their own work
+  Launcher* aParent = THE_CURRENT_LAUNCHER;
+  if (aParent != nullptr && aParent->myPool == &thePool)
+  {
+    myRoot          = aParent->myRoot;
+    myNbHelperSlots = aNbThreads - 1 - myNbThreads;
+    myNbThreads += myNbHelperSlots;
+  }
+
   mySelfThread.myThreadIndex = myNbThreads;
   ++myNbThreads;
 }
@@ -369,3 +450,96 @@ void OSD_ThreadPool::Launcher::Release()
   myThreads.Move(anEmpty);
   myNbThreads = 0;
 }
+
+//=================================================================================================
+
+void OSD_ThreadPool::publish(Launcher& theLauncher)
+{
+  std::lock_guard<std::mutex> aLock(myPublishMutex);
+  theLauncher.myNextHelper    = theLauncher.myFirstHelper;
+  theLauncher.myNbHelpers     = 0;
+  theLauncher.myNextPublished = myPublished;
+  myPublished                 = &theLauncher;
+  myNbPublished.fetch_add(1);
+  myPublishCond.notify_all();
+}
+
+//=================================================================================================
+
+void OSD_ThreadPool::unpublish(Launcher& theLauncher)
+{
+  std::unique_lock<std::mutex> aLock(myPublishMutex);
+  for (Launcher** aLauncherPtr = &myPublished; *aLauncherPtr != nullptr;
+       aLauncherPtr            = &(*aLauncherPtr)->myNextPublished)
+  {
+    if (*aLauncherPtr == &theLauncher)
+    {
+      *aLauncherPtr = theLauncher.myNextPublished;
+      break;
+    }
+  }
+  theLauncher.myNextPublished = nullptr;
+  myNbPublished.fetch_sub(1);
+  myPublishCond.wait(aLock, [&theLauncher]() { return theLauncher.myNbHelpers == 0; });
+}
+
+//=================================================================================================
+
+void OSD_ThreadPool::finishJob(Launcher& theLauncher)
+{
+  if (theLauncher.myNbActive.fetch_sub(1) == 1 && theLauncher.myFirstHelper > 0)
+  {
+    // wake up locked threads of the launcher waiting in helpJobs()
+    std::lock_guard<std::mutex> aLock(myPublishMutex);
+    myPublishCond.notify_all();
+  }
+}
+
+//=================================================================================================
+
+void OSD_ThreadPool::helpJobs(Launcher& theLauncher)
+{
+  if (myNbPublished.load() == 0 && theLauncher.myNbActive.load() == 0)
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> aLock(myPublishMutex);
+  for (;;)
+  {
+    Launcher* aTarget = myPublished;
+    for (; aTarget != nullptr; aTarget = aTarget->myNextPublished)
+    {
+      if (aTarget != &theLauncher && aTarget->myRoot == theLauncher.myRoot
+          && aTarget->myNextHelper < aTarget->myFirstHelper + aTarget->myNbHelperSlots)
+      {
+        break;
+      }
+    }
+    if (aTarget == nullptr)
+    {
+      if (theLauncher.myNbActive.load() == 0)
+      {
+        return;
+      }
+      myPublishCond.wait(aLock);
+      continue;
+    }
+
+    // join the job using one of the reserved thread indices
+    const int aThreadIndex = aTarget->myNextHelper++;
+    ++aTarget->myNbHelpers;
+    aLock.unlock();
+    std::optional<Standard_ProgramError> aFailure;
+    performJob(aFailure, aTarget, aTarget->myJob, aThreadIndex);
+    aLock.lock();
+    if (aFailure)
+    {
+      aTarget->myHelperFailures.Append(*aFailure);
+    }
+    if (--aTarget->myNbHelpers == 0)
+    {
+      myPublishCond.notify_all();
+    }
+  }
+}
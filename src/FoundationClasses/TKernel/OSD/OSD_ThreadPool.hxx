@@ -16,12 +16,19 @@
 #define _OSD_ThreadPool_HeaderFile
 
 #include <NCollection_Array1.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <NCollection_IncAllocatorArenas.hxx>
+#include <NCollection_List.hxx>
 #include <OSD_Thread.hxx>
 #include <Standard_Condition.hxx>
 
 #include <Standard_ProgramError.hxx>
 
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 //! Class defining a thread pool for executing algorithms in multi-threaded mode.
@@ -51,6 +58,10 @@
 //!   and Launcher constructor, so that single Launcher instance will occupy not all threads
 //!   in the pool allowing other threads to be used concurrently.
 //! - OSD_ThreadPool::Launcher locks thread one-by-one from thread pool in a thread-safe way.
+//! - Launcher created within a job of another Launcher of the same pool (nested parallelism)
+//!   usually finds no free threads; instead of running sequentially, it publishes its job
+//!   so that threads of the enclosing jobs, which have completed their own part of work,
+//!   join it while waiting for the enclosing job to be finished.
 //! - Each working thread catches exceptions occurred during job execution, and Launcher will
 //!   throw Standard_Failure in a caller thread on completed execution.
 class OSD_ThreadPool : public Standard_Transient
@@ -101,6 +112,9 @@ public:
   //! Should be called only with no active jobs, or exception Standard_ProgramError will be thrown!
   Standard_EXPORT void Init(int theNbThreads);
 
+public:
+  class Launcher;
+
 protected:
   //! Thread function interface.
   class JobInterface
@@ -118,6 +132,7 @@ protected:
     //! Main constructor.
     EnumeratedThread(bool theIsSelfThread = false)
         : myPool(nullptr),
+          myLauncher(nullptr),
           myJob(nullptr),
           myWakeEvent(false),
           myIdleEvent(false),
@@ -137,8 +152,8 @@ protected:
     //! OccupyThread().
     Standard_EXPORT void Free();
 
-    //! Wake up the thread.
-    Standard_EXPORT void WakeUp(JobInterface* theJob, bool theToCatchFpe);
+    //! Wake up the thread to perform the job of the launcher.
+    Standard_EXPORT void WakeUp(Launcher* theLauncher, JobInterface* theJob, bool theToCatchFpe);
 
     //! Wait the thread going into Idle state (finished jobs).
     Standard_EXPORT void WaitIdle();
@@ -148,6 +163,7 @@ protected:
     EnumeratedThread(const EnumeratedThread& theCopy)
         : OSD_Thread(theCopy),
           myPool(nullptr),
+          myLauncher(nullptr),
           myJob(nullptr),
           myWakeEvent(false),
           myIdleEvent(false),
@@ -172,6 +188,7 @@ protected:
     {
       OSD_Thread::Assign(theCopy);
       myPool         = theCopy.myPool;
+      myLauncher     = theCopy.myLauncher;
       myJob          = theCopy.myJob;
       myThreadIndex  = theCopy.myThreadIndex;
       myToCatchFpe   = theCopy.myToCatchFpe;
@@ -187,6 +204,7 @@ protected:
 
   private:
     OSD_ThreadPool*                      myPool;
+    Launcher*                            myLauncher;
     JobInterface*                        myJob;
     std::optional<Standard_ProgramError> myFailure;
     Standard_Condition                   myWakeEvent;
@@ -203,11 +221,16 @@ public:
   //! in a thread pool to perform parallel execution of the job.
   class Launcher
   {
+    friend class OSD_ThreadPool;
+
   public:
     //! Lock specified number of threads from the thread pool.
     //! If thread pool is already locked by another user,
     //! Launcher will lock as many threads as possible
     //! (if none will be locked, then single threaded execution will be done).
+    //! Launcher created within a job of the same pool reserves thread indices
+    //! for the threads which might join its job after completing their own work,
+    //! so that it may report more threads than it has actually locked.
     //! @param thePool       thread pool to lock the threads
     //! @param theMaxThreads number of threads to lock;
     //!                      -1 specifies that default number of threads
@@ -217,11 +240,11 @@ public:
     //! Release threads.
     ~Launcher() { Release(); }
 
-    //! Return TRUE if at least 2 threads have been locked for parallel execution (including
-    //! self-thread); otherwise, the functor will be executed within the caller thread.
+    //! Return TRUE if at least 2 threads have been locked (or reserved) for parallel execution
+    //! (including self-thread); otherwise, the functor will be executed within the caller thread.
     bool HasThreads() const { return myNbThreads >= 2; }
 
-    //! Return amount of locked threads; >= 1.
+    //! Return amount of locked (or reserved) threads; >= 1.
     int NbThreads() const { return myNbThreads; }
 
     //! Return the lower thread index.
@@ -230,6 +253,27 @@ public:
     //! Return the upper thread index (last index is reserved for the self-thread).
     int UpperThreadIndex() const { return LowerThreadIndex() + myNbThreads - 1; }
 
+    //! Return the set of arenas, one per thread index of this launcher,
+    //! so that a job may allocate temporary data taking no lock:
+    //! @code
+    //!   NCollection_IncAllocatorArenas& anArenas = aLauncher.Arenas();
+    //!   aLauncher.Perform(0, aNbItems, [&](int theThreadIndex, int theItemIndex) {
+    //!     const occ::handle<NCollection_IncAllocator>& anAlloc =
+    //!       anArenas.Allocator(theThreadIndex);
+    //!   });
+    //! @endcode
+    //! The set is created on first call, which should be done before Perform().
+    //! Memory of the arenas remains valid for subsequent jobs of the launcher;
+    //! it is released with the launcher unless referred by handles to the arenas.
+    NCollection_IncAllocatorArenas& Arenas()
+    {
+      if (!myArenas)
+      {
+        myArenas.reset(new NCollection_IncAllocatorArenas(LowerThreadIndex(), UpperThreadIndex()));
+      }
+      return *myArenas;
+    }
+
     //! Simple primitive for parallelization of "for" loops, e.g.:
     //! @code
     //!   for (int anIter = theBegin; anIter < theEnd; ++anIter) {}
@@ -239,11 +283,13 @@ public:
     //! @param theFunctor functor providing an interface
     //!                   "void operator(int theThreadIndex, int theDataIndex){}" performing task
     //!                   for specified index
+    //! @param theGrainSize number of consecutive indices taken by a thread at once;
+    //!                   values greater than 1 reduce synchronization for cheap functors
     template <typename Functor>
-    void Perform(int theBegin, int theEnd, const Functor& theFunctor)
+    void Perform(int theBegin, int theEnd, const Functor& theFunctor, int theGrainSize = 1)
     {
       JobRange     aData(theBegin, theEnd);
-      Job<Functor> aJob(theFunctor, aData);
+      Job<Functor> aJob(theFunctor, aData, theGrainSize);
       perform(aJob);
     }
 
@@ -269,7 +315,82 @@ public:
     NCollection_Array1<EnumeratedThread*> myThreads; //!< array of locked threads (including self-thread)
     // clang-format on
     EnumeratedThread mySelfThread;
-    int              myNbThreads; //!< amount of locked threads
+    int              myNbThreads; //!< amount of locked and reserved threads
+
+    OSD_ThreadPool*  myPool;          //!< thread pool
+    Launcher*        myRoot;          //!< outermost launcher of nested ones (this if not nested)
+    Launcher*        myNextPublished; //!< next launcher in the list of published ones
+    JobInterface*    myJob;           //!< job being performed
+    std::atomic<int> myNbActive;      //!< number of locked threads performing the job
+    int              myFirstHelper;   //!< thread index of the first joining thread
+    int              myNbHelperSlots; //!< number of thread indices reserved for joining threads
+    int              myNextHelper;    //!< thread index of the next joining thread
+    int              myNbHelpers;     //!< number of joined threads performing the job
+    NCollection_List<Standard_ProgramError> myHelperFailures; //!< failures of joined threads
+    //! arenas of thread indices, see Arenas()
+    std::unique_ptr<NCollection_IncAllocatorArenas> myArenas;
+  };
+
+  //! Deferred batch of tasks executed in parallel by threads of the pool.
+  //! Run() only appends the task to the batch: no task is started before Wait(),
+  //! which executes the whole batch as a single Launcher job and returns when all tasks
+  //! are completed; the group may be reused afterwards.
+  //! Threads take the next task from the shared range of the job, there are no per-thread
+  //! queues and no work stealing; therefore tasks should not depend on each other
+  //! and a task may not wait for completion of another task of the same batch.
+  //! Wait() called within a job of the same pool lets the threads of enclosing jobs
+  //! take part in execution of the tasks (see nested Launcher).
+  class TaskGroup
+  {
+  public:
+    //! Creates an empty group.
+    //! @param thePool       thread pool executing the tasks
+    //! @param theMaxThreads maximum number of threads, -1 for
+    //!                      OSD_ThreadPool::NbDefaultThreadsToLaunch()
+    TaskGroup(OSD_ThreadPool& thePool, int theMaxThreads = -1)
+        : myPool(thePool),
+          myMaxThreads(theMaxThreads)
+    {
+    }
+
+    //! Appends the task, a functor with interface "void operator()()", to the batch;
+    //! the task is not started until Wait().
+    template <typename Task>
+    void Run(const Task& theTask)
+    {
+      myTasks.Append(std::function<void()>(theTask));
+    }
+
+    //! Returns number of tasks appended since the last Wait().
+    int NbTasks() const { return static_cast<int>(myTasks.Size()); }
+
+    //! Starts execution of the batch and waits for completion of all its tasks.
+    //! Exceptions of tasks are re-thrown as by Launcher.
+    void Wait()
+    {
+      if (myTasks.IsEmpty())
+      {
+        return;
+      }
+
+      NCollection_DynamicArray<std::function<void()>> aTasks(std::move(myTasks));
+      myTasks.Clear();
+      const int aNbTasks   = static_cast<int>(aTasks.Size());
+      const int aNbThreads = std::min(aNbTasks,
+                                      myMaxThreads > 0 ? myMaxThreads
+                                                       : myPool.NbDefaultThreadsToLaunch());
+      Launcher  aLauncher(myPool, aNbThreads);
+      aLauncher.Perform(0, aNbTasks, [&aTasks](int, int theTaskIndex) { aTasks[theTaskIndex](); });
+    }
+
+  private:
+    TaskGroup(const TaskGroup& theCopy)            = delete;
+    TaskGroup& operator=(const TaskGroup& theCopy) = delete;
+
+  private:
+    OSD_ThreadPool&                                 myPool;       //!< thread pool
+    int                                             myMaxThreads; //!< maximum number of threads
+    NCollection_DynamicArray<std::function<void()>> myTasks;      //!< tasks waiting for execution
   };
 
 protected:
@@ -291,9 +412,10 @@ protected:
     //! Returns const link on the last element.
     const int& End() const { return myEnd; }
 
-    //! Returns first non processed element or end.
+    //! Returns first non processed element or end, reserving theNbElements
+    //! consecutive elements starting from it.
     //! Thread-safe method.
-    int It() const { return myIt.fetch_add(1); }
+    int It(const int theNbElements = 1) const { return myIt.fetch_add(theNbElements); }
 
   private:
     JobRange(const JobRange& theCopy)            = delete;
@@ -311,18 +433,25 @@ protected:
   {
   public:
     //! Constructor.
-    Job(const FunctorT& thePerformer, JobRange& theRange)
+    Job(const FunctorT& thePerformer, JobRange& theRange, const int theGrainSize = 1)
         : myPerformer(thePerformer),
-          myRange(theRange)
+          myRange(theRange),
+          myGrainSize(std::max(theGrainSize, 1))
     {
     }
 
     //! Method is executed in the context of thread.
     void Perform(int theThreadIndex) override
     {
-      for (int anIter = myRange.It(); anIter < myRange.End(); anIter = myRange.It())
+      for (int aBegin = myRange.It(myGrainSize); aBegin < myRange.End();
+           aBegin     = myRange.It(myGrainSize))
       {
-        myPerformer(theThreadIndex, anIter);
+        const int anEnd =
+          myRange.End() - aBegin > myGrainSize ? aBegin + myGrainSize : myRange.End();
+        for (int anIter = aBegin; anIter < anEnd; ++anIter)
+        {
+          myPerformer(theThreadIndex, anIter);
+        }
       }
     }
 
@@ -333,16 +462,31 @@ protected:
   private:                       //! @name private fields
     const FunctorT& myPerformer; //!< Link on functor
     const JobRange& myRange;     //!< Link on processed data block
+    const int       myGrainSize; //!< Number of elements taken at once
   };
 
   //! Release threads.
   void release();
 
-  //! Perform the job and catch exceptions.
+  //! Perform the job of the launcher and catch exceptions.
   static void performJob(std::optional<Standard_ProgramError>& theFailure,
+                         Launcher*                             theLauncher,
                          OSD_ThreadPool::JobInterface*         theJob,
                          int                                   theThreadIndex);
 
+  //! Publish the job of the nested launcher so that other threads can join it.
+  void publish(Launcher& theLauncher);
+
+  //! Withdraw the job of the nested launcher and wait for the joined threads.
+  void unpublish(Launcher& theLauncher);
+
+  //! Mark that one of the locked threads of the launcher has completed its job.
+  void finishJob(Launcher& theLauncher);
+
+  //! Join published jobs of the same nested hierarchy
+  //! until all locked threads of the launcher complete its job.
+  void helpJobs(Launcher& theLauncher);
+
 private:
   //! This method should not be called (prohibited).
   OSD_ThreadPool(const OSD_ThreadPool& theCopy) = delete;
@@ -355,6 +499,11 @@ private:
   // clang-format on
   int  myNbDefThreads; //!< maximum number of threads to be locked by a single Launcher by default
   bool myShutDown;     //!< flag to shut down (destroy) the thread pool
+
+  std::mutex              myPublishMutex; //!< lock of the list of published launchers
+  std::condition_variable myPublishCond;  //!< signals changes of published launchers and jobs
+  Launcher*               myPublished;    //!< list of published launchers
+  std::atomic<int>        myNbPublished;  //!< number of published launchers
 };
 
 #endif // _OSD_ThreadPool_HeaderFile
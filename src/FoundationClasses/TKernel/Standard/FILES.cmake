@@ -50,6 +50,8 @@ set(OCCT_Standard_FILES
   Standard_MMgrOpt.hxx
   Standard_MMgrRoot.cxx
   Standard_MMgrRoot.hxx
+  Standard_MMgrThreadCache.cxx
+  Standard_MMgrThreadCache.hxx
   Standard_MultiplyDefined.hxx
   Standard_Mutex.cxx
   Standard_Mutex.hxx
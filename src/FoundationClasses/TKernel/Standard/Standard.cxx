@@ -75,6 +75,7 @@ static Standard::AllocatorType& allocatorTypeInstance()
 // - OCCT_MMGT_OPT_JEMALLOC, using external jecalloc, jefree
 #ifdef OCCT_MMGT_OPT_FLEXIBLE
   #include <Standard_MMgrOpt.hxx>
+  #include <Standard_MMgrThreadCache.hxx>
   #include <Standard_Assert.hxx>
 
   // There is no support for environment variables in UWP
@@ -295,6 +296,15 @@ Standard_MMgrFactory::Standard_MMgrFactory()
     case 2: // TBB memory allocator
       myFMMgr = new Standard_MMgrTBBalloc(toClear);
       break;
+    case 4: // OCCT memory allocator with per-thread caches
+    {
+      aVar           = getenv("MMGT_CELLSIZE");
+      int aCellSize  = (aVar ? atoi(aVar) : 512);
+      aVar           = getenv("MMGT_BATCHSIZE");
+      int aBatchSize = (aVar ? atoi(aVar) : 64);
+      myFMMgr        = new Standard_MMgrThreadCache(toClear, aCellSize, aBatchSize);
+      break;
+    }
     case 0:
     default: // system default memory allocator
       myFMMgr = new Standard_MMgrRaw(toClear);
@@ -368,6 +378,21 @@ Standard::AllocatorType Standard::GetAllocatorType()
 
 //=================================================================================================
 
+bool Standard::GetAllocatorStatistics(AllocatorStatistics& theStats)
+{
+#ifdef OCCT_MMGT_OPT_FLEXIBLE
+  if (allocatorTypeInstance() == AllocatorType::THREAD_CACHING)
+  {
+    static_cast<Standard_MMgrThreadCache*>(Standard_MMgrFactory::GetMMgr())->Statistics(theStats);
+    return true;
+  }
+#endif // OCCT_MMGT_OPT_FLEXIBLE
+  (void)theStats;
+  return false;
+}
+
+//=================================================================================================
+
 void* Standard::Allocate(const size_t theSize)
 {
 #ifdef OCCT_MMGT_OPT_FLEXIBLE
@@ -31,15 +31,35 @@ public:
   //! Enumiration of possible allocator types
   enum class AllocatorType
   {
-    NATIVE   = 0,
-    OPT      = 1,
-    TBB      = 2,
-    JEMALLOC = 3
+    NATIVE         = 0,
+    OPT            = 1,
+    TBB            = 2,
+    JEMALLOC       = 3,
+    THREAD_CACHING = 4
+  };
+
+  //! Statistics of the memory manager, see GetAllocatorStatistics().
+  struct AllocatorStatistics
+  {
+    size_t ReservedBytes      = 0; //!< memory reserved for small blocks
+    size_t NbSmallAllocations = 0; //!< number of allocated small blocks
+    size_t NbSmallFrees       = 0; //!< number of freed small blocks
+    size_t NbLargeAllocations = 0; //!< number of allocated large blocks
+    size_t NbLargeFrees       = 0; //!< number of freed large blocks
+    size_t LargeBytes         = 0; //!< memory of large blocks in use
+    size_t NbRefills          = 0; //!< number of batches of blocks moved to caches of threads
+    size_t NbSpills           = 0; //!< number of batches of blocks returned by caches of threads
+    size_t NbThreadCaches     = 0; //!< number of caches of live threads
   };
 
   //! Returns default allocator type
   Standard_EXPORT static AllocatorType GetAllocatorType();
 
+  //! Fills statistics of the active memory manager.
+  //! Returns FALSE if the active memory manager does not collect statistics;
+  //! currently only AllocatorType::THREAD_CACHING (MMGT_OPT=4) does.
+  Standard_EXPORT static bool GetAllocatorStatistics(AllocatorStatistics& theStats);
+
   //! Allocates memory blocks
   //! theSize - bytes to  allocate
   Standard_EXPORT static void* Allocate(const size_t theSize);
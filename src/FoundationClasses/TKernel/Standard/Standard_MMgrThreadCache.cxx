@@ -0,0 +1,534 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+
+#include <Standard_OutOfMemory.hxx>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+//! Size of the header preceding each block, keeping blocks aligned to 16 bytes.
+//! The first word holds size class + 1 of a small block or 0 for a large block,
+//! the second one holds the requested size of a large block.
+constexpr size_t THE_HEADER_SIZE = 16;
+
+//! Minimal size of memory chunk carved into small blocks.
+constexpr size_t THE_CHUNK_SIZE = 65536;
+
+//! Returns size class of the small block of the given size.
+inline size_t classIndex(const size_t theSize)
+{
+  return theSize != 0 ? (theSize - 1) >> 4 : 0;
+}
+
+//! Returns usable size of blocks of the given size class.
+inline size_t classSize(const size_t theClass)
+{
+  return (theClass + 1) << 4;
+}
+
+//! Returns header of the block.
+inline size_t* blockHeader(void* theBlock)
+{
+  return reinterpret_cast<size_t*>(static_cast<char*>(theBlock) - THE_HEADER_SIZE);
+}
+
+//! Returns the next block in the free list; the link is stored in the block itself.
+inline void*& nextBlock(void* theBlock)
+{
+  return *static_cast<void**>(theBlock);
+}
+
+//! Returns the last block of the list of the given length.
+inline void* lastBlock(void* theFirst, const size_t theNbBlocks)
+{
+  void* aLast = theFirst;
+  for (size_t aBlockIter = 1; aBlockIter < theNbBlocks; ++aBlockIter)
+  {
+    aLast = nextBlock(aLast);
+  }
+  return aLast;
+}
+
+//! Caches of the calling thread (list of Standard_MMgrThreadCache::ThreadCache),
+//! one per memory manager used by the thread.
+thread_local void* THE_THREAD_CACHES = nullptr;
+
+//! Flag indicating that the calling thread is exiting and has released its caches.
+thread_local bool THE_IS_THREAD_EXITED = false;
+} // namespace
+
+//! Free list of a size class.
+struct Standard_MMgrThreadCache_FreeList
+{
+  void*  Head  = nullptr;
+  size_t Count = 0;
+};
+
+//! Cache of free blocks of a thread.
+struct Standard_MMgrThreadCache::ThreadCache
+{
+  Standard_MMgrThreadCache*          Owner;        //!< manager, NULL if destroyed
+  ThreadCache*                       NextInThread; //!< next cache of the same thread
+  ThreadCache*                       PrevInOwner;  //!< previous cache of the same manager
+  ThreadCache*                       NextInOwner;  //!< next cache of the same manager
+  size_t                             NbAllocs;     //!< allocations not yet flushed to manager
+  size_t                             NbFrees;      //!< deallocations not yet flushed to manager
+  Standard_MMgrThreadCache_FreeList* Lists;        //!< free lists of size classes
+};
+
+//! Shared pool of free blocks of a size class.
+struct Standard_MMgrThreadCache::ClassPool
+{
+  std::mutex Mutex;
+  void*      Head  = nullptr;
+  size_t     Count = 0;
+};
+
+//! Releases caches of the thread on its exit.
+struct Standard_MMgrThreadCacheGuard
+{
+  ~Standard_MMgrThreadCacheGuard()
+  {
+    void* aFirst         = THE_THREAD_CACHES;
+    THE_THREAD_CACHES    = nullptr;
+    THE_IS_THREAD_EXITED = true;
+    Standard_MMgrThreadCache::releaseThreadCaches(
+      static_cast<Standard_MMgrThreadCache::ThreadCache*>(aFirst));
+  }
+};
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::Standard_MMgrThreadCache(const bool   theToClear,
+                                                   const size_t theCellSize,
+                                                   const int    theBatchSize)
+    : myClear(theToClear),
+      myCellSize(classSize(classIndex(std::max(theCellSize, size_t(16))))),
+      myNbClasses(classIndex(myCellSize) + 1),
+      myBatchSize(std::max(theBatchSize, 1)),
+      myPools(new ClassPool[myNbClasses]),
+      myChunks(nullptr),
+      myCaches(nullptr),
+      myReservedBytes(0),
+      myNbSmallAllocs(0),
+      myNbSmallFrees(0),
+      myNbLargeAllocs(0),
+      myNbLargeFrees(0),
+      myLargeBytes(0),
+      myNbRefills(0),
+      myNbSpills(0),
+      myNbThreadCaches(0)
+{
+}
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::~Standard_MMgrThreadCache()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  // caches remain in the lists of their threads and are released on thread exit
+  for (ThreadCache* aCache = myCaches; aCache != nullptr; aCache = aCache->NextInOwner)
+  {
+    aCache->Owner = nullptr;
+  }
+  myCaches = nullptr;
+
+  for (void* aChunk = myChunks; aChunk != nullptr;)
+  {
+    void* aNext = nextBlock(aChunk);
+    free(aChunk);
+    aChunk = aNext;
+  }
+  myChunks = nullptr;
+  delete[] myPools;
+}
+
+//=================================================================================================
+
+void* Standard_MMgrThreadCache::Allocate(const size_t theSize)
+{
+  if (theSize > myCellSize)
+  {
+    const size_t aSize   = THE_HEADER_SIZE + theSize;
+    size_t*      aHeader = static_cast<size_t*>(myClear ? calloc(aSize, sizeof(char))
+                                                        : malloc(aSize));
+    if (aHeader == nullptr)
+    {
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    }
+    aHeader[0] = 0;
+    aHeader[1] = theSize;
+    myNbLargeAllocs.fetch_add(1, std::memory_order_relaxed);
+    myLargeBytes.fetch_add(theSize, std::memory_order_relaxed);
+    return reinterpret_cast<char*>(aHeader) + THE_HEADER_SIZE;
+  }
+
+  const size_t aClass = classIndex(theSize);
+  void*        aBlock = nullptr;
+  if (ThreadCache* aCache = threadCache())
+  {
+    Standard_MMgrThreadCache_FreeList& aList = aCache->Lists[aClass];
+    if (aList.Head == nullptr)
+    {
+      refill(aCache, aClass);
+    }
+    aBlock     = aList.Head;
+    aList.Head = nextBlock(aBlock);
+    --aList.Count;
+    ++aCache->NbAllocs;
+  }
+  else
+  {
+    aBlock = allocateShared(aClass);
+  }
+
+  if (myClear)
+  {
+    memset(aBlock, 0, classSize(aClass));
+  }
+  return aBlock;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::Free(void* thePtr)
+{
+  if (thePtr == nullptr)
+  {
+    return;
+  }
+
+  size_t* aHeader = blockHeader(thePtr);
+  if (aHeader[0] == 0)
+  {
+    myNbLargeFrees.fetch_add(1, std::memory_order_relaxed);
+    myLargeBytes.fetch_sub(aHeader[1], std::memory_order_relaxed);
+    free(aHeader);
+    return;
+  }
+
+  const size_t aClass = aHeader[0] - 1;
+  if (ThreadCache* aCache = threadCache())
+  {
+    Standard_MMgrThreadCache_FreeList& aList = aCache->Lists[aClass];
+    nextBlock(thePtr)                        = aList.Head;
+    aList.Head                               = thePtr;
+    ++aList.Count;
+    ++aCache->NbFrees;
+    if (aList.Count >= 2 * size_t(myBatchSize))
+    {
+      spill(aCache, aClass);
+    }
+  }
+  else
+  {
+    freeShared(thePtr, aClass);
+  }
+}
+
+//=================================================================================================
+
+void* Standard_MMgrThreadCache::Reallocate(void* thePtr, const size_t theSize)
+{
+  if (thePtr == nullptr)
+  {
+    return Allocate(theSize);
+  }
+
+  size_t* aHeader = blockHeader(thePtr);
+  if (aHeader[0] == 0)
+  {
+    // large block remains large
+    const size_t anOldSize = aHeader[1];
+    size_t* aNewHeader = static_cast<size_t*>(realloc(aHeader, THE_HEADER_SIZE + theSize));
+    if (aNewHeader == nullptr)
+    {
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Reallocate(): realloc failed");
+    }
+    aNewHeader[1] = theSize;
+    myLargeBytes.fetch_add(theSize, std::memory_order_relaxed);
+    myLargeBytes.fetch_sub(anOldSize, std::memory_order_relaxed);
+    return reinterpret_cast<char*>(aNewHeader) + THE_HEADER_SIZE;
+  }
+
+  const size_t anOldSize = classSize(aHeader[0] - 1);
+  if (theSize <= anOldSize)
+  {
+    return thePtr;
+  }
+
+  void* aNewPtr = Allocate(theSize);
+  memcpy(aNewPtr, thePtr, anOldSize);
+  Free(thePtr);
+  return aNewPtr;
+}
+
+//=================================================================================================
+
+int Standard_MMgrThreadCache::Purge(bool)
+{
+  for (ThreadCache* aCache = static_cast<ThreadCache*>(THE_THREAD_CACHES); aCache != nullptr;
+       aCache              = aCache->NextInThread)
+  {
+    if (aCache->Owner == this)
+    {
+      flush(aCache);
+      break;
+    }
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::Statistics(Standard::AllocatorStatistics& theStats) const
+{
+  theStats.ReservedBytes      = myReservedBytes.load(std::memory_order_relaxed);
+  theStats.NbSmallAllocations = myNbSmallAllocs.load(std::memory_order_relaxed);
+  theStats.NbSmallFrees       = myNbSmallFrees.load(std::memory_order_relaxed);
+  theStats.NbLargeAllocations = myNbLargeAllocs.load(std::memory_order_relaxed);
+  theStats.NbLargeFrees       = myNbLargeFrees.load(std::memory_order_relaxed);
+  theStats.LargeBytes         = myLargeBytes.load(std::memory_order_relaxed);
+  theStats.NbRefills          = myNbRefills.load(std::memory_order_relaxed);
+  theStats.NbSpills           = myNbSpills.load(std::memory_order_relaxed);
+  theStats.NbThreadCaches     = myNbThreadCaches.load(std::memory_order_relaxed);
+}
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::threadCache()
+{
+  ThreadCache* aFirst = static_cast<ThreadCache*>(THE_THREAD_CACHES);
+  for (ThreadCache* aCache = aFirst; aCache != nullptr; aCache = aCache->NextInThread)
+  {
+    if (aCache->Owner == this)
+    {
+      return aCache;
+    }
+  }
+  if (THE_IS_THREAD_EXITED)
+  {
+    return nullptr;
+  }
+
+  // register releasing of caches on thread exit
+  static thread_local Standard_MMgrThreadCacheGuard aGuard;
+  (void)aGuard;
+
+  const size_t aListsSize = myNbClasses * sizeof(Standard_MMgrThreadCache_FreeList);
+  ThreadCache* aCache     = static_cast<ThreadCache*>(malloc(sizeof(ThreadCache) + aListsSize));
+  if (aCache == nullptr)
+  {
+    return nullptr;
+  }
+  aCache->Owner        = this;
+  aCache->NextInThread = aFirst;
+  aCache->PrevInOwner  = nullptr;
+  aCache->NbAllocs     = 0;
+  aCache->NbFrees      = 0;
+  aCache->Lists        = reinterpret_cast<Standard_MMgrThreadCache_FreeList*>(aCache + 1);
+  for (size_t aClassIter = 0; aClassIter < myNbClasses; ++aClassIter)
+  {
+    aCache->Lists[aClassIter].Head  = nullptr;
+    aCache->Lists[aClassIter].Count = 0;
+  }
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    aCache->NextInOwner = myCaches;
+    if (myCaches != nullptr)
+    {
+      myCaches->PrevInOwner = aCache;
+    }
+    myCaches = aCache;
+  }
+  myNbThreadCaches.fetch_add(1, std::memory_order_relaxed);
+  THE_THREAD_CACHES = aCache;
+  return aCache;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::refill(ThreadCache* theCache, const size_t theClass)
+{
+  Standard_MMgrThreadCache_FreeList& aList = theCache->Lists[theClass];
+  ClassPool&                         aPool = myPools[theClass];
+  {
+    std::lock_guard<std::mutex> aLock(aPool.Mutex);
+    if (aPool.Count == 0)
+    {
+      carve(aPool, theClass);
+    }
+    const size_t aNbBlocks = std::min(aPool.Count, size_t(myBatchSize));
+    void*        aLast     = lastBlock(aPool.Head, aNbBlocks);
+    aList.Head             = aPool.Head;
+    aList.Count            = aNbBlocks;
+    aPool.Head             = nextBlock(aLast);
+    aPool.Count -= aNbBlocks;
+    nextBlock(aLast) = nullptr;
+  }
+  myNbRefills.fetch_add(1, std::memory_order_relaxed);
+  myNbSmallAllocs.fetch_add(theCache->NbAllocs, std::memory_order_relaxed);
+  myNbSmallFrees.fetch_add(theCache->NbFrees, std::memory_order_relaxed);
+  theCache->NbAllocs = 0;
+  theCache->NbFrees  = 0;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::spill(ThreadCache* theCache, const size_t theClass)
+{
+  Standard_MMgrThreadCache_FreeList& aList  = theCache->Lists[theClass];
+  void*                              aFirst = aList.Head;
+  void*                              aLast  = lastBlock(aFirst, size_t(myBatchSize));
+  aList.Head                                = nextBlock(aLast);
+  aList.Count -= size_t(myBatchSize);
+
+  ClassPool& aPool = myPools[theClass];
+  {
+    std::lock_guard<std::mutex> aLock(aPool.Mutex);
+    nextBlock(aLast) = aPool.Head;
+    aPool.Head       = aFirst;
+    aPool.Count += size_t(myBatchSize);
+  }
+  myNbSpills.fetch_add(1, std::memory_order_relaxed);
+  myNbSmallAllocs.fetch_add(theCache->NbAllocs, std::memory_order_relaxed);
+  myNbSmallFrees.fetch_add(theCache->NbFrees, std::memory_order_relaxed);
+  theCache->NbAllocs = 0;
+  theCache->NbFrees  = 0;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::flush(ThreadCache* theCache)
+{
+  for (size_t aClassIter = 0; aClassIter < myNbClasses; ++aClassIter)
+  {
+    Standard_MMgrThreadCache_FreeList& aList = theCache->Lists[aClassIter];
+    if (aList.Count == 0)
+    {
+      continue;
+    }
+
+    void*      aLast = lastBlock(aList.Head, aList.Count);
+    ClassPool& aPool = myPools[aClassIter];
+    {
+      std::lock_guard<std::mutex> aLock(aPool.Mutex);
+      nextBlock(aLast) = aPool.Head;
+      aPool.Head       = aList.Head;
+      aPool.Count += aList.Count;
+    }
+    aList.Head  = nullptr;
+    aList.Count = 0;
+  }
+  myNbSmallAllocs.fetch_add(theCache->NbAllocs, std::memory_order_relaxed);
+  myNbSmallFrees.fetch_add(theCache->NbFrees, std::memory_order_relaxed);
+  theCache->NbAllocs = 0;
+  theCache->NbFrees  = 0;
+}
+
+//=================================================================================================
+
+void* Standard_MMgrThreadCache::allocateShared(const size_t theClass)
+{
+  ClassPool&                  aPool = myPools[theClass];
+  std::lock_guard<std::mutex> aLock(aPool.Mutex);
+  if (aPool.Count == 0)
+  {
+    carve(aPool, theClass);
+  }
+  void* aBlock = aPool.Head;
+  aPool.Head   = nextBlock(aBlock);
+  --aPool.Count;
+  myNbSmallAllocs.fetch_add(1, std::memory_order_relaxed);
+  return aBlock;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::freeShared(void* theBlock, const size_t theClass)
+{
+  ClassPool&                  aPool = myPools[theClass];
+  std::lock_guard<std::mutex> aLock(aPool.Mutex);
+  nextBlock(theBlock) = aPool.Head;
+  aPool.Head          = theBlock;
+  ++aPool.Count;
+  myNbSmallFrees.fetch_add(1, std::memory_order_relaxed);
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::carve(ClassPool& thePool, const size_t theClass)
+{
+  const size_t aBlockSize = THE_HEADER_SIZE + classSize(theClass);
+  const size_t aNbBlocks  = std::max(size_t(myBatchSize), THE_CHUNK_SIZE / aBlockSize);
+  const size_t aChunkSize = THE_HEADER_SIZE + aNbBlocks * aBlockSize;
+  char*        aChunk     = static_cast<char*>(malloc(aChunkSize));
+  if (aChunk == nullptr)
+  {
+    throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+  }
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    nextBlock(aChunk) = myChunks;
+    myChunks          = aChunk;
+  }
+  myReservedBytes.fetch_add(aChunkSize, std::memory_order_relaxed);
+
+  // link blocks in the order of addresses
+  for (size_t aBlockIter = aNbBlocks; aBlockIter > 0; --aBlockIter)
+  {
+    char*   aBlock    = aChunk + aBlockIter * aBlockSize + THE_HEADER_SIZE - classSize(theClass);
+    size_t* aHeader   = blockHeader(aBlock);
+    aHeader[0]        = theClass + 1;
+    aHeader[1]        = 0;
+    nextBlock(aBlock) = thePool.Head;
+    thePool.Head      = aBlock;
+  }
+  thePool.Count += aNbBlocks;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::releaseThreadCaches(ThreadCache* theFirst)
+{
+  for (ThreadCache* aCache = theFirst; aCache != nullptr;)
+  {
+    ThreadCache*              aNext   = aCache->NextInThread;
+    Standard_MMgrThreadCache* anOwner = aCache->Owner;
+    if (anOwner != nullptr)
+    {
+      anOwner->flush(aCache);
+      std::lock_guard<std::mutex> aLock(anOwner->myMutex);
+      if (aCache->PrevInOwner != nullptr)
+      {
+        aCache->PrevInOwner->NextInOwner = aCache->NextInOwner;
+      }
+      else
+      {
+        anOwner->myCaches = aCache->NextInOwner;
+      }
+      if (aCache->NextInOwner != nullptr)
+      {
+        aCache->NextInOwner->PrevInOwner = aCache->PrevInOwner;
+      }
+      anOwner->myNbThreadCaches.fetch_sub(1, std::memory_order_relaxed);
+    }
+    free(aCache);
+    aCache = aNext;
+  }
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_MMgrThreadCache_HeaderFile
+#define _Standard_MMgrThreadCache_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_MMgrRoot.hxx>
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief Open CASCADE memory manager with per-thread caches of small blocks.
+ *
+ * Intended for platforms where neither TBB nor jemalloc scalable allocators are available.
+ *
+ * - Small blocks with size less than or equal to theCellSize are grouped into
+ *   size classes with 16 bytes step. Each thread keeps its own free list for every
+ *   size class, so that allocation and deallocation of small blocks take no lock.
+ *   Free lists of threads are refilled from and spilled to the shared pools of
+ *   size classes by batches of theBatchSize blocks; the shared pool is extended
+ *   by carving a new memory chunk when it becomes empty.
+ *
+ * - A block freed by another thread than the one allocated it is simply put into
+ *   the cache of the freeing thread and returns to the shared pool with the next batch,
+ *   so that cross-thread deallocation costs one lock per batch instead of one per block.
+ *
+ * - Large blocks are allocated and freed directly by malloc()/calloc() and free().
+ *
+ * Free lists of a thread are returned to the shared pools when the thread exits.
+ * Memory of small blocks is released to the system only by destructor.
+ *
+ * Size of memory blocks is rounded up to 16 bytes; in addition, 16 bytes are added
+ * at the beginning of each block to hold its size class (or size for large blocks).
+ */
+class Standard_MMgrThreadCache : public Standard_MMgrRoot
+{
+public:
+  //! Constructor. If theToClear is True, the allocated memory will be nullified.
+  //! For description of other parameters, see description of the class above.
+  Standard_EXPORT Standard_MMgrThreadCache(const bool   theToClear   = true,
+                                           const size_t theCellSize  = 512,
+                                           const int    theBatchSize = 64);
+
+  //! Releases memory of all small blocks and detaches caches of threads.
+  Standard_EXPORT ~Standard_MMgrThreadCache() override;
+
+  //! Allocate theSize bytes; see class description above
+  Standard_EXPORT void* Allocate(const size_t theSize) override;
+
+  //! Reallocate previously allocated thePtr to a new size; new address is returned.
+  //! In case that thePtr is null, the function behaves exactly as Allocate.
+  Standard_EXPORT void* Reallocate(void* thePtr, const size_t theSize) override;
+
+  //! Free previously allocated block.
+  Standard_EXPORT void Free(void* thePtr) override;
+
+  //! Returns free lists of the calling thread to the shared pools.
+  //! No memory is released to the system, so the function always returns 0.
+  Standard_EXPORT int Purge(bool isDestroyed) override;
+
+  //! Fills statistics of the memory manager.
+  //! Counters of small blocks include only the operations flushed by the threads,
+  //! which happens at each batch exchange with the shared pools and at thread exit.
+  Standard_EXPORT void Statistics(Standard::AllocatorStatistics& theStats) const;
+
+private:
+  struct ThreadCache;
+  struct ClassPool;
+
+  //! Returns the cache of the calling thread, creating it on first call;
+  //! returns NULL if the thread is exiting and its caches have been already released.
+  ThreadCache* threadCache();
+
+  //! Moves a batch of blocks of the given size class from the shared pool to the cache.
+  void refill(ThreadCache* theCache, const size_t theClass);
+
+  //! Moves a batch of blocks of the given size class from the cache to the shared pool.
+  void spill(ThreadCache* theCache, const size_t theClass);
+
+  //! Moves all blocks and counters of the cache to the shared pools.
+  void flush(ThreadCache* theCache);
+
+  //! Takes one block of the given size class from the shared pool under lock.
+  void* allocateShared(const size_t theClass);
+
+  //! Returns one block of the given size class to the shared pool under lock.
+  void freeShared(void* theBlock, const size_t theClass);
+
+  //! Fills the shared pool of the size class with a new chunk of blocks;
+  //! must be called with the lock of that pool held.
+  void carve(ClassPool& thePool, const size_t theClass);
+
+  //! Releases the caches of the exiting thread.
+  static void releaseThreadCaches(ThreadCache* theFirst);
+
+  friend struct Standard_MMgrThreadCacheGuard;
+
+private:
+  Standard_MMgrThreadCache(const Standard_MMgrThreadCache&)            = delete;
+  Standard_MMgrThreadCache& operator=(const Standard_MMgrThreadCache&) = delete;
+
+private:
+  bool         myClear;     //!< option to clear allocated memory
+  size_t       myCellSize;  //!< maximal size of small blocks
+  size_t       myNbClasses; //!< number of size classes
+  int          myBatchSize; //!< number of blocks moved between a cache and a shared pool at once
+  ClassPool*   myPools;     //!< shared pools of size classes
+  std::mutex   myMutex;     //!< lock of the list of chunks and the list of caches
+  void*        myChunks;    //!< list of memory chunks carved into small blocks
+  ThreadCache* myCaches;    //!< list of caches of threads
+
+  std::atomic<size_t> myReservedBytes;  //!< memory allocated for chunks of small blocks
+  std::atomic<size_t> myNbSmallAllocs;  //!< flushed number of small allocations
+  std::atomic<size_t> myNbSmallFrees;   //!< flushed number of small deallocations
+  std::atomic<size_t> myNbLargeAllocs;  //!< number of large allocations
+  std::atomic<size_t> myNbLargeFrees;   //!< number of large deallocations
+  std::atomic<size_t> myLargeBytes;     //!< memory of large blocks in use
+  std::atomic<size_t> myNbRefills;      //!< number of batches moved to caches
+  std::atomic<size_t> myNbSpills;       //!< number of batches moved to shared pools
+  std::atomic<size_t> myNbThreadCaches; //!< number of live caches of threads
+};
+
+#endif
@@ -291,6 +291,12 @@ public:
     const int IC,
     const int IS) const override;
 
+  //! Sets the flag of parallel computation of the contours.
+  void SetRunParallel(const bool theIsParallel) { myBuilder.SetRunParallel(theIsParallel); }
+
+  //! Returns the flag of parallel computation of the contours.
+  bool RunParallel() const { return myBuilder.RunParallel(); }
+
 private:
   ChFi3d_ChBuilder                                       myBuilder;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myMap;
@@ -379,6 +379,12 @@ public:
   //! ChFiDS_Error: other error different from above
   Standard_EXPORT ChFiDS_ErrorStatus StripeStatus(const int IC) const;
 
+  //! Sets the flag of parallel computation of the contours.
+  void SetRunParallel(const bool theIsParallel) { myBuilder.SetRunParallel(theIsParallel); }
+
+  //! Returns the flag of parallel computation of the contours.
+  bool RunParallel() const { return myBuilder.RunParallel(); }
+
 private:
   ChFi3d_FilBuilder                                      myBuilder;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myMap;
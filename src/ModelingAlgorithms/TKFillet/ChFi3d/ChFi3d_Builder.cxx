@@ -141,6 +141,13 @@ ChFi3d_Builder::~ChFi3d_Builder() = default;
 
 //=================================================================================================
 
+std::unique_ptr<ChFi3d_Builder> ChFi3d_Builder::NewStripeBuilder() const
+{
+  return nullptr;
+}
+
+//=================================================================================================
+
 void ChFi3d_Builder::ExtentAnalyse()
 {
   int nbedges, nbs;
@@ -264,32 +271,35 @@ void ChFi3d_Builder::Compute()
 #endif
 
   // Construction of the stripe of fillet on each stripe.
-  for (itel.Initialize(myListStripe); itel.More(); itel.Next())
+  if (!myRunParallel || !PerformSetOfSurfParallel())
   {
-    itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
-    try
-    {
-      OCC_CATCH_SIGNALS
-      PerformSetOfSurf(itel.ChangeValue());
-    }
-    catch (Standard_Failure const& anException)
+    for (itel.Initialize(myListStripe); itel.More(); itel.Next())
     {
+      itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        PerformSetOfSurf(itel.ChangeValue());
+      }
+      catch (Standard_Failure const& anException)
+      {
 #ifdef OCCT_DEBUG
-      std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
+        std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
 #endif
-      (void)anException;
-      badstripes.Append(itel.Value());
-      done = true;
-      if (itel.Value()->Spine()->ErrorStatus() == ChFiDS_Ok)
+        (void)anException;
+        badstripes.Append(itel.Value());
+        done = true;
+        if (itel.Value()->Spine()->ErrorStatus() == ChFiDS_Ok)
+        {
+          itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
+        }
+      }
+      if (!done)
       {
-        itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
+        badstripes.Append(itel.Value());
       }
+      done = true;
     }
-    if (!done)
-    {
-      badstripes.Append(itel.Value());
-    }
-    done = true;
   }
   done = (badstripes.IsEmpty());
 
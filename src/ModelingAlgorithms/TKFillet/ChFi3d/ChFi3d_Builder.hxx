@@ -36,7 +36,10 @@
 #include <TopAbs_Orientation.hxx>
 #include <TopAbs_State.hxx>
 
+#include <memory>
+
 class TopOpeBRepDS_HDataStructure;
+class TopOpeBRepDS_DataStructure;
 class TopOpeBRepBuild_HBuilder;
 class TopoDS_Edge;
 class ChFiDS_Spine;
@@ -130,6 +133,14 @@ public:
   //! topologic reconstruction.
   Standard_EXPORT void Compute();
 
+  //! Sets the flag of parallel processing of the stripes in Compute().
+  //! The walking of the stripes having no common vertex is then performed concurrently,
+  //! while the filling of corners and the reconstruction remain sequential.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing of the stripes.
+  bool RunParallel() const { return myRunParallel; }
+
   //! returns True if the computation is success
   Standard_EXPORT bool IsDone() const;
 
@@ -399,6 +410,10 @@ protected:
 
   Standard_EXPORT void PerformSetOfKGen(occ::handle<ChFiDS_Stripe>& S, const bool Simul = false);
 
+  //! Returns a copy of this builder computing the stripes in parallel mode,
+  //! or null if the stripes can be computed only sequentially (default).
+  Standard_EXPORT virtual std::unique_ptr<ChFi3d_Builder> NewStripeBuilder() const;
+
   Standard_EXPORT void Trunc(const occ::handle<ChFiDS_SurfData>&   SD,
                              const occ::handle<ChFiDS_Spine>&      Spine,
                              const occ::handle<Adaptor3d_Surface>& S1,
@@ -761,6 +776,7 @@ protected:
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher>          myEdgeFirstFace;
   bool                                                                              done;
   bool                                                                              hasresult;
+  bool                                                                              myRunParallel;
 
 private:
   Standard_EXPORT bool FaceTangency(const TopoDS_Edge&   E0,
@@ -773,6 +789,23 @@ private:
                                                  occ::handle<BRepTopAdaptor_TopolTool>& It2,
                                                  const bool Simul = false);
 
+  //! Computes the stripes of myListStripe in parallel mode:
+  //! the stripes are split into sets of stripes having no common vertex,
+  //! and the stripes of each set are computed concurrently by copies of this builder
+  //! (see NewStripeBuilder()) filling their own data structures.
+  //! These data are then merged into myDS in the order of myListStripe and followed
+  //! by the extremities of each stripe, so that the indices in myDS are the same
+  //! as in sequential mode. Faulty stripes are appended to badstripes in the same order.
+  //! Returns false if nothing is computed because the stripes can not be computed concurrently.
+  Standard_EXPORT bool PerformSetOfSurfParallel();
+
+  //! Appends the shapes, surfaces and curves of theDS computed for the stripe
+  //! to myDS and replaces their indices in the stripe and in theEVIMap merged into myEVIMap.
+  Standard_EXPORT void mergeStripeData(
+    const occ::handle<ChFiDS_Stripe>&                                                        Stripe,
+    const TopOpeBRepDS_DataStructure&                                                        theDS,
+    const NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher>& theEVIMap);
+
   Standard_EXPORT void PerformFilletOnVertex(const int Index);
 
   Standard_EXPORT void PerformSingularCorner(const int Index);
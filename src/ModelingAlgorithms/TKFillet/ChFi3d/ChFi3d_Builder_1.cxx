@@ -340,6 +340,7 @@ static TopOpeBRepDS_BuildTool mkbuildtool()
 
 ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S, const double Ta)
     : done(false),
+      myRunParallel(false),
       myShape(S)
 {
   myDS   = new TopOpeBRepDS_HDataStructure();
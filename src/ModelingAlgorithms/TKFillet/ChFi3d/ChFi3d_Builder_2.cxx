@@ -57,6 +57,8 @@
 #include <Precision.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_Integer.hxx>
 #include <TopAbs.hxx>
 #include <TopAbs_Orientation.hxx>
@@ -70,6 +72,7 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopOpeBRepBuild_HBuilder.hxx>
 #include <TopOpeBRepDS_HDataStructure.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
 namespace
 {
@@ -3970,3 +3973,267 @@ void ChFi3d_Builder::PerformSetOfSurf(occ::handle<ChFiDS_Stripe>& Stripe, const
     ChFi3d_MakeExtremities(Stripe, DStr, myEFMap, tolapp3d, tol2d);
   }
 }
+
+namespace
+{
+//! Results of the stripe computed by a separate builder.
+struct StripeResult
+{
+  //! data structure filled by the computation of the stripe
+  occ::handle<TopOpeBRepDS_HDataStructure> DS;
+  //! indices of surfaces of the stripe (in DS) built on the edges
+  NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher> EVIMap;
+  //! flag of successful walking
+  bool IsDone = false;
+  //! flag of computation interrupted by exception
+  bool IsFailed = false;
+};
+} // namespace
+
+//=================================================================================================
+
+bool ChFi3d_Builder::PerformSetOfSurfParallel()
+{
+  const int aNbStripes = myListStripe.Extent();
+  if (aNbStripes < 2)
+  {
+    return false;
+  }
+  std::unique_ptr<ChFi3d_Builder> aFirstBuilder = NewStripeBuilder();
+  if (!aFirstBuilder)
+  {
+    return false;
+  }
+
+  TopOpeBRepDS_DataStructure&                    DStr = myDS->ChangeDS();
+  NCollection_Array1<occ::handle<ChFiDS_Stripe>> aStripes(1, aNbStripes);
+  int                                            i = 1;
+  for (NCollection_List<occ::handle<ChFiDS_Stripe>>::Iterator itel(myListStripe); itel.More();
+       itel.Next(), i++)
+  {
+    aStripes(i) = itel.Value();
+  }
+
+  // Stripes are grouped into sets of stripes having no common vertex
+  // by greedy coloring in the order of stripes.
+  NCollection_Array1<int> aGroups(1, aNbStripes);
+  int                     aNbGroups = 0;
+  {
+    NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher> aVStripes;
+    NCollection_Array1<int> aGroupStamps(1, aNbStripes);
+    aGroupStamps.Init(0);
+    for (i = 1; i <= aNbStripes; i++)
+    {
+      const occ::handle<ChFiDS_Spine>& aSpine = aStripes(i)->Spine();
+      for (int iedge = 1; iedge <= aSpine->NbEdges(); iedge++)
+      {
+        TopoDS_Vertex aV[2];
+        TopExp::Vertices(aSpine->Edges(iedge), aV[0], aV[1]);
+        for (const TopoDS_Vertex& aVertex : aV)
+        {
+          NCollection_List<int>* aVList = aVStripes.ChangeSeek(aVertex);
+          if (aVList == nullptr)
+          {
+            aVList = aVStripes.Bound(aVertex, NCollection_List<int>());
+          }
+          for (NCollection_List<int>::Iterator aVIter(*aVList); aVIter.More(); aVIter.Next())
+          {
+            if (aVIter.Value() != i)
+            {
+              aGroupStamps(aGroups(aVIter.Value())) = i;
+            }
+          }
+          if (aVList->IsEmpty() || aVList->Last() != i)
+          {
+            aVList->Append(i);
+          }
+        }
+      }
+      int aGroup = 1;
+      while (aGroupStamps(aGroup) == i)
+      {
+        aGroup++;
+      }
+      aGroups(i) = aGroup;
+      aNbGroups  = std::max(aNbGroups, aGroup);
+    }
+  }
+
+  // Stripes of each set are computed concurrently, each one by a copy of this builder
+  // with its own data structure: the indices in these data structures are then
+  // replaced by the ones the sequential computation would give.
+  const occ::handle<OSD_ThreadPool>& aPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aLauncher(*aPool, std::min(aPool->NbDefaultThreadsToLaunch(), aNbStripes));
+  NCollection_Array1<std::unique_ptr<ChFi3d_Builder>> aBuilders(aLauncher.LowerThreadIndex(),
+                                                                aLauncher.UpperThreadIndex());
+  aBuilders.ChangeFirst() = std::move(aFirstBuilder);
+  NCollection_Array1<StripeResult>             aResults(1, aNbStripes);
+  NCollection_Array1<int>                      aGroupStripes(1, aNbStripes);
+  for (int aGroup = 1; aGroup <= aNbGroups; aGroup++)
+  {
+    int aNbGroupStripes = 0;
+    for (i = 1; i <= aNbStripes; i++)
+    {
+      if (aGroups(i) == aGroup)
+      {
+        aGroupStripes(++aNbGroupStripes) = i;
+      }
+    }
+    aLauncher.Perform(1, aNbGroupStripes + 1, [&](const int theThreadIndex, const int theIndex) {
+      std::unique_ptr<ChFi3d_Builder>& aBuilder = aBuilders(theThreadIndex);
+      if (!aBuilder)
+      {
+        aBuilder = NewStripeBuilder();
+      }
+
+      const int                   anIndex = aGroupStripes(theIndex);
+      occ::handle<ChFiDS_Stripe>& Stripe  = aStripes(anIndex);
+      StripeResult&               aResult = aResults(anIndex);
+      aResult.DS                          = new TopOpeBRepDS_HDataStructure();
+      aBuilder->myDS                      = aResult.DS;
+      aBuilder->myEVIMap.Clear();
+      aBuilder->done = true;
+      Stripe->Spine()->SetErrorStatus(ChFiDS_Ok);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        // the same as PerformSetOfSurf() except extremities, which are made after merging
+        const occ::handle<ChFiDS_Spine>& sp = Stripe->Spine();
+        Stripe->SetSolidIndex(ChFi3d_SolidIndex(sp,
+                                                aResult.DS->ChangeDS(),
+                                                aBuilder->myESoMap,
+                                                aBuilder->myEShMap));
+        if (!sp->SplitDone())
+        {
+          aBuilder->PerformSetOfKPart(Stripe);
+        }
+        aBuilder->PerformSetOfKGen(Stripe);
+      }
+      catch (Standard_Failure const&)
+      {
+        aResult.IsFailed = true;
+        if (Stripe->Spine()->ErrorStatus() == ChFiDS_Ok)
+        {
+          Stripe->Spine()->SetErrorStatus(ChFiDS_Error);
+        }
+      }
+      aResult.IsDone = aBuilder->done;
+      aResult.EVIMap.Exchange(aBuilder->myEVIMap);
+    });
+  }
+  for (std::unique_ptr<ChFi3d_Builder>& aBuilder : aBuilders)
+  {
+    aBuilder.reset();
+  }
+
+  // Data of stripes are merged in the order of stripes, followed by their extremities,
+  // as in the sequential computation.
+  for (i = 1; i <= aNbStripes; i++)
+  {
+    occ::handle<ChFiDS_Stripe>& Stripe  = aStripes(i);
+    StripeResult&               aResult = aResults(i);
+    mergeStripeData(Stripe, aResult.DS->DS(), aResult.EVIMap);
+    aResult.DS.Nullify();
+    aResult.EVIMap.Clear();
+
+    bool isFailed = aResult.IsFailed;
+    if (!isFailed)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        ChFi3d_MakeExtremities(Stripe, DStr, myEFMap, tolapp3d, tol2d);
+      }
+      catch (Standard_Failure const&)
+      {
+        isFailed = true;
+        if (Stripe->Spine()->ErrorStatus() == ChFiDS_Ok)
+        {
+          Stripe->Spine()->SetErrorStatus(ChFiDS_Error);
+        }
+      }
+      if (!aResult.IsDone)
+      {
+        isFailed = true;
+      }
+    }
+    if (isFailed)
+    {
+      badstripes.Append(Stripe);
+    }
+  }
+  done = true;
+  return true;
+}
+
+//=================================================================================================
+
+void ChFi3d_Builder::mergeStripeData(
+  const occ::handle<ChFiDS_Stripe>&                                                        Stripe,
+  const TopOpeBRepDS_DataStructure&                                                        theDS,
+  const NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher>& theEVIMap)
+{
+  // The stripe adds only shapes, surfaces and curves into the data structure;
+  // they are appended in the same order, so that the shapes already present keep their indices
+  // and new geometries get the indices following the ones of the previous stripes.
+  TopOpeBRepDS_DataStructure& DStr = myDS->ChangeDS();
+  NCollection_Array1<int>     aShapes(0, theDS.NbShapes());
+  NCollection_Array1<int>     aSurfaces(0, theDS.NbSurfaces());
+  NCollection_Array1<int>     aCurves(0, theDS.NbCurves());
+  aShapes(0) = aSurfaces(0) = aCurves(0) = 0;
+  for (int anIndex = 1; anIndex <= theDS.NbShapes(); anIndex++)
+  {
+    aShapes(anIndex) = DStr.AddShape(theDS.Shape(anIndex));
+  }
+  for (int anIndex = 1; anIndex <= theDS.NbSurfaces(); anIndex++)
+  {
+    aSurfaces(anIndex) = DStr.AddSurface(theDS.Surface(anIndex));
+  }
+  for (int anIndex = 1; anIndex <= theDS.NbCurves(); anIndex++)
+  {
+    const TopOpeBRepDS_Curve aCurve = theDS.Curve(anIndex);
+    aCurves(anIndex)                = DStr.AddCurve(aCurve);
+  }
+
+  Stripe->SetSolidIndex(aShapes(Stripe->SolidIndex()));
+  NCollection_Sequence<occ::handle<ChFiDS_SurfData>>& aSeqSurf =
+    Stripe->ChangeSetOfSurfData()->ChangeSequence();
+  for (NCollection_Sequence<occ::handle<ChFiDS_SurfData>>::Iterator aSDIter(aSeqSurf);
+       aSDIter.More();
+       aSDIter.Next())
+  {
+    const occ::handle<ChFiDS_SurfData>& aSD = aSDIter.Value();
+    aSD->ChangeSurf(aSurfaces(aSD->Surf()));
+    aSD->ChangeIndexOfS1(aShapes(aSD->IndexOfS1()));
+    aSD->ChangeIndexOfS2(aShapes(aSD->IndexOfS2()));
+    if (aSD->IsOnCurve1())
+    {
+      aSD->SetIndexOfC1(aShapes(aSD->IndexOfC1()));
+    }
+    if (aSD->IsOnCurve2())
+    {
+      aSD->SetIndexOfC2(aShapes(aSD->IndexOfC2()));
+    }
+    aSD->ChangeInterferenceOnS1().SetLineIndex(
+      aCurves(aSD->InterferenceOnS1().LineIndex()));
+    aSD->ChangeInterferenceOnS2().SetLineIndex(
+      aCurves(aSD->InterferenceOnS2().LineIndex()));
+  }
+
+  for (NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher>::Iterator
+         anEVIter(theEVIMap);
+       anEVIter.More();
+       anEVIter.Next())
+  {
+    NCollection_List<int>* aList = myEVIMap.ChangeSeek(anEVIter.Key());
+    if (aList == nullptr)
+    {
+      aList = myEVIMap.Bound(anEVIter.Key(), NCollection_List<int>());
+    }
+    for (NCollection_List<int>::Iterator aSurfIter(anEVIter.Value()); aSurfIter.More();
+         aSurfIter.Next())
+    {
+      aList->Append(aSurfaces(aSurfIter.Value()));
+    }
+  }
+}
@@ -2316,3 +2316,10 @@ void ChFi3d_ChBuilder::ConexFaces(const occ::handle<ChFiDS_Spine>& Spine,
     F2 = f2;
   }
 }
+
+//=================================================================================================
+
+std::unique_ptr<ChFi3d_Builder> ChFi3d_ChBuilder::NewStripeBuilder() const
+{
+  return std::unique_ptr<ChFi3d_Builder>(new ChFi3d_ChBuilder(*this));
+}
@@ -400,6 +400,9 @@ protected:
   //! set the regularities
   Standard_EXPORT void SetRegul() override;
 
+  //! Returns a copy of this builder computing the stripes in parallel mode.
+  Standard_EXPORT std::unique_ptr<ChFi3d_Builder> NewStripeBuilder() const override;
+
 private:
   Standard_EXPORT void ConexFaces(const occ::handle<ChFiDS_Spine>& Sp,
                                   const int                        IEdge,
@@ -2633,3 +2633,10 @@ void ChFi3d_FilBuilder::SetRegul()
     }
   }
 }
+
+//=================================================================================================
+
+std::unique_ptr<ChFi3d_Builder> ChFi3d_FilBuilder::NewStripeBuilder() const
+{
+  return std::unique_ptr<ChFi3d_Builder>(new ChFi3d_FilBuilder(*this));
+}
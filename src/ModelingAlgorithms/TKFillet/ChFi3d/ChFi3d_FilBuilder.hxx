@@ -373,6 +373,9 @@ protected:
 
   Standard_EXPORT void SetRegul() override;
 
+  //! Returns a copy of this builder computing the stripes in parallel mode.
+  Standard_EXPORT std::unique_ptr<ChFi3d_Builder> NewStripeBuilder() const override;
+
 private:
   BlendFunc_SectionShape myShape;
 };
@@ -40,12 +40,19 @@
 #include <GC_MakeArcOfCircle.hxx>
 #include <GC_MakeSegment.hxx>
 #include <GProp_GProps.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_Sequence.hxx>
+#include <Precision.hxx>
 #include <ShapeFix_Shape.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopOpeBRepBuild_HBuilder.hxx>
+#include <TopOpeBRepDS_Curve.hxx>
+#include <TopOpeBRepDS_HDataStructure.hxx>
+#include <TopOpeBRepDS_Surface.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Edge.hxx>
@@ -98,6 +105,135 @@ TEST(BRepFilletAPI_MakeFilletTest, FilletAllEdges)
   EXPECT_TRUE(anAnalyzer.IsValid());
 }
 
+TEST(BRepFilletAPI_MakeFilletTest, FilletAllEdges_ParallelMatchesSequential)
+{
+  BRepPrimAPI_MakeBox aBoxMaker(20.0, 30.0, 40.0);
+  const TopoDS_Shape& aBox = aBoxMaker.Shape();
+  ASSERT_TRUE(aBoxMaker.IsDone());
+
+  double aVolumes[2] = {0.0, 0.0};
+  int    aNbFaces[2] = {0, 0};
+  for (int aModeIter = 0; aModeIter < 2; ++aModeIter)
+  {
+    BRepFilletAPI_MakeFillet aFillet(aBox);
+    aFillet.SetRunParallel(aModeIter == 1);
+    for (TopExp_Explorer anExp(aBox, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      aFillet.Add(2.0, TopoDS::Edge(anExp.Current()));
+    }
+    aFillet.Build();
+    ASSERT_TRUE(aFillet.IsDone());
+    EXPECT_EQ(aFillet.NbFaultyContours(), 0);
+
+    const TopoDS_Shape& aResult = aFillet.Shape();
+    BRepCheck_Analyzer  anAnalyzer(aResult);
+    EXPECT_TRUE(anAnalyzer.IsValid());
+
+    GProp_GProps aProps;
+    BRepGProp::VolumeProperties(aResult, aProps);
+    aVolumes[aModeIter] = aProps.Mass();
+    for (TopExp_Explorer aFaceExp(aResult, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+    {
+      ++aNbFaces[aModeIter];
+    }
+  }
+
+  EXPECT_EQ(aNbFaces[0], aNbFaces[1]);
+  EXPECT_NEAR(aVolumes[0], aVolumes[1], 1.0e-6 * aVolumes[0]);
+  EXPECT_LT(aVolumes[1], 20.0 * 30.0 * 40.0);
+}
+
+// Variable radius fillets are walked (not built as particular cases); the stripes having
+// common vertices are computed in different sets, and the data structure must not depend on it.
+TEST(BRepFilletAPI_MakeFilletTest, FilletVariableRadius_ParallelMatchesSequential)
+{
+  BRepPrimAPI_MakeBox aBoxMaker(40.0, 40.0, 40.0);
+  const TopoDS_Shape& aBox = aBoxMaker.Shape();
+  ASSERT_TRUE(aBoxMaker.IsDone());
+
+  NCollection_Array1<gp_Pnt2d> aVarRadius(1, 3);
+  aVarRadius.SetValue(1, gp_Pnt2d(0.0, 2.0));
+  aVarRadius.SetValue(2, gp_Pnt2d(0.5, 4.0));
+  aVarRadius.SetValue(3, gp_Pnt2d(1.0, 2.0));
+
+  BRepFilletAPI_MakeFillet aFillets[2] = {BRepFilletAPI_MakeFillet(aBox),
+                                          BRepFilletAPI_MakeFillet(aBox)};
+  for (int aModeIter = 0; aModeIter < 2; ++aModeIter)
+  {
+    BRepFilletAPI_MakeFillet& aFillet = aFillets[aModeIter];
+    aFillet.SetRunParallel(aModeIter == 1);
+    for (TopExp_Explorer anExp(aBox, TopAbs_EDGE); anExp.More(); anExp.Next())
+    {
+      aFillet.Add(aVarRadius, TopoDS::Edge(anExp.Current()));
+    }
+    aFillet.Build();
+    ASSERT_TRUE(aFillet.IsDone());
+    EXPECT_EQ(aFillet.NbFaultyContours(), 0);
+    BRepCheck_Analyzer anAnalyzer(aFillet.Shape());
+    EXPECT_TRUE(anAnalyzer.IsValid());
+  }
+
+  // same entities at the same indices of the data structures
+  const TopOpeBRepDS_DataStructure& aDS0 = aFillets[0].Builder()->DataStructure()->DS();
+  const TopOpeBRepDS_DataStructure& aDS1 = aFillets[1].Builder()->DataStructure()->DS();
+  ASSERT_EQ(aDS0.NbShapes(), aDS1.NbShapes());
+  ASSERT_EQ(aDS0.NbSurfaces(), aDS1.NbSurfaces());
+  ASSERT_EQ(aDS0.NbCurves(), aDS1.NbCurves());
+  ASSERT_EQ(aDS0.NbPoints(), aDS1.NbPoints());
+  EXPECT_GT(aDS0.NbSurfaces(), 12);
+  for (int anIndex = 1; anIndex <= aDS0.NbShapes(); ++anIndex)
+  {
+    EXPECT_TRUE(aDS0.Shape(anIndex).IsSame(aDS1.Shape(anIndex))) << "Shape " << anIndex;
+  }
+  for (int anIndex = 1; anIndex <= aDS0.NbSurfaces(); ++anIndex)
+  {
+    const occ::handle<Geom_Surface>& aSurf0 = aDS0.Surface(anIndex).Surface();
+    const occ::handle<Geom_Surface>& aSurf1 = aDS1.Surface(anIndex).Surface();
+    double                           aU1, aU2, aV1, aV2;
+    aSurf0->Bounds(aU1, aU2, aV1, aV2);
+    const double aU = 0.5 * (aU1 + aU2), aV = 0.5 * (aV1 + aV2);
+    EXPECT_LT(aSurf0->Value(aU, aV).Distance(aSurf1->Value(aU, aV)), Precision::Confusion())
+      << "Surface " << anIndex;
+  }
+  for (int anIndex = 1; anIndex <= aDS0.NbCurves(); ++anIndex)
+  {
+    const TopOpeBRepDS_Curve& aCurve0 = aDS0.Curve(anIndex);
+    const TopOpeBRepDS_Curve& aCurve1 = aDS1.Curve(anIndex);
+    ASSERT_EQ(aCurve0.Curve().IsNull(), aCurve1.Curve().IsNull()) << "Curve " << anIndex;
+    if (aCurve0.Curve().IsNull())
+    {
+      continue;
+    }
+    const double aT = 0.5 * (aCurve0.Curve()->FirstParameter() + aCurve0.Curve()->LastParameter());
+    EXPECT_LT(aCurve0.Curve()->Value(aT).Distance(aCurve1.Curve()->Value(aT)),
+              Precision::Confusion())
+      << "Curve " << anIndex;
+  }
+
+  // same result
+  int aNbSubShapes[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (int aModeIter = 0; aModeIter < 2; ++aModeIter)
+  {
+    const TopAbs_ShapeEnum aTypes[3] = {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX};
+    for (int aTypeIter = 0; aTypeIter < 3; ++aTypeIter)
+    {
+      for (TopExp_Explorer anExp(aFillets[aModeIter].Shape(), aTypes[aTypeIter]); anExp.More();
+           anExp.Next())
+      {
+        ++aNbSubShapes[aModeIter][aTypeIter];
+      }
+    }
+  }
+  for (int aTypeIter = 0; aTypeIter < 3; ++aTypeIter)
+  {
+    EXPECT_EQ(aNbSubShapes[0][aTypeIter], aNbSubShapes[1][aTypeIter]);
+  }
+  GProp_GProps aProps[2];
+  BRepGProp::VolumeProperties(aFillets[0].Shape(), aProps[0]);
+  BRepGProp::VolumeProperties(aFillets[1].Shape(), aProps[1]);
+  EXPECT_NEAR(aProps[0].Mass(), aProps[1].Mass(), 1.0e-9 * aProps[0].Mass());
+}
+
 TEST(BRepFilletAPI_MakeFilletTest, FilletMoreFaces)
 {
   BRepPrimAPI_MakeBox aBoxMaker(20.0, 20.0, 20.0);
@@ -0,0 +1,102 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Vec.hxx>
+#include <HLRAlgo_EdgeStatus.hxx>
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <HLRBRep_Data.hxx>
+#include <HLRBRep_EdgeData.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns compound of boxes and cylinders partially hiding each other.
+TopoDS_Compound makeScene()
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aScene;
+  aBuilder.MakeCompound(aScene);
+  for (int aRow = 0; aRow < 4; ++aRow)
+  {
+    for (int aCol = 0; aCol < 4; ++aCol)
+    {
+      const gp_Pnt aCorner(aCol * 7.0, aRow * 7.0, (aRow + aCol) % 3 * 4.0);
+      aBuilder.Add(aScene, BRepPrimAPI_MakeBox(aCorner, 10.0, 10.0, 10.0).Shape());
+      const gp_Ax2 anAxis(aCorner.Translated(gp_Vec(-2.0, 5.0, 5.0)), gp_Dir(1.0, 0.0, 0.0));
+      aBuilder.Add(aScene, BRepPrimAPI_MakeCylinder(anAxis, 3.0, 14.0).Shape());
+    }
+  }
+  return aScene;
+}
+
+//! Computes hidden lines of the scene.
+occ::handle<HLRBRep_Algo> hideScene(const TopoDS_Shape& theScene, const bool theToParallel)
+{
+  occ::handle<HLRBRep_Algo> anAlgo = new HLRBRep_Algo();
+  anAlgo->Add(theScene);
+  anAlgo->Projector(HLRAlgo_Projector(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, -1.0, 1.0))));
+  anAlgo->SetRunParallel(theToParallel);
+  anAlgo->Update();
+  anAlgo->Hide();
+  return anAlgo;
+}
+} // namespace
+
+// Parallel hiding should give the same visible parts of edges as sequential one
+TEST(HLRBRep_AlgoTest, ParallelHideMatchesSequential)
+{
+  const TopoDS_Compound           aScene   = makeScene();
+  const occ::handle<HLRBRep_Algo> aSeqAlgo = hideScene(aScene, false);
+  const occ::handle<HLRBRep_Algo> aParAlgo = hideScene(aScene, true);
+  EXPECT_FALSE(aSeqAlgo->RunParallel());
+  EXPECT_TRUE(aParAlgo->RunParallel());
+
+  const occ::handle<HLRBRep_Data>& aSeqData = aSeqAlgo->DataStructure();
+  const occ::handle<HLRBRep_Data>& aParData = aParAlgo->DataStructure();
+  ASSERT_EQ(aSeqData->NbEdges(), aParData->NbEdges());
+  ASSERT_GT(aSeqData->NbEdges(), 100);
+
+  int aNbHidden = 0;
+  for (int anEdgeIter = 1; anEdgeIter <= aSeqData->NbEdges(); ++anEdgeIter)
+  {
+    HLRAlgo_EdgeStatus& aSeqStatus = aSeqData->EDataArray().ChangeValue(anEdgeIter).Status();
+    HLRAlgo_EdgeStatus& aParStatus = aParData->EDataArray().ChangeValue(anEdgeIter).Status();
+    ASSERT_EQ(aSeqStatus.AllHidden(), aParStatus.AllHidden());
+    ASSERT_EQ(aSeqStatus.NbVisiblePart(), aParStatus.NbVisiblePart());
+    if (aSeqStatus.AllHidden() || aSeqStatus.NbVisiblePart() != 1)
+    {
+      ++aNbHidden;
+    }
+    for (int aPartIter = 1; aPartIter <= aSeqStatus.NbVisiblePart(); ++aPartIter)
+    {
+      double aSeqStart = 0.0, aSeqEnd = 0.0, aParStart = 0.0, aParEnd = 0.0;
+      float  aSeqTolStart = 0.0f, aSeqTolEnd = 0.0f, aParTolStart = 0.0f, aParTolEnd = 0.0f;
+      aSeqStatus.VisiblePart(aPartIter, aSeqStart, aSeqTolStart, aSeqEnd, aSeqTolEnd);
+      aParStatus.VisiblePart(aPartIter, aParStart, aParTolStart, aParEnd, aParTolEnd);
+      EXPECT_EQ(aSeqStart, aParStart);
+      EXPECT_EQ(aSeqEnd, aParEnd);
+      EXPECT_EQ(aSeqTolStart, aParTolStart);
+      EXPECT_EQ(aSeqTolEnd, aParTolEnd);
+    }
+  }
+  EXPECT_GT(aNbHidden, 0);
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Vec.hxx>
+#include <HLRAlgo_EdgeStatus.hxx>
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_PolyAlgo.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns meshed compound of boxes, cylinders and spheres partially hiding each other.
+TopoDS_Compound makeMeshedScene()
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aScene;
+  aBuilder.MakeCompound(aScene);
+  for (int aRow = 0; aRow < 4; ++aRow)
+  {
+    for (int aCol = 0; aCol < 4; ++aCol)
+    {
+      const gp_Pnt aCorner(aCol * 7.0, aRow * 7.0, (aRow + aCol) % 3 * 4.0);
+      aBuilder.Add(aScene, BRepPrimAPI_MakeBox(aCorner, 10.0, 10.0, 10.0).Shape());
+      const gp_Ax2 anAxis(aCorner.Translated(gp_Vec(-2.0, 5.0, 5.0)), gp_Dir(1.0, 0.0, 0.0));
+      aBuilder.Add(aScene, BRepPrimAPI_MakeCylinder(anAxis, 3.0, 14.0).Shape());
+      aBuilder.Add(aScene,
+                   BRepPrimAPI_MakeSphere(aCorner.Translated(gp_Vec(5.0, 5.0, 11.0)), 3.0).Shape());
+    }
+  }
+  BRepMesh_IncrementalMesh(aScene, 0.2);
+  return aScene;
+}
+
+//! Computes hidden lines of the meshed scene.
+occ::handle<HLRBRep_PolyAlgo> hideScene(const TopoDS_Shape& theScene, const bool theToParallel)
+{
+  occ::handle<HLRBRep_PolyAlgo> anAlgo = new HLRBRep_PolyAlgo();
+  anAlgo->Load(theScene);
+  anAlgo->Projector(HLRAlgo_Projector(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, -1.0, 1.0))));
+  anAlgo->SetRunParallel(theToParallel);
+  anAlgo->Update();
+  return anAlgo;
+}
+} // namespace
+
+// Parallel hiding using BVH tree should give the same visible parts of segments as sequential one
+TEST(HLRBRep_PolyAlgoTest, ParallelHideMatchesSequential)
+{
+  const TopoDS_Compound               aScene   = makeMeshedScene();
+  const occ::handle<HLRBRep_PolyAlgo> aSeqAlgo = hideScene(aScene, false);
+  const occ::handle<HLRBRep_PolyAlgo> aParAlgo = hideScene(aScene, true);
+  EXPECT_FALSE(aSeqAlgo->RunParallel());
+  EXPECT_TRUE(aParAlgo->RunParallel());
+
+  int aNbSegments = 0;
+  int aNbHidden   = 0;
+  for (aSeqAlgo->InitHide(), aParAlgo->InitHide(); aSeqAlgo->MoreHide() && aParAlgo->MoreHide();
+       aSeqAlgo->NextHide(), aParAlgo->NextHide(), ++aNbSegments)
+  {
+    HLRAlgo_EdgeStatus aSeqStatus, aParStatus;
+    TopoDS_Shape       aSeqShape, aParShape;
+    bool               isSeqReg1 = false, isSeqRegn = false, isSeqOutl = false, isSeqIntl = false;
+    bool               isParReg1 = false, isParRegn = false, isParOutl = false, isParIntl = false;
+    const HLRAlgo_BiPoint::PointsT& aSeqPoints =
+      aSeqAlgo->Hide(aSeqStatus, aSeqShape, isSeqReg1, isSeqRegn, isSeqOutl, isSeqIntl);
+    const HLRAlgo_BiPoint::PointsT& aParPoints =
+      aParAlgo->Hide(aParStatus, aParShape, isParReg1, isParRegn, isParOutl, isParIntl);
+    ASSERT_EQ(0.0, (aSeqPoints.Pnt1 - aParPoints.Pnt1).SquareModulus());
+    ASSERT_EQ(0.0, (aSeqPoints.Pnt2 - aParPoints.Pnt2).SquareModulus());
+    ASSERT_TRUE(aSeqShape.IsSame(aParShape));
+    ASSERT_EQ(aSeqStatus.AllHidden(), aParStatus.AllHidden());
+    ASSERT_EQ(aSeqStatus.NbVisiblePart(), aParStatus.NbVisiblePart());
+    if (aSeqStatus.AllHidden() || aSeqStatus.NbVisiblePart() != 1)
+    {
+      ++aNbHidden;
+    }
+    for (int aPartIter = 1; aPartIter <= aSeqStatus.NbVisiblePart(); ++aPartIter)
+    {
+      double aSeqStart = 0.0, aSeqEnd = 0.0, aParStart = 0.0, aParEnd = 0.0;
+      float  aSeqTolStart = 0.0f, aSeqTolEnd = 0.0f, aParTolStart = 0.0f, aParTolEnd = 0.0f;
+      aSeqStatus.VisiblePart(aPartIter, aSeqStart, aSeqTolStart, aSeqEnd, aSeqTolEnd);
+      aParStatus.VisiblePart(aPartIter, aParStart, aParTolStart, aParEnd, aParTolEnd);
+      EXPECT_EQ(aSeqStart, aParStart);
+      EXPECT_EQ(aSeqEnd, aParEnd);
+      EXPECT_EQ(aSeqTolStart, aParTolStart);
+      EXPECT_EQ(aSeqTolEnd, aParTolEnd);
+    }
+  }
+  EXPECT_FALSE(aSeqAlgo->MoreHide());
+  EXPECT_FALSE(aParAlgo->MoreHide());
+  EXPECT_GT(aNbSegments, 1000);
+  EXPECT_GT(aNbHidden, 0);
+}
@@ -16,21 +16,87 @@
 
 #include <HLRAlgo_PolyAlgo.hxx>
 
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <HLRAlgo_BiPoint.hxx>
 #include <HLRAlgo_EdgeStatus.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <NCollection_List.hxx>
 #include <HLRAlgo_PolyShellData.hxx>
 #include <HLRAlgo_PolyMask.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo, Standard_Transient)
 
+namespace
+{
+//! Hiding triangle referenced by the BVH tree.
+struct HidingTriangle
+{
+  int Shell;  //!< index of the shell
+  int Face;   //!< index of the face within hiding faces of the shell
+  int Hiding; //!< index of the triangle within hiding data of the face
+};
+
+//! Selector of hiding triangles with boxes overlapping the given box from BVH tree.
+class HidingTriangleSelector : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3, int>, bool>
+{
+public:
+  //! Sets the box to search for overlapping with it.
+  void SetBox(const BVH_Box<double, 3>& theBox) { myBox = theBox; }
+
+  //! Returns indices of overlapping boxes.
+  NCollection_DynamicArray<int>& Indices() { return myIndices; }
+
+  //! Rejects the node not overlapping the box.
+  bool RejectNode(const BVH_Vec3d& theCMin, const BVH_Vec3d& theCMax, bool& theIsInside)
+    const override
+  {
+    bool hasOverlap = false;
+    theIsInside     = myBox.Contains(theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  //! Accepts elements of nodes inside the box.
+  bool AcceptMetric(const bool& theIsInside) const override { return theIsInside; }
+
+  //! Accepts the element overlapping the box.
+  bool Accept(const int theIndex, const bool& theIsInside) override
+  {
+    if (theIsInside || !myBox.IsOut(this->myBVHSet->Box(theIndex)))
+    {
+      myIndices.Append(this->myBVHSet->Element(theIndex));
+      return true;
+    }
+    return false;
+  }
+
+private:
+  BVH_Box<double, 3>            myBox;
+  NCollection_DynamicArray<int> myIndices;
+};
+
+//! Returns TRUE if the box of the segment overlaps the box of the shell.
+bool isOverlapping(const HLRAlgo_PolyShellData::ShellIndices& theShellIndices,
+                   const HLRAlgo_BiPoint::IndicesT&           theIndices)
+{
+  return ((theShellIndices.Max - theIndices.MinSeg) & 0x80100200) == 0
+         && ((theIndices.MaxSeg - theShellIndices.Min) & 0x80100000) == 0;
+}
+} // namespace
+
 //=================================================================================================
 
 HLRAlgo_PolyAlgo::HLRAlgo_PolyAlgo()
     : myNbrShell(0),
       myCurShell(0),
-      myFound(false)
+      myCurSegment(0),
+      myFound(false),
+      myRunParallel(false)
 {
   myTriangle.TolParam = 0.00000001;
   myTriangle.TolAng   = 0.0001;
@@ -49,6 +115,8 @@ void HLRAlgo_PolyAlgo::Clear()
 {
   NCollection_Array1<occ::handle<HLRAlgo_PolyShellData>> anEmpty;
   myHShell.Move(anEmpty);
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatus;
+  myHideStatus.Move(anEmptyStatus);
   myNbrShell = 0;
 }
 
@@ -460,6 +528,149 @@ void HLRAlgo_PolyAlgo::Update()
       aShellIndices.Max = 0;
     }
   }
+
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatus;
+  myHideStatus.Move(anEmptyStatus);
+  if (myRunParallel)
+  {
+    hideParallel(1.0 / SurDX, 1.0 / SurDY, 1.0 / SurDZ);
+  }
+}
+
+//=================================================================================================
+
+void HLRAlgo_PolyAlgo::hideParallel(const double theCellX,
+                                    const double theCellY,
+                                    const double theCellZ)
+{
+  // segments in the order of iteration
+  int aNbSegments = 0;
+  for (int s = 1; s <= myNbrShell; s++)
+  {
+    aNbSegments += myHShell.Value(s)->Edges().Size();
+  }
+  if (aNbSegments == 0)
+  {
+    return;
+  }
+
+  NCollection_Array1<HLRAlgo_BiPoint*> aSegments(1, aNbSegments);
+  NCollection_Array1<int>              aSegmentShells(1, aNbSegments);
+  int                                  aSegIndex = 0;
+  for (int s = 1; s <= myNbrShell; s++)
+  {
+    for (NCollection_List<HLRAlgo_BiPoint>::Iterator aSegIter(myHShell.Value(s)->Edges());
+         aSegIter.More();
+         aSegIter.Next())
+    {
+      ++aSegIndex;
+      aSegments.SetValue(aSegIndex, &aSegIter.ChangeValue());
+      aSegmentShells.SetValue(aSegIndex, s);
+    }
+  }
+
+  // hiding triangles are numbered in the order of sequential processing,
+  // so that sorted candidates of the segment are processed in the same order
+  NCollection_DynamicArray<HidingTriangle> aTriangles;
+  occ::handle<BVH_BoxSet<double, 3, int>>  aBoxSet =
+    new BVH_BoxSet<double, 3, int>(new BVH_LinearBuilder<double, 3>());
+  for (int s = 1; s <= myNbrShell; s++)
+  {
+    const occ::handle<HLRAlgo_PolyShellData>& aPsd = myHShell.Value(s);
+    if (!aPsd->Hiding())
+    {
+      continue;
+    }
+
+    NCollection_Array1<occ::handle<HLRAlgo_PolyData>>& aFace = aPsd->HidingPolyData();
+    for (int f = 1; f <= aFace.Upper(); f++)
+    {
+      const occ::handle<HLRAlgo_PolyData>&            aPd    = aFace.Value(f);
+      const NCollection_Array1<gp_XYZ>&               aNodes = aPd->Nodes();
+      const NCollection_Array1<HLRAlgo_TriangleData>& aTData = aPd->TData();
+      NCollection_Array1<HLRAlgo_PolyHidingData>&     aPHDat = aPd->PHDat();
+      for (int h = 1; h <= aPHDat.Upper(); h++)
+      {
+        const HLRAlgo_TriangleData& aTD = aTData.Value(aPHDat.ChangeValue(h).Indices().Index);
+        const gp_XYZ&               aP1 = aNodes.Value(aTD.Node1);
+        const gp_XYZ&               aP2 = aNodes.Value(aTD.Node2);
+        const gp_XYZ&               aP3 = aNodes.Value(aTD.Node3);
+        BVH_Box<double, 3>          aBox(BVH_Vec3d(aP1.X(), aP1.Y(), aP1.Z()));
+        aBox.Add(BVH_Vec3d(aP2.X(), aP2.Y(), aP2.Z()));
+        aBox.Add(BVH_Vec3d(aP3.X(), aP3.Y(), aP3.Z()));
+        aBoxSet->Add(aTriangles.Size(), aBox);
+        aTriangles.Append({s, f, h});
+      }
+    }
+  }
+  aBoxSet->Build();
+
+  // The box-mask test of the segment and the triangle fails when their boxes are
+  // separated by more than two cells, so that wider box gives all the triangles
+  // passing it; the box-mask tests are still applied to the candidates.
+  const double                       aMarginX = 3.0 * theCellX;
+  const double                       aMarginY = 3.0 * theCellY;
+  const double                       aMarginZ = 3.0 * theCellZ;
+  const occ::handle<OSD_ThreadPool>& aPool    = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher           aLauncher(*aPool, aPool->NbDefaultThreadsToLaunch());
+  NCollection_Array1<HidingTriangleSelector> aSelectors(aLauncher.LowerThreadIndex(),
+                                                        aLauncher.UpperThreadIndex());
+  NCollection_Array1<HLRAlgo_PolyData::Triangle> aTriangleData(aLauncher.LowerThreadIndex(),
+                                                               aLauncher.UpperThreadIndex());
+  aTriangleData.Init(myTriangle);
+  myHideStatus.Resize(1, aNbSegments, false);
+  aLauncher.Perform(1, aNbSegments + 1, [&](const int theThreadIndex, const int theSegIndex) {
+    HLRAlgo_BiPoint&           aBP       = *aSegments.Value(theSegIndex);
+    HLRAlgo_BiPoint::PointsT&  aPoints   = aBP.Points();
+    HLRAlgo_BiPoint::IndicesT& anIndices = aBP.Indices();
+    HLRAlgo_EdgeStatus&        aStatus   = myHideStatus.ChangeValue(theSegIndex);
+    aStatus =
+      HLRAlgo_EdgeStatus(0.0, (float)myTriangle.TolParam, 1.0, (float)myTriangle.TolParam);
+    if (aBP.Hidden())
+    {
+      aStatus.HideAll();
+      return;
+    }
+
+    HidingTriangleSelector& aSelector = aSelectors.ChangeValue(theThreadIndex);
+    const gp_XYZ&           aP1       = aPoints.PntP1;
+    const gp_XYZ&           aP2       = aPoints.PntP2;
+    aSelector.Indices().Clear();
+    aSelector.SetBVHSet(aBoxSet.get());
+    aSelector.SetBox(BVH_Box<double, 3>(
+      BVH_Vec3d(std::min(aP1.X(), aP2.X()) - aMarginX,
+                std::min(aP1.Y(), aP2.Y()) - aMarginY,
+                std::min(aP1.Z(), aP2.Z()) - aMarginZ),
+      BVH_Vec3d(std::max(aP1.X(), aP2.X()) + aMarginX,
+                std::max(aP1.Y(), aP2.Y()) + aMarginY,
+                Precision::Infinite())));
+    aSelector.Select();
+    std::sort(aSelector.Indices().begin(), aSelector.Indices().end());
+
+    HLRAlgo_PolyData::Triangle& aTriangle = aTriangleData.ChangeValue(theThreadIndex);
+    const int                   aSegShell = aSegmentShells.Value(theSegIndex);
+    for (NCollection_DynamicArray<int>::Iterator aCandIter(aSelector.Indices()); aCandIter.More();
+         aCandIter.Next())
+    {
+      const HidingTriangle&                     aHT  = aTriangles.Value(aCandIter.Value());
+      const occ::handle<HLRAlgo_PolyShellData>& aPsd = myHShell.Value(aHT.Shell);
+      if (!isOverlapping(aPsd->Indices(), anIndices))
+      {
+        continue;
+      }
+
+      const occ::handle<HLRAlgo_PolyData>& aPd = aPsd->HidingPolyData().Value(aHT.Face);
+      if (aPd->IsOverlapping(anIndices))
+      {
+        aPd->HideByTriangle(aHT.Hiding,
+                            aPoints,
+                            aTriangle,
+                            anIndices,
+                            aHT.Shell == aSegShell,
+                            aStatus);
+      }
+    }
+  });
 }
 
 //=================================================================================================
@@ -494,6 +705,10 @@ void HLRAlgo_PolyAlgo::NextHide()
       }
     }
   }
+  if (myFound)
+  {
+    myCurSegment++;
+  }
 }
 
 //=================================================================================================
@@ -514,6 +729,12 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide(HLRAlgo_EdgeStatus& theStatus,
   theRegn   = aBP.RgNLine();
   theOutl   = aBP.OutLine();
   theIntl   = aBP.IntLine();
+  if (!myHideStatus.IsEmpty())
+  {
+    // computed within Update()
+    theStatus = myHideStatus.Value(myCurSegment);
+    return aPoints;
+  }
   if (aBP.Hidden())
   {
     theStatus.HideAll();
@@ -528,9 +749,7 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide(HLRAlgo_EdgeStatus& theStatus,
       continue;
     }
 
-    HLRAlgo_PolyShellData::ShellIndices& aShellIndices = aPsd->Indices();
-    if (((aShellIndices.Max - anIndices.MinSeg) & 0x80100200) == 0
-        && ((anIndices.MaxSeg - aShellIndices.Min) & 0x80100000) == 0)
+    if (isOverlapping(aPsd->Indices(), anIndices))
     {
       const bool                                         isHidingShell = (s == myCurShell);
       NCollection_Array1<occ::handle<HLRAlgo_PolyData>>& aFace         = aPsd->HidingPolyData();
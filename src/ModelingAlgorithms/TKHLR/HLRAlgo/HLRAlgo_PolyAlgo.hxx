@@ -19,9 +19,9 @@
 
 #include <HLRAlgo_PolyData.hxx>
 #include <HLRAlgo_BiPoint.hxx>
+#include <HLRAlgo_EdgeStatus.hxx>
 #include <NCollection_List.hxx>
 
-class HLRAlgo_EdgeStatus;
 class HLRAlgo_PolyShellData;
 
 //! to remove Hidden lines on Triangulations.
@@ -43,11 +43,21 @@ public:
   Standard_EXPORT void Clear();
 
   //! Prepare all the data to process the algo.
+  //! In parallel mode, also computes hiding of all the segments.
   Standard_EXPORT void Update();
 
+  //! Sets flag to compute hiding of segments within Update() in parallel threads
+  //! (FALSE by default). Hiding triangles are then found using BVH tree
+  //! built in the projected space; the result is the same as of sequential processing.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns flag to compute hiding of segments in parallel threads.
+  bool RunParallel() const { return myRunParallel; }
+
   void InitHide()
   {
-    myCurShell = 0;
+    myCurShell   = 0;
+    myCurSegment = 0;
     NextHide();
   }
 
@@ -82,13 +92,23 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo, Standard_Transient)
 
+private:
+  //! Computes hiding of all the segments in parallel threads.
+  //! @param[in] theCellX size of the box-mask cell along X
+  //! @param[in] theCellY size of the box-mask cell along Y
+  //! @param[in] theCellZ size of the box-mask cell along Z
+  void hideParallel(const double theCellX, const double theCellY, const double theCellZ);
+
 private:
   NCollection_Array1<occ::handle<HLRAlgo_PolyShellData>> myHShell;
+  NCollection_Array1<HLRAlgo_EdgeStatus>                 myHideStatus;
   HLRAlgo_PolyData::Triangle                             myTriangle;
   NCollection_List<HLRAlgo_BiPoint>::Iterator            mySegListIt;
   int                                                    myNbrShell;
   int                                                    myCurShell;
+  int                                                    myCurSegment;
   bool                                                   myFound;
+  bool                                                   myRunParallel;
 };
 
 #endif // _HLRAlgo_PolyAlgo_HeaderFile
@@ -83,136 +83,142 @@ void HLRAlgo_PolyData::HideByPolyData(const HLRAlgo_BiPoint::PointsT& thePoints,
                                       const bool                      HidingShell,
                                       HLRAlgo_EdgeStatus&             status)
 {
-  if (((myFaceIndices.Max - theIndices.MinSeg) & 0x80100200) == 0
-      && ((theIndices.MaxSeg - myFaceIndices.Min) & 0x80100000) == 0)
+  if (IsOverlapping(theIndices))
   {
-    NCollection_Array1<HLRAlgo_PolyHidingData>&     PHDat = myHPHDat->ChangeArray1();
-    const NCollection_Array1<HLRAlgo_TriangleData>& TData = myHTData->Array1();
-    double                                          d1, d2;
-    bool                                            NotConnex    = false;
-    bool                                            isCrossing   = false;
-    bool                                            toHideBefore = false;
-    int                                             TFlag        = 0;
-    int                                             h, h2 = PHDat.Upper();
-    HLRAlgo_PolyHidingData*                         PH = &(PHDat(1));
+    const int h2 = myHPHDat->Upper();
+    for (int h = 1; h <= h2; h++)
+    {
+      HideByTriangle(h, thePoints, theTriangle, theIndices, HidingShell, status);
+    }
+  }
+}
 
-    for (h = 1; h <= h2; h++)
+//=================================================================================================
+
+void HLRAlgo_PolyData::HideByTriangle(const int                       theHidingIndex,
+                                      const HLRAlgo_BiPoint::PointsT& thePoints,
+                                      Triangle&                       theTriangle,
+                                      HLRAlgo_BiPoint::IndicesT&      theIndices,
+                                      const bool                      HidingShell,
+                                      HLRAlgo_EdgeStatus&             status)
+{
+  HLRAlgo_PolyHidingData&                  PH               = myHPHDat->ChangeValue(theHidingIndex);
+  HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = PH.Indices();
+  if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) == 0
+      && ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) == 0)
+  {
+    const HLRAlgo_TriangleData& aTriangle    = myHTData->Value(aTriangleIndices.Index);
+    double                      d1, d2;
+    bool                        NotConnex    = true;
+    bool                        isCrossing   = false;
+    bool                        toHideBefore = false;
+    int                         TFlag        = 0;
+    if (HidingShell)
     {
-      HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = PH->Indices();
-      if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) == 0
-          && ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) == 0)
+      if (myFaceIndices.Index == theIndices.FaceConex1)
       {
-        const HLRAlgo_TriangleData& aTriangle = TData(aTriangleIndices.Index);
-        NotConnex                             = true;
-        if (HidingShell)
+        if (theIndices.Face1Pt1 == aTriangle.Node1)
         {
-          if (myFaceIndices.Index == theIndices.FaceConex1)
-          {
-            if (theIndices.Face1Pt1 == aTriangle.Node1)
-            {
-              NotConnex =
-                theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
-            }
-            else if (theIndices.Face1Pt1 == aTriangle.Node2)
-            {
-              NotConnex =
-                theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
-            }
-            else if (theIndices.Face1Pt1 == aTriangle.Node3)
-            {
-              NotConnex =
-                theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
-            }
-          }
-          else if (myFaceIndices.Index == theIndices.FaceConex2)
-          {
-            if (theIndices.Face2Pt1 == aTriangle.Node1)
-            {
-              NotConnex =
-                theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
-            }
-            else if (theIndices.Face2Pt1 == aTriangle.Node2)
-            {
-              NotConnex =
-                theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
-            }
-            else if (theIndices.Face2Pt1 == aTriangle.Node3)
-            {
-              NotConnex =
-                theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
-            }
-          }
+          NotConnex =
+            theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
         }
-        if (NotConnex)
+        else if (theIndices.Face1Pt1 == aTriangle.Node2)
         {
-          HLRAlgo_PolyHidingData::PlaneT& aPlane = PH->Plane();
-          d1                                     = aPlane.Normal * thePoints.PntP1 - aPlane.D;
-          d2                                     = aPlane.Normal * thePoints.PntP2 - aPlane.D;
-          if (d1 > theTriangle.Tolerance)
-          {
-            if (d2 < -theTriangle.Tolerance)
-            {
-              theTriangle.Param                       = d1 / (d1 - d2);
-              toHideBefore                            = false;
-              isCrossing                              = true;
-              TFlag                                   = aTriangle.Flags;
-              const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
-              const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
-              const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
-              const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
-              theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
-              theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
-              theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
-              hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-            }
-          }
-          else if (d1 < -theTriangle.Tolerance)
-          {
-            if (d2 > theTriangle.Tolerance)
-            {
-              theTriangle.Param                       = d1 / (d1 - d2);
-              toHideBefore                            = true;
-              isCrossing                              = true;
-              TFlag                                   = aTriangle.Flags;
-              const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
-              const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
-              const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
-              const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
-              theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
-              theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
-              theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
-              hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-            }
-            else
-            {
-              isCrossing                              = false;
-              TFlag                                   = aTriangle.Flags;
-              const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
-              const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
-              const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
-              const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
-              theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
-              theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
-              theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
-              hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-            }
-          }
-          else if (d2 < -theTriangle.Tolerance)
-          {
-            isCrossing                              = false;
-            TFlag                                   = aTriangle.Flags;
-            const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
-            const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
-            const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
-            const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
-            theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
-            theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
-            theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
-            hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-          }
+          NotConnex =
+            theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
+        }
+        else if (theIndices.Face1Pt1 == aTriangle.Node3)
+        {
+          NotConnex =
+            theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
+        }
+      }
+      else if (myFaceIndices.Index == theIndices.FaceConex2)
+      {
+        if (theIndices.Face2Pt1 == aTriangle.Node1)
+        {
+          NotConnex =
+            theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
+        }
+        else if (theIndices.Face2Pt1 == aTriangle.Node2)
+        {
+          NotConnex =
+            theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
         }
+        else if (theIndices.Face2Pt1 == aTriangle.Node3)
+        {
+          NotConnex =
+            theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
+        }
+      }
+    }
+    if (NotConnex)
+    {
+      HLRAlgo_PolyHidingData::PlaneT& aPlane = PH.Plane();
+      d1                                     = aPlane.Normal * thePoints.PntP1 - aPlane.D;
+      d2                                     = aPlane.Normal * thePoints.PntP2 - aPlane.D;
+      if (d1 > theTriangle.Tolerance)
+      {
+        if (d2 < -theTriangle.Tolerance)
+        {
+          theTriangle.Param                       = d1 / (d1 - d2);
+          toHideBefore                            = false;
+          isCrossing                              = true;
+          TFlag                                   = aTriangle.Flags;
+          const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
+          const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+      }
+      else if (d1 < -theTriangle.Tolerance)
+      {
+        if (d2 > theTriangle.Tolerance)
+        {
+          theTriangle.Param                       = d1 / (d1 - d2);
+          toHideBefore                            = true;
+          isCrossing                              = true;
+          TFlag                                   = aTriangle.Flags;
+          const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
+          const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+        else
+        {
+          isCrossing                              = false;
+          TFlag                                   = aTriangle.Flags;
+          const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
+          const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+      }
+      else if (d2 < -theTriangle.Tolerance)
+      {
+        isCrossing                              = false;
+        TFlag                                   = aTriangle.Flags;
+        const NCollection_Array1<gp_XYZ>& Nodes = myHNodes->Array1();
+        const gp_XYZ&                     P1    = Nodes(aTriangle.Node1);
+        const gp_XYZ&                     P2    = Nodes(aTriangle.Node2);
+        const gp_XYZ&                     P3    = Nodes(aTriangle.Node3);
+        theTriangle.V1                          = gp_XY(P1.X(), P1.Y());
+        theTriangle.V2                          = gp_XY(P2.X(), P2.Y());
+        theTriangle.V3                          = gp_XY(P3.X(), P3.Y());
+        hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
       }
-      PH++;
     }
   }
 }
@@ -86,6 +86,20 @@ public:
                                       const bool                      HidingShell,
                                       HLRAlgo_EdgeStatus&             status);
 
+  //! Returns TRUE if the box of the segment overlaps the box of the hiding triangles.
+  bool IsOverlapping(const HLRAlgo_BiPoint::IndicesT& theIndices) const;
+
+  //! process hiding between <Pt1> and <Pt2> by one hiding triangle
+  //! of index <theHidingIndex> within PHDat() array.
+  //! HideByPolyData() is equal to this method called for all hiding triangles
+  //! when IsOverlapping() returns TRUE.
+  Standard_EXPORT void HideByTriangle(const int                       theHidingIndex,
+                                      const HLRAlgo_BiPoint::PointsT& thePoints,
+                                      Triangle&                       theTriangle,
+                                      HLRAlgo_BiPoint::IndicesT&      theIndices,
+                                      const bool                      HidingShell,
+                                      HLRAlgo_EdgeStatus&             status);
+
   FaceIndices& Indices() { return myFaceIndices; }
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyData, Standard_Transient)
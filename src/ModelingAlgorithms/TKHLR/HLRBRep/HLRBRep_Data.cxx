@@ -39,11 +39,13 @@
 #include <Precision.hxx>
 #include <Standard_Type.hxx>
 #include <StdFail_UndefinedDerivative.hxx>
+#include <TopoDS.hxx>
 #include <Standard_Integer.hxx>
 
 #include <cstdio>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_Data, Standard_Transient)
 
+#ifdef OCCT_DEBUG
 int nbOkIntersection;
 int nbPtIntersection;
 int nbSegIntersection;
@@ -51,6 +53,7 @@ int nbClassification;
 int nbCal1Intersection; // pairs of unrejected edges
 int nbCal2Intersection; // true intersections (not vertex)
 int nbCal3Intersection; // Curve-Surface intersections
+#endif
 
 static const double CutLar = 2.e-1;
 static const double CutBig = 1.e-1;
@@ -609,6 +612,47 @@ void HLRBRep_Data::Write(const occ::handle<HLRBRep_Data>& DS,
 
 //=================================================================================================
 
+occ::handle<HLRBRep_Data> HLRBRep_Data::Copy() const
+{
+  if (myEMap.Extent() != myNbEdges || myFMap.Extent() != myNbFaces)
+  {
+    return occ::handle<HLRBRep_Data>();
+  }
+
+  occ::handle<HLRBRep_Data> aCopy = new HLRBRep_Data(myNbVertices, myNbEdges, myNbFaces);
+  aCopy->myEMap      = myEMap;
+  aCopy->myFMap      = myFMap;
+  aCopy->myToler     = myToler;
+  aCopy->myProj      = myProj;
+  aCopy->myBigSize   = myBigSize;
+  aCopy->myHideCount = myHideCount;
+  for (int i = 0; i <= 15; i++)
+  {
+    aCopy->myDeca[i] = myDeca[i];
+    aCopy->mySurD[i] = mySurD[i];
+  }
+
+  for (int anEdgeIter = 1; anEdgeIter <= myNbEdges; ++anEdgeIter)
+  {
+    HLRBRep_EdgeData& anEdgeData = aCopy->myEData.ChangeValue(anEdgeIter);
+    anEdgeData                   = myEData.Value(anEdgeIter);
+    HLRBRep_Curve& aCurve        = anEdgeData.ChangeGeometry();
+    aCurve.Curve(TopoDS::Edge(myEMap.FindKey(anEdgeIter)));
+    aCurve.Projector(&aCopy->myProj);
+  }
+  for (int aFaceIter = 1; aFaceIter <= myNbFaces; ++aFaceIter)
+  {
+    HLRBRep_FaceData& aFaceData = aCopy->myFData.ChangeValue(aFaceIter);
+    aFaceData                   = myFData.Value(aFaceIter);
+    HLRBRep_Surface& aSurface   = aFaceData.Geometry();
+    aSurface.Surface(TopoDS::Face(myFMap.FindKey(aFaceIter)));
+    aSurface.Projector(&aCopy->myProj);
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
 void HLRBRep_Data::Update(const HLRAlgo_Projector& P)
 {
   myProj           = P;
@@ -1328,7 +1372,9 @@ void HLRBRep_Data::NextInterference()
             }
             if (!rej)
             {
+#ifdef OCCT_DEBUG
               nbCal1Intersection++;
+#endif
               bool h1      = false;
               bool e1      = false;
               bool h2      = false;
@@ -1374,7 +1420,9 @@ void HLRBRep_Data::NextInterference()
 
               if (myIntersected)
               { // compute real intersection
+#ifdef OCCT_DEBUG
                 nbCal2Intersection++;
+#endif
 
                 double da1 = 0;
                 double db1 = 0;
@@ -1441,7 +1489,9 @@ void HLRBRep_Data::NextInterference()
                     myNbSegments = myIntersector.NbSegments();
                     if ((myNbSegments + myNbPoints) > 0)
                     {
+#ifdef OCCT_DEBUG
                       nbOkIntersection++;
+#endif
                     }
                     else
                     {
@@ -1462,8 +1512,10 @@ void HLRBRep_Data::NextInterference()
                   }
                 }
               }
+#ifdef OCCT_DEBUG
               nbPtIntersection += myNbPoints;
               nbSegIntersection += myNbSegments;
+#endif
             }
           }
           else
@@ -1998,7 +2050,9 @@ TopAbs_State HLRBRep_Data::Classify(const int               E,
 {
   (void)E; // avoid compiler warning
 
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   double                            TotMin[16], TotMax[16];
 
@@ -2176,7 +2230,9 @@ q1,(q2>32768)? (32768-q2) : q2,q&0x80008000);
     }
   }
 
+#ifdef OCCT_DEBUG
   nbCal3Intersection++;
+#endif
   gp_Pnt   PLim;
   gp_Pnt2d Psta;
   Psta = EC.Value(sta);
@@ -2275,7 +2331,9 @@ TopAbs_State HLRBRep_Data::SimplClassify(const int /*E*/,
                                          const double            p1,
                                          const double            p2)
 {
+#ifdef OCCT_DEBUG
   nbClassification++;
+#endif
   HLRAlgo_EdgesBlock::MinMaxIndices VertMin, VertMax, MinMaxVert;
   double                            TotMin[16], TotMax[16];
 
@@ -67,6 +67,12 @@ public:
                              const int                        de,
                              const int                        df);
 
+  //! Creates a copy of me for hiding of edges in a separate thread.
+  //! Edges and faces data are copied with geometric adaptors initialized anew,
+  //! so that the copy does not share evaluation caches with me.
+  //! Returns null handle if the maps of edges and faces do not match the data.
+  Standard_EXPORT occ::handle<HLRBRep_Data> Copy() const;
+
   NCollection_Array1<HLRBRep_EdgeData>& EDataArray();
 
   NCollection_Array1<HLRBRep_FaceData>& FDataArray();
@@ -16,6 +16,8 @@
 
 #include <HLRAlgo.hxx>
 #include <HLRBRep_Data.hxx>
+#include <HLRBRep_EdgeData.hxx>
+#include <HLRBRep_FaceData.hxx>
 #include <HLRBRep_Hider.hxx>
 #include <HLRBRep_InternalAlgo.hxx>
 #include <HLRBRep_ShapeBounds.hxx>
@@ -30,10 +32,13 @@
 #include <fstream>
 #include <Standard_Type.hxx>
 #include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
 
+#include <algorithm>
 #include <cstdio>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
 
+#ifdef OCCT_DEBUG
 extern int nbPtIntersection;   // total P.I.
 extern int nbSegIntersection;  // total S.I
 extern int nbClassification;   // total classification
@@ -41,6 +46,7 @@ extern int nbOkIntersection;   // pairs of intersecting edges
 extern int nbCal1Intersection; // pairs of unrejected edges
 extern int nbCal2Intersection; // true intersections (not vertex)
 extern int nbCal3Intersection; // curve-surface intersections
+#endif
 
 static int HLRBRep_InternalAlgo_TRACE   = true;
 static int HLRBRep_InternalAlgo_TRACE10 = true;
@@ -48,7 +54,8 @@ static int HLRBRep_InternalAlgo_TRACE10 = true;
 //=================================================================================================
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
-    : myDebug(false)
+    : myDebug(false),
+      myRunParallel(false)
 {
 }
 
@@ -56,10 +63,11 @@ HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo(const occ::handle<HLRBRep_InternalAlgo>& A)
 {
-  myDS     = A->DataStructure();
-  myProj   = A->Projector();
-  myShapes = A->SeqOfShapeBounds();
-  myDebug  = A->Debug();
+  myDS          = A->DataStructure();
+  myProj        = A->Projector();
+  myShapes      = A->SeqOfShapeBounds();
+  myDebug       = A->Debug();
+  myRunParallel = A->RunParallel();
 }
 
 //=================================================================================================
@@ -929,38 +937,41 @@ void HLRBRep_InternalAlgo::HideSelected(const int I, const bool SideFace)
     j = 0;
 
     QWE = 0;
-    for (f = 1; f <= nf; f++)
+    if (!myRunParallel || !hideSelectedParallel(SB.MinMax(), e1, e2, Index))
     {
-      int               fi = Index(f);
-      HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
-      if (fd.Selected())
+      for (f = 1; f <= nf; f++)
       {
-        if (fd.Hiding())
+        int               fi = Index(f);
+        HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
+        if (fd.Selected())
         {
-          if (HLRBRep_InternalAlgo_TRACE10 && !static_cast<bool>(HLRBRep_InternalAlgo_TRACE))
+          if (fd.Hiding())
           {
-            if (++QWE > QWEQWE)
+            if (HLRBRep_InternalAlgo_TRACE10 && !static_cast<bool>(HLRBRep_InternalAlgo_TRACE))
             {
-              if (myDebug)
+              if (++QWE > QWEQWE)
               {
-                std::cout << ".";
+                if (myDebug)
+                {
+                  std::cout << ".";
+                }
+                QWE = 0;
               }
-              QWE = 0;
             }
-          }
-          else if (myDebug && HLRBRep_InternalAlgo_TRACE)
-          {
-            static int rty = 0;
-            j++;
-            printf("%6d", fi);
-            fflush(stdout);
-            if (++rty > 25)
+            else if (myDebug && HLRBRep_InternalAlgo_TRACE)
             {
-              rty = 0;
-              printf("\n");
+              static int rty = 0;
+              j++;
+              printf("%6d", fi);
+              fflush(stdout);
+              if (++rty > 25)
+              {
+                rty = 0;
+                printf("\n");
+              }
             }
+            Cache.Hide(fi, myMapOfShapeTool);
           }
-          Cache.Hide(fi, myMapOfShapeTool);
         }
       }
     }
@@ -1000,6 +1011,79 @@ void HLRBRep_InternalAlgo::HideSelected(const int I, const bool SideFace)
 
 //=================================================================================================
 
+bool HLRBRep_InternalAlgo::hideSelectedParallel(const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
+                                                const int                                E1,
+                                                const int                                E2,
+                                                const NCollection_Array1<int>&           FaceOrder)
+{
+  const occ::handle<OSD_ThreadPool>& aPool  = OSD_ThreadPool::DefaultPool();
+  const int                          aNbEdg = E2 - E1 + 1;
+  if (aNbEdg < 2 || myDS->EdgeMap().Extent() != myDS->NbEdges()
+      || myDS->FaceMap().Extent() != myDS->NbFaces())
+  {
+    return false;
+  }
+
+  // hiding faces in the order of processing
+  NCollection_Array1<HLRBRep_FaceData>& aFDataArray = myDS->FDataArray();
+  NCollection_Sequence<int>             aHidingFaces;
+  for (int f = FaceOrder.Lower(); f <= FaceOrder.Upper(); f++)
+  {
+    const HLRBRep_FaceData& fd = aFDataArray.Value(FaceOrder(f));
+    if (fd.Selected() && fd.Hiding())
+    {
+      aHidingFaces.Append(FaceOrder(f));
+    }
+  }
+
+  // Each range of edges is hidden by all the faces in the same order as in sequential mode,
+  // so that the status of every edge is computed exactly as without threads.
+  // Copies of the DataStructure and of the shape tools are created per thread.
+  typedef NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher>
+    ShapeToolMap;
+
+  OSD_ThreadPool::Launcher aLauncher(*aPool, aPool->NbDefaultThreadsToLaunch());
+  const int                aNbRanges = std::min(aNbEdg, aLauncher.NbThreads() * 4);
+  NCollection_Array1<occ::handle<HLRBRep_Data>> aCopies(aLauncher.LowerThreadIndex(),
+                                                        aLauncher.UpperThreadIndex());
+  NCollection_Array1<ShapeToolMap>              aShapeTools(aLauncher.LowerThreadIndex(),
+                                                            aLauncher.UpperThreadIndex());
+  NCollection_Array1<int>                       aRangeThreads(0, aNbRanges - 1);
+  const auto aRangeStart = [&](const int theRange) {
+    return E1 + int(int64_t(aNbEdg) * theRange / aNbRanges);
+  };
+  aLauncher.Perform(0, aNbRanges, [&](const int theThreadIndex, const int theRange) {
+    occ::handle<HLRBRep_Data>& aCopy = aCopies.ChangeValue(theThreadIndex);
+    if (aCopy.IsNull())
+    {
+      aCopy = myDS->Copy();
+    }
+    aRangeThreads.ChangeValue(theRange) = theThreadIndex;
+
+    aCopy->InitBoundSort(MinMaxTot, aRangeStart(theRange), aRangeStart(theRange + 1) - 1);
+    HLRBRep_Hider aHider(aCopy);
+    for (NCollection_Sequence<int>::Iterator aFaceIter(aHidingFaces); aFaceIter.More();
+         aFaceIter.Next())
+    {
+      aHider.Hide(aFaceIter.Value(), aShapeTools.ChangeValue(theThreadIndex));
+    }
+  });
+
+  // collect the statuses of edges
+  NCollection_Array1<HLRBRep_EdgeData>& aEDataArray = myDS->EDataArray();
+  for (int aRange = 0; aRange < aNbRanges; ++aRange)
+  {
+    const occ::handle<HLRBRep_Data>& aCopy = aCopies.Value(aRangeThreads.Value(aRange));
+    for (int e = aRangeStart(aRange); e < aRangeStart(aRange + 1); e++)
+    {
+      aEDataArray.ChangeValue(e).Status() = aCopy->EDataArray().ChangeValue(e).Status();
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
 void HLRBRep_InternalAlgo::Debug(const bool deb)
 {
   myDebug = deb;
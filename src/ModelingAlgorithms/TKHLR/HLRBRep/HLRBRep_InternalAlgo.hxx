@@ -27,6 +27,8 @@
 #include <BRepTopAdaptor_Tool.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Array1.hxx>
+#include <HLRAlgo_EdgesBlock.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Integer.hxx>
 class HLRBRep_Data;
@@ -119,6 +121,14 @@ public:
 
   Standard_EXPORT bool Debug() const;
 
+  //! Sets flag to hide edges in parallel threads (FALSE by default).
+  //! Edges are split into ranges hidden by copies of the data structure,
+  //! so that the result is the same as of sequential processing.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns flag to hide edges in parallel threads.
+  bool RunParallel() const { return myRunParallel; }
+
   Standard_EXPORT occ::handle<HLRBRep_Data> DataStructure() const;
 
   DEFINE_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
@@ -129,11 +139,20 @@ private:
   //! DataStructure.
   Standard_EXPORT void HideSelected(const int I, const bool SideFace);
 
+  //! Hides the edges <E1> to <E2> by the selected hiding faces taken in the order <FaceOrder>,
+  //! using copies of the DataStructure in parallel threads.
+  //! Returns FALSE if parallel hiding cannot be performed.
+  bool hideSelectedParallel(const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
+                            const int                                E1,
+                            const int                                E2,
+                            const NCollection_Array1<int>&           FaceOrder);
+
   occ::handle<HLRBRep_Data>                                                       myDS;
   HLRAlgo_Projector                                                               myProj;
   NCollection_Sequence<HLRBRep_ShapeBounds>                                       myShapes;
   NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher> myMapOfShapeTool;
   bool                                                                            myDebug;
+  bool                                                                            myRunParallel;
 };
 
 #endif // _HLRBRep_InternalAlgo_HeaderFile
@@ -147,6 +147,14 @@ public:
   //! defining the shape or shapes to be visualized.
   Standard_EXPORT void Update();
 
+  //! Sets flag to compute hiding of the segments within Update() in parallel threads
+  //! (FALSE by default). Hiding triangles of each segment are then found using BVH tree
+  //! built in the projected space instead of checking all the triangles.
+  void SetRunParallel(const bool theIsParallel) { myAlgo->SetRunParallel(theIsParallel); }
+
+  //! Returns flag to compute hiding of the segments in parallel threads.
+  bool RunParallel() const { return myAlgo->RunParallel(); }
+
   void InitHide() { myAlgo->InitHide(); }
 
   bool MoreHide() const { return myAlgo->MoreHide(); }
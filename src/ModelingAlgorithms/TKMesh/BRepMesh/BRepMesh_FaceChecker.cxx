@@ -16,7 +16,7 @@
 #include <BRepMesh_FaceChecker.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshData_Edge.hxx>
-#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <BRepMesh_GeomTool.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_FaceChecker, Standard_Transient)
@@ -41,22 +41,21 @@ public:
     myWiresBndBoxTree = new BRepMesh_FaceChecker::ArrayOfBndBoxTree(0, myDFace->WiresNb() - 1);
   }
 
-  //! Performs initialization of wire with the given index.
-  void operator()(const int theWireIndex) const
+  //! Performs initialization of wire with the given index
+  //! using the allocator of the calling thread.
+  void operator()(const int                                    theWireIndex,
+                  const occ::handle<NCollection_IncAllocator>& theAllocator) const
   {
     const IMeshData::IWireHandle& aDWire = myDFace->GetWire(theWireIndex);
 
-    occ::handle<NCollection_IncAllocator> aTmpAlloc1 = new NCollection_IncAllocator();
-
     Handle(BRepMesh_FaceChecker::Segments) aSegments =
-      new BRepMesh_FaceChecker::Segments(aDWire->EdgesNb(), aTmpAlloc1);
-    Handle(IMeshData::BndBox2dTree) aBndBoxTree = new IMeshData::BndBox2dTree(aTmpAlloc1);
+      new BRepMesh_FaceChecker::Segments(aDWire->EdgesNb(), theAllocator);
+    Handle(IMeshData::BndBox2dTree) aBndBoxTree = new IMeshData::BndBox2dTree(theAllocator);
 
     myWiresSegments->ChangeValue(theWireIndex)   = aSegments;
     myWiresBndBoxTree->ChangeValue(theWireIndex) = aBndBoxTree;
 
-    occ::handle<NCollection_IncAllocator> aTmpAlloc2 = new NCollection_IncAllocator();
-    IMeshData::BndBox2dTreeFiller         aBndBoxTreeFiller(*aBndBoxTree, aTmpAlloc2);
+    IMeshData::BndBox2dTreeFiller aBndBoxTreeFiller(*aBndBoxTree, theAllocator);
 
     for (int aEdgeIt = 0; aEdgeIt < aDWire->EdgesNb(); ++aEdgeIt)
     {
@@ -101,11 +100,12 @@ class BndBox2dTreeSelector : public IMeshData::BndBox2dTree::Selector
 {
 public:
   //! Constructor.
-  BndBox2dTreeSelector(const double theTolerance)
+  BndBox2dTreeSelector(const double                                 theTolerance,
+                       const occ::handle<NCollection_IncAllocator>& theAllocator)
       : myMaxLoopSize(M_PI * theTolerance * theTolerance),
         mySelfSegmentIndex(-1),
         mySegment(nullptr),
-        myIndices(256, new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE))
+        myIndices(256, theAllocator)
   {
   }
 
@@ -224,9 +224,16 @@ BRepMesh_FaceChecker::~BRepMesh_FaceChecker() = default;
 bool BRepMesh_FaceChecker::Perform()
 {
   myIntersectingEdges = new IMeshData::MapOfIEdgePtr;
-  collectSegments();
 
-  OSD_Parallel::For(0, myDFace->WiresNb(), *this, !isParallel());
+  // temporary data of each thread are allocated in its own arena taking no lock;
+  // segments of one wire are read by threads checking other wires after collectSegments()
+  OSD_ThreadPool::Launcher        aLauncher(*OSD_ThreadPool::DefaultPool(), isParallel() ? -1 : 1);
+  NCollection_IncAllocatorArenas& anArenas = aLauncher.Arenas();
+  collectSegments(aLauncher);
+
+  aLauncher.Perform(0, myDFace->WiresNb(), [this, &anArenas](int theThreadIndex, int theWireIndex) {
+    perform(theWireIndex, anArenas.Allocator(theThreadIndex));
+  });
   collectResult();
 
   myWiresBndBoxTree.Nullify();
@@ -237,24 +244,30 @@ bool BRepMesh_FaceChecker::Perform()
 
 //=================================================================================================
 
-void BRepMesh_FaceChecker::collectSegments()
+void BRepMesh_FaceChecker::collectSegments(OSD_ThreadPool::Launcher& theLauncher)
 {
-  SegmentsFiller aSegmentsFiller(myDFace, myWiresSegments, myWiresBndBoxTree);
-  OSD_Parallel::For(0, myDFace->WiresNb(), aSegmentsFiller, !isParallel());
+  SegmentsFiller                  aSegmentsFiller(myDFace, myWiresSegments, myWiresBndBoxTree);
+  NCollection_IncAllocatorArenas& anArenas = theLauncher.Arenas();
+  theLauncher.Perform(0,
+                      myDFace->WiresNb(),
+                      [&aSegmentsFiller, &anArenas](int theThreadIndex, int theWireIndex) {
+                        aSegmentsFiller(theWireIndex, anArenas.Allocator(theThreadIndex));
+                      });
 
   myWiresIntersectingEdges = new ArrayOfMapOfIEdgePtr(0, myDFace->WiresNb() - 1);
 }
 
 //=================================================================================================
 
-void BRepMesh_FaceChecker::perform(const int theWireIndex) const
+void BRepMesh_FaceChecker::perform(const int                                    theWireIndex,
+                                   const occ::handle<NCollection_IncAllocator>& theAllocator) const
 {
   const occ::handle<Segments>&      aSegments1 = myWiresSegments->Value(theWireIndex);
   Handle(IMeshData::MapOfIEdgePtr)& aIntersections =
     myWiresIntersectingEdges->ChangeValue(theWireIndex);
 
   // TODO: Tolerance is set to twice value of face deflection in order to fit regressions.
-  BndBox2dTreeSelector aSelector(2 * myDFace->GetDeflection());
+  BndBox2dTreeSelector aSelector(2 * myDFace->GetDeflection(), theAllocator);
   for (int aWireIt = theWireIndex; aWireIt < myDFace->WiresNb(); ++aWireIt)
   {
     const Handle(IMeshData::BndBox2dTree)& aBndBoxTree2 = myWiresBndBoxTree->Value(aWireIt);
@@ -21,6 +21,7 @@
 #include <IMeshData_Face.hxx>
 #include <Standard_Type.hxx>
 #include <NCollection_Shared.hxx>
+#include <OSD_ThreadPool.hxx>
 
 //! Auxiliary class checking wires of target face for self-intersections.
 //! Explodes wires of discrete face on sets of segments using tessellation
@@ -75,7 +76,10 @@ public: //! @name mesher API
   }
 
   //! Checks wire with the given index for intersection with others.
-  void operator()(const int theWireIndex) const { perform(theWireIndex); }
+  void operator()(const int theWireIndex) const
+  {
+    perform(theWireIndex, new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE));
+  }
 
   DEFINE_STANDARD_RTTIEXT(BRepMesh_FaceChecker, Standard_Transient)
 
@@ -83,14 +87,16 @@ private:
   //! Returns True in case if check can be performed in parallel mode.
   bool isParallel() const { return (myParameters.InParallel && myDFace->WiresNb() > 1); }
 
-  //! Collects face segments.
-  void collectSegments();
+  //! Collects face segments using the threads and the arenas of the launcher.
+  void collectSegments(OSD_ThreadPool::Launcher& theLauncher);
 
   //! Collects intersecting edges.
   void collectResult();
 
-  //! Checks wire with the given index for intersection with others.
-  void perform(const int theWireIndex) const;
+  //! Checks wire with the given index for intersection with others
+  //! using the allocator for temporary data.
+  void perform(const int                                    theWireIndex,
+               const occ::handle<NCollection_IncAllocator>& theAllocator) const;
 
 private:
   BRepMesh_FaceChecker(const BRepMesh_FaceChecker& theOther) = delete;
@@ -42,6 +42,8 @@
 #include <NCollection_Map.hxx>
 #include <ChFi3d.hxx>
 #include <LocalAnalysis_SurfaceContinuity.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_Parallel.hxx>
 
 static void CorrectOrientationOfTangent(gp_Vec&              TangVec,
                                         const TopoDS_Vertex& aVertex,
@@ -63,6 +65,7 @@ static bool CheckMixedContinuity(const TopoDS_Edge& theEdge,
 
 BRepOffset_Analyse::BRepOffset_Analyse()
     : myOffset(0.0),
+      myRunParallel(false),
       myDone(false)
 {
 }
@@ -71,6 +74,7 @@ BRepOffset_Analyse::BRepOffset_Analyse()
 
 BRepOffset_Analyse::BRepOffset_Analyse(const TopoDS_Shape& S, const double Angle)
     : myOffset(0.0),
+      myRunParallel(false),
       myDone(false)
 {
   Perform(S, Angle);
@@ -301,60 +305,77 @@ void BRepOffset_Analyse::Perform(const TopoDS_Shape&          S,
   // Build ancestors.
   BuildAncestors(S, myAncestors);
 
+  // Collect the edges to analyse in the order of exploration
+  NCollection_DynamicArray<TopoDS_Edge> anEdges;
+  for (TopExp_Explorer Exp(S.Oriented(TopAbs_FORWARD), TopAbs_EDGE); Exp.More(); Exp.Next())
+  {
+    const TopoDS_Edge& E = TopoDS::Edge(Exp.Current());
+    if (!myMapEdgeType.IsBound(E))
+    {
+      myMapEdgeType.Bind(E, NCollection_List<BRepOffset_Interval>());
+      anEdges.Append(E);
+    }
+  }
+
+  // The edges are analysed independently
   NCollection_List<TopoDS_Shape> aLETang;
-  TopExp_Explorer                Exp(S.Oriented(TopAbs_FORWARD), TopAbs_EDGE);
   Message_ProgressScope          aPSOuter(theRange, nullptr, 2);
   Message_ProgressScope          aPS(aPSOuter.Next(), "Performing edges analysis", 1, true);
-  for (; Exp.More(); Exp.Next(), aPS.Next())
-  {
-    if (!aPS.More())
+  const auto anAnalyseEdge = [&](const int theIndex) {
+    const TopoDS_Edge&                     E  = anEdges.Value(theIndex);
+    NCollection_List<BRepOffset_Interval>& LI = myMapEdgeType.ChangeFind(E);
+    const NCollection_List<TopoDS_Shape>&  L  = Ancestors(E);
+    if (L.Extent() == 2)
     {
-      return;
+      const TopoDS_Face& F1 = TopoDS::Face(L.First());
+      const TopoDS_Face& F2 = TopoDS::Face(L.Last());
+      EdgeAnalyse(E, F1, F2, SinTol, LI);
     }
-    const TopoDS_Edge& E = TopoDS::Edge(Exp.Current());
-    if (!myMapEdgeType.IsBound(E))
+    else if (L.Extent() == 1)
     {
-      NCollection_List<BRepOffset_Interval> LI;
-      myMapEdgeType.Bind(E, LI);
+      double             U1, U2;
+      const TopoDS_Face& F = TopoDS::Face(L.First());
+      BRep_Tool::Range(E, F, U1, U2);
+      BRepOffset_Interval Inter(U1, U2, ChFiDS_Other);
 
-      const NCollection_List<TopoDS_Shape>& L = Ancestors(E);
-      if (L.IsEmpty())
+      if (!BRepTools::IsReallyClosed(E, F))
       {
-        continue;
+        Inter.Type(ChFiDS_FreeBound);
       }
+      LI.Append(Inter);
+    }
+    else if (L.Extent() > 2)
+    {
+#ifdef OCCT_DEBUG
+      std::cout << "edge shared by more than two faces" << std::endl;
+#endif
+    }
+  };
 
-      if (L.Extent() == 2)
+  if (myRunParallel)
+  {
+    OSD_Parallel::For(0, anEdges.Length(), anAnalyseEdge);
+    aPS.Next();
+  }
+  for (int anEdgeIter = 0; anEdgeIter < anEdges.Length(); ++anEdgeIter)
+  {
+    if (!myRunParallel)
+    {
+      if (!aPS.More())
       {
-        const TopoDS_Face& F1 = TopoDS::Face(L.First());
-        const TopoDS_Face& F2 = TopoDS::Face(L.Last());
-        EdgeAnalyse(E, F1, F2, SinTol, myMapEdgeType(E));
-
-        // For tangent faces add artificial perpendicular face
-        // to close the gap between them (if they have different offset values)
-        if (myMapEdgeType(E).Last().Type() == ChFiDS_Tangential)
-        {
-          aLETang.Append(E);
-        }
+        return;
       }
-      else if (L.Extent() == 1)
-      {
-        double             U1, U2;
-        const TopoDS_Face& F = TopoDS::Face(L.First());
-        BRep_Tool::Range(E, F, U1, U2);
-        BRepOffset_Interval Inter(U1, U2, ChFiDS_Other);
+      anAnalyseEdge(anEdgeIter);
+      aPS.Next();
+    }
 
-        if (!BRepTools::IsReallyClosed(E, F))
-        {
-          Inter.Type(ChFiDS_FreeBound);
-        }
-        myMapEdgeType(E).Append(Inter);
-      }
-      else
-      {
-#ifdef OCCT_DEBUG
-        std::cout << "edge shared by more than two faces" << std::endl;
-#endif
-      }
+    // For tangent faces add artificial perpendicular face
+    // to close the gap between them (if they have different offset values)
+    const TopoDS_Edge&                           E  = anEdges.Value(anEdgeIter);
+    const NCollection_List<BRepOffset_Interval>& LI = myMapEdgeType.Find(E);
+    if (Ancestors(E).Extent() == 2 && LI.Last().Type() == ChFiDS_Tangential)
+    {
+      aLETang.Append(E);
     }
   }
 
@@ -118,6 +118,12 @@ public: //! @name Results
 
   void SetOffsetValue(const double theOffset) { myOffset = theOffset; }
 
+  //! Sets the flag to analyse the edges in parallel threads (FALSE by default)
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag to analyse the edges in parallel threads
+  bool RunParallel() const { return myRunParallel; }
+
   //! Sets the face-offset data map to analyze tangential cases
   void SetFaceOffsetMap(
     const NCollection_DataMap<TopoDS_Shape, double, TopTools_ShapeMapHasher>& theMap)
@@ -166,6 +172,8 @@ private: //! @name Fields
     myFaceOffsetMap; //!< Map to store offset values for the faces.
                      //!  Should be set by the calling algorithm.
 
+  bool myRunParallel; //!< Flag to analyse the edges in parallel threads
+
   // Results
   bool myDone; //!< Status of the algorithm
 
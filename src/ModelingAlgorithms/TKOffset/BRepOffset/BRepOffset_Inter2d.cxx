@@ -63,6 +63,8 @@
 #include <NCollection_Sequence.hxx>
 #include <gp_Pnt2d.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -413,6 +415,45 @@ static void Store(
 
 //=================================================================================================
 
+namespace
+{
+//! 2d intersection points of the pair of edges on the face.
+struct EdgeInter2d
+{
+  TopoDS_Face                    Face;               //!< face (in FORWARD orientation)
+  TopoDS_Edge                    Edge1;              //!< first edge
+  TopoDS_Edge                    Edge2;              //!< second edge
+  NCollection_Sequence<gp_Pnt2d> Points;             //!< intersection points on the face
+  NCollection_Sequence<double>   Params1;            //!< parameters of points on the first edge
+  NCollection_Sequence<double>   Params2;            //!< parameters of points on the second edge
+  bool                           IsComputed = false; //!< flag of points computed beforehand
+};
+} // namespace
+
+//=======================================================================
+// function : IntersectPCurves
+// purpose  : Intersects the 2d curves of the edges on the face
+//=======================================================================
+static void IntersectPCurves(const occ::handle<Geom2d_Curve>& thePCurve1,
+                             const double                     theF1,
+                             const double                     theL1,
+                             const occ::handle<Geom2d_Curve>& thePCurve2,
+                             const double                     theF2,
+                             const double                     theL2,
+                             EdgeInter2d&                     theInter)
+{
+  const double        TolDub = 1.e-7;
+  Geom2dAdaptor_Curve GAC1(thePCurve1, theF1, theL1);
+  Geom2dAdaptor_Curve GAC2(thePCurve2, theF2, theL2);
+  Geom2dInt_GInter    Inter2d(GAC1, GAC2, TolDub, TolDub);
+  for (int i = 1; i <= Inter2d.NbPoints(); i++)
+  {
+    theInter.Points.Append(Inter2d.Point(i).Value());
+    theInter.Params1.Append(Inter2d.Point(i).ParamOnFirst());
+    theInter.Params2.Append(Inter2d.Point(i).ParamOnSecond());
+  }
+}
+
 static void EdgeInter(
   const TopoDS_Face&                 F,
   const BRepAdaptor_Surface&         BAsurf,
@@ -422,7 +463,8 @@ static void EdgeInter(
   double                             Tol,
   bool                               WithOri,
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
-    aDMVV)
+                     aDMVV,
+  const EdgeInter2d* thePrecomputed = nullptr)
 {
 
   if (E1.IsSame(E2))
@@ -431,7 +473,6 @@ static void EdgeInter(
   }
 
   double f[3], l[3];
-  double TolDub = 1.e-7;
   int    i;
 
   BRep_Tool::Range(E1, f[1], l[1]);
@@ -479,10 +520,13 @@ static void EdgeInter(
     //
     occ::handle<Geom2d_Curve> pcurve1 = BRep_Tool::CurveOnSurface(E1, F, f[1], l[1]);
     occ::handle<Geom2d_Curve> pcurve2 = BRep_Tool::CurveOnSurface(E2, F, f[2], l[2]);
-    Geom2dAdaptor_Curve       GAC1(pcurve1, f[1], l[1]);
-    Geom2dAdaptor_Curve       GAC2(pcurve2, f[2], l[2]);
-    Geom2dInt_GInter          Inter2d(GAC1, GAC2, TolDub, TolDub);
-    for (i = 1; i <= Inter2d.NbPoints(); i++)
+    EdgeInter2d               anInter2d;
+    if (thePrecomputed == nullptr)
+    {
+      IntersectPCurves(pcurve1, f[1], l[1], pcurve2, f[2], l[2], anInter2d);
+    }
+    const EdgeInter2d& Inter2d = thePrecomputed != nullptr ? *thePrecomputed : anInter2d;
+    for (i = 1; i <= Inter2d.Points.Length(); i++)
     {
       gp_Pnt P3d;
       if (WithDegen)
@@ -491,12 +535,12 @@ static void EdgeInter(
       }
       else
       {
-        gp_Pnt2d P2d = Inter2d.Point(i).Value();
-        P3d          = BAsurf.Value(P2d.X(), P2d.Y());
+        const gp_Pnt2d& P2d = Inter2d.Points(i);
+        P3d                 = BAsurf.Value(P2d.X(), P2d.Y());
       }
       ResPoints.Append(P3d);
-      ResParamsOnE1.Append(Inter2d.Point(i).ParamOnFirst());
-      ResParamsOnE2.Append(Inter2d.Point(i).ParamOnSecond());
+      ResParamsOnE1.Append(Inter2d.Params1(i));
+      ResParamsOnE2.Append(Inter2d.Params2(i));
     }
 
     for (i = 1; i <= ResPoints.Length(); i++)
@@ -1720,20 +1764,18 @@ static bool UpdateVertex(const TopoDS_Vertex& V, TopoDS_Edge& OE, TopoDS_Edge& N
   return OK;
 }
 
-//=================================================================================================
-
-void BRepOffset_Inter2d::Compute(
+//=======================================================================
+// function : CollectEdgesToIntersect
+// purpose  : Collects the pairs of edges of the face to intersect
+//=======================================================================
+static void CollectEdgesToIntersect(
   const occ::handle<BRepAlgo_AsDes>&                                   AsDes,
   const TopoDS_Face&                                                   F,
   const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges,
-  const double                                                         Tol,
   const NCollection_DataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
-    theEdgeIntEdges,
-  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
-                               theDMVV,
-  const Message_ProgressRange& theRange)
+                                         theEdgeIntEdges,
+  NCollection_DynamicArray<EdgeInter2d>& thePairs)
 {
-
   // Do not intersect the edges of face
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> EdgesOfFace;
   TopExp_Explorer                                        Explo(F, TopAbs_EDGE);
@@ -1742,6 +1784,8 @@ void BRepOffset_Inter2d::Compute(
     EdgesOfFace.Add(Explo.Current());
   }
 
+  const TopoDS_Face aFF = TopoDS::Face(F.Oriented(TopAbs_FORWARD));
+
   //-----------------------------------------------------------
   // calculate intersections2d on faces touched by
   // intersection3d
@@ -1753,17 +1797,9 @@ void BRepOffset_Inter2d::Compute(
   // Intersection of edges 2*2.
   //-----------------------------------------------
   const NCollection_List<TopoDS_Shape>& LE = AsDes->Descendant(F);
-  TopoDS_Vertex                         V1, V2;
   int                                   j, i = 1;
-  BRepAdaptor_Surface                   BAsurf(F);
-  //
-  Message_ProgressScope aPS(theRange, "Intersecting edges on faces", LE.Extent());
-  for (it1LE.Initialize(LE); it1LE.More(); it1LE.Next(), aPS.Next())
+  for (it1LE.Initialize(LE); it1LE.More(); it1LE.Next())
   {
-    if (!aPS.More())
-    {
-      return;
-    }
     const TopoDS_Edge& E1 = TopoDS::Edge(it1LE.Value());
     j                     = 1;
     it2LE.Initialize(LE);
@@ -1813,10 +1849,10 @@ void BRepOffset_Inter2d::Compute(
       if (ToIntersect && (!EdgesOfFace.Contains(E1) || !EdgesOfFace.Contains(E2))
           && (NewEdges.Contains(E1) || NewEdges.Contains(E2)))
       {
-
-        TopoDS_Shape aLocalShape = F.Oriented(TopAbs_FORWARD);
-        EdgeInter(TopoDS::Face(aLocalShape), BAsurf, E1, E2, AsDes, Tol, true, theDMVV);
-        //          EdgeInter(TopoDS::Face(F.Oriented(TopAbs_FORWARD)),E1,E2,AsDes,Tol,true);
+        EdgeInter2d& aPair = thePairs.Appended();
+        aPair.Face         = aFF;
+        aPair.Edge1        = E1;
+        aPair.Edge2        = E2;
       }
       it2LE.Next();
       j++;
@@ -1825,6 +1861,138 @@ void BRepOffset_Inter2d::Compute(
   }
 }
 
+//=======================================================================
+// function : IntersectEdges
+// purpose  : Intersects the pairs of edges [theFirst, theLast) of the same face
+//=======================================================================
+static void IntersectEdges(
+  const occ::handle<BRepAlgo_AsDes>&           AsDes,
+  const NCollection_DynamicArray<EdgeInter2d>& thePairs,
+  const int                                    theFirst,
+  const int                                    theLast,
+  const double                                 Tol,
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
+                               theDMVV,
+  const Message_ProgressRange& theRange)
+{
+  if (theFirst == theLast)
+  {
+    return;
+  }
+
+  BRepAdaptor_Surface   BAsurf(thePairs(theFirst).Face);
+  Message_ProgressScope aPS(theRange, "Intersecting edges on faces", theLast - theFirst);
+  for (int i = theFirst; i < theLast; i++, aPS.Next())
+  {
+    if (!aPS.More())
+    {
+      return;
+    }
+    const EdgeInter2d& aPair = thePairs(i);
+    EdgeInter(aPair.Face,
+              BAsurf,
+              aPair.Edge1,
+              aPair.Edge2,
+              AsDes,
+              Tol,
+              true,
+              theDMVV,
+              aPair.IsComputed ? &aPair : nullptr);
+  }
+}
+
+//=================================================================================================
+
+void BRepOffset_Inter2d::Compute(
+  const occ::handle<BRepAlgo_AsDes>&                                   AsDes,
+  const TopoDS_Face&                                                   F,
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges,
+  const double                                                         Tol,
+  const NCollection_DataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
+    theEdgeIntEdges,
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
+                               theDMVV,
+  const Message_ProgressRange& theRange)
+{
+  NCollection_DynamicArray<EdgeInter2d> aPairs;
+  CollectEdgesToIntersect(AsDes, F, NewEdges, theEdgeIntEdges, aPairs);
+  IntersectEdges(AsDes, aPairs, 0, aPairs.Length(), Tol, theDMVV, theRange);
+}
+
+//=================================================================================================
+
+bool BRepOffset_Inter2d::Compute(
+  const occ::handle<BRepAlgo_AsDes>&                                   AsDes,
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theFaces,
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges,
+  const double                                                         Tol,
+  const NCollection_DataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
+    theEdgeIntEdges,
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
+                               theDMVV,
+  const bool                   theRunParallel,
+  const Message_ProgressRange& theRange)
+{
+  // Collect the pairs of edges to intersect on all faces
+  NCollection_DynamicArray<EdgeInter2d> aPairs;
+  NCollection_Array1<int>               aFirstPairs(1, theFaces.Extent() + 1);
+  for (int i = 1; i <= theFaces.Extent(); i++)
+  {
+    aFirstPairs(i) = aPairs.Length();
+    CollectEdgesToIntersect(AsDes, TopoDS::Face(theFaces(i)), NewEdges, theEdgeIntEdges, aPairs);
+  }
+  aFirstPairs(theFaces.Extent() + 1) = aPairs.Length();
+
+  Message_ProgressScope aPS(theRange, "Intersecting edges on faces", theFaces.Extent() + 1);
+  if (theRunParallel)
+  {
+    // The 2d intersections of the edges already having 3d curves do not depend on the
+    // intersection vertices stored on the other pairs, thus may be computed beforehand.
+    // The 3d curves of the other edges are built during the sequential processing only.
+    OSD_Parallel::For(0, aPairs.Length(), [&aPairs](const int thePairIndex) {
+      EdgeInter2d& aPair = aPairs.ChangeValue(thePairIndex);
+      if (aPair.Edge1.IsSame(aPair.Edge2))
+      {
+        return;
+      }
+      TopoDS_Vertex aCV;
+      if (TopExp::CommonVertex(aPair.Edge1, aPair.Edge2, aCV))
+      {
+        return;
+      }
+      double f1, l1, f2, l2;
+      if (BRep_Tool::Curve(aPair.Edge1, f1, l1).IsNull()
+          || BRep_Tool::Curve(aPair.Edge2, f2, l2).IsNull())
+      {
+        return;
+      }
+      const occ::handle<Geom2d_Curve> aPC1 =
+        BRep_Tool::CurveOnSurface(aPair.Edge1, aPair.Face, f1, l1);
+      const occ::handle<Geom2d_Curve> aPC2 =
+        BRep_Tool::CurveOnSurface(aPair.Edge2, aPair.Face, f2, l2);
+      IntersectPCurves(aPC1, f1, l1, aPC2, f2, l2, aPair);
+      aPair.IsComputed = true;
+    });
+  }
+  aPS.Next();
+
+  for (int i = 1; i <= theFaces.Extent(); i++)
+  {
+    if (!aPS.More())
+    {
+      return false;
+    }
+    IntersectEdges(AsDes,
+                   aPairs,
+                   aFirstPairs(i),
+                   aFirstPairs(i + 1),
+                   Tol,
+                   theDMVV,
+                   aPS.Next());
+  }
+  return aPS.More();
+}
+
 //=================================================================================================
 
 bool BRepOffset_Inter2d::ConnexIntByInt(
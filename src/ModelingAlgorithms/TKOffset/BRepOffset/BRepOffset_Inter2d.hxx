@@ -58,6 +58,25 @@ public:
                                TopTools_ShapeMapHasher>&                 theDMVV,
     const Message_ProgressRange&                                         theRange);
 
+  //! Computes the intersections between the edges stored in AsDes
+  //! as descendants of each face of theFaces (see the method above).
+  //! When theRunParallel is TRUE, the 2d intersections of the edges
+  //! are computed beforehand in parallel threads.
+  //! Returns FALSE in case of user break.
+  Standard_EXPORT static bool Compute(
+    const occ::handle<BRepAlgo_AsDes>&                                   AsDes,
+    const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theFaces,
+    const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges,
+    const double                                                         Tol,
+    const NCollection_DataMap<TopoDS_Shape,
+                              NCollection_List<TopoDS_Shape>,
+                              TopTools_ShapeMapHasher>&                  theEdgeIntEdges,
+    NCollection_IndexedDataMap<TopoDS_Shape,
+                               NCollection_List<TopoDS_Shape>,
+                               TopTools_ShapeMapHasher>&                 theDMVV,
+    const bool                                                           theRunParallel,
+    const Message_ProgressRange&                                         theRange);
+
   //! Computes the intersection between the offset edges of the <FI>.
   //! All intersection vertices will be stored in AsDes2d.
   //! When all faces of the shape are treated the intersection vertices
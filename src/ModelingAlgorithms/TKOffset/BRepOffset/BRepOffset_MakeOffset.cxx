@@ -93,6 +93,7 @@
 #include <Geom_Line.hxx>
 #include <NCollection_DynamicArray.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_Parallel.hxx>
 //
 #include <BOPAlgo_MakerVolume.hxx>
 #include <BOPTools_AlgoTools.hxx>
@@ -259,6 +260,7 @@ static void GetEnlargedFaces(
 static bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
                                      BRepAlgo_Image&                       theImage,
                                      TopoDS_Shape&                         theShells,
+                                     const bool                            theRunParallel,
                                      const Message_ProgressRange&          theRange);
 
 static bool GetSubShapes(const TopoDS_Shape&    theShape,
@@ -604,6 +606,7 @@ static void FillContours(
 //=================================================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+    : myRunParallel(false)
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -630,7 +633,8 @@ BRepOffset_MakeOffset::BRepOffset_MakeOffset(const TopoDS_Shape&          S,
       myJoin(Join),
       myThickening(Thickening),
       myRemoveIntEdges(RemoveIntEdges),
-      myDone(false)
+      myDone(false),
+      myRunParallel(false)
 {
   myAsDes                  = new BRepAlgo_AsDes();
   myIsLinearizationAllowed = true;
@@ -887,6 +891,7 @@ void BRepOffset_MakeOffset::MakeOffsetShape(const Message_ProgressRange& theRang
     myAnalyse.SetOffsetValue(myOffset);
     myAnalyse.SetFaceOffsetMap(myFaceOffset);
   }
+  myAnalyse.SetRunParallel(myRunParallel);
   myAnalyse.Perform(myFaceComp, TolAngle, aPS.Next(aSteps(PIOperation_Analyse)));
   TopExp_Explorer anEExp(myFaceComp, TopAbs_EDGE);
   for (; anEExp.More(); anEExp.Next())
@@ -1212,6 +1217,34 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
   //
   BRepLib::SortFaces(myFaceComp, aLF);
   //
+  // The faces without tangential edges do not share the offset edges
+  // with other faces, thus they can be built independently in advance
+  NCollection_DynamicArray<TopoDS_Shape>                          aFacesToBuild;
+  NCollection_DynamicArray<BRepOffset_Offset>                     aBuiltOffsets;
+  NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> aBuiltIndices;
+  if (myRunParallel)
+  {
+    for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next())
+    {
+      NCollection_List<TopoDS_Shape> Let;
+      myAnalyse.Edges(TopoDS::Face(aItLF.Value()), ChFiDS_Tangential, Let);
+      if (Let.IsEmpty())
+      {
+        aBuiltIndices.Bind(aItLF.Value(), aFacesToBuild.Length());
+        aFacesToBuild.Append(aItLF.Value());
+        aBuiltOffsets.Append(BRepOffset_Offset());
+      }
+    }
+    OSD_Parallel::For(0, aFacesToBuild.Length(), [&](const int theIndex) {
+      const TopoDS_Face& aF       = TopoDS::Face(aFacesToBuild.Value(theIndex));
+      const double*      anOffset = myFaceOffset.Seek(aF);
+      aBuiltOffsets.ChangeValue(theIndex).Init(aF,
+                                               anOffset != nullptr ? *anOffset : myOffset,
+                                               OffsetOutside,
+                                               myJoin);
+    });
+  }
+  //
   Message_ProgressScope aPS(theRange, "Making offset faces", aLF.Extent());
   aItLF.Initialize(aLF);
   for (; aItLF.More(); aItLF.Next(), aPS.Next())
@@ -1222,7 +1255,12 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
       return;
     }
     const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
-    aCurOffset            = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+    if (const int* aBuiltIndex = aBuiltIndices.Seek(aF))
+    {
+      theMapSF.Bind(aF, aBuiltOffsets.Value(*aBuiltIndex));
+      continue;
+    }
+    aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
     BRepOffset_Offset              OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
     NCollection_List<TopoDS_Shape> Let;
     myAnalyse.Edges(aF, ChFiDS_Tangential, Let);
@@ -2961,17 +2999,17 @@ void BRepOffset_MakeOffset::Intersection2D(
   //-----------------------------------------------
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
                         aDMVV;
-  int                   i;
-  Message_ProgressScope aPS(theRange, "Intersection 2D", Modif.Extent());
-  for (i = 1; i <= Modif.Extent(); i++)
+  if (!BRepOffset_Inter2d::Compute(myAsDes,
+                                   Modif,
+                                   NewEdges,
+                                   myTol,
+                                   myEdgeIntEdges,
+                                   aDMVV,
+                                   myRunParallel,
+                                   theRange))
   {
-    if (!aPS.More())
-    {
-      myError = BRepOffset_UserBreak;
-      return;
-    }
-    const TopoDS_Face& F = TopoDS::Face(Modif(i));
-    BRepOffset_Inter2d::Compute(myAsDes, F, NewEdges, myTol, myEdgeIntEdges, aDMVV, aPS.Next());
+    myError = BRepOffset_UserBreak;
+    return;
   }
   //
   BRepOffset_Inter2d::FuseVertices(aDMVV, myAsDes, myImageVV);
@@ -3756,7 +3794,7 @@ void BRepOffset_MakeOffset::MakeShells(const Message_ProgressRange& theRange)
   {
     //
     TopoDS_Shape aShells;
-    bDone = BuildShellsCompleteInter(aLSF, myImageOffset, aShells, aPS.Next());
+    bDone = BuildShellsCompleteInter(aLSF, myImageOffset, aShells, myRunParallel, aPS.Next());
     if (bDone)
     {
       myOffsetShape = aShells;
@@ -5064,11 +5102,13 @@ void GetEnlargedFaces(
 bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
                               BRepAlgo_Image&                       theImage,
                               TopoDS_Shape&                         theShells,
+                              const bool                            theRunParallel,
                               const Message_ProgressRange&          theRange)
 {
   Message_ProgressScope aPS(theRange, nullptr, 5);
   // make solids
   BOPAlgo_MakerVolume aMV1;
+  aMV1.SetRunParallel(theRunParallel);
   aMV1.SetArguments(theLF);
   // we need to intersect the faces to process the tangential faces
   aMV1.SetIntersect(true);
@@ -5157,6 +5197,7 @@ bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
   //
   // make solids from the new list
   BOPAlgo_MakerVolume aMV2;
+  aMV2.SetRunParallel(theRunParallel);
   aMV2.SetArguments(aLF);
   // no need to intersect this time
   aMV2.SetIntersect(false);
@@ -5212,6 +5253,7 @@ bool BuildShellsCompleteInter(const NCollection_List<TopoDS_Shape>& theLF,
   //
   // make solid from most outer faces with correct normal direction
   BOPAlgo_MakerVolume aMV3;
+  aMV3.SetRunParallel(theRunParallel);
   aMV3.SetArguments(aLF);
   aMV3.SetIntersect(false);
   aMV3.SetAvoidInternalShapes(true);
@@ -83,6 +83,15 @@ public:
   //! set the offset <Off> on the Face <F>
   Standard_EXPORT void SetOffsetOnFace(const TopoDS_Face& F, const double Off);
 
+  //! Sets the flag to perform the independent parts of the algorithm in parallel threads
+  //! (FALSE by default): analysis of the edges, construction of the offset faces
+  //! and 2d intersections of the edges on faces. The flag is also passed
+  //! to the Boolean operation algorithms used for the Complete intersection mode.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myRunParallel; }
+
   Standard_EXPORT void MakeOffsetShape(
     const Message_ProgressRange& theRange = Message_ProgressRange());
 
@@ -276,6 +285,7 @@ private:
   BRepOffset_MakeLoops myMakeLoops;
   bool                 myIsPerformSewing; // Handle bad walls in thicksolid mode.
   bool                 myIsPlanar;
+  bool                 myRunParallel;
   TopoDS_Shape         myBadShape;
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myFacePlanfaceMap;
   NCollection_List<TopoDS_Shape>                                           myGenerated;
@@ -411,9 +411,11 @@ static bool FindShape(const TopoDS_Shape&       theSWhat,
 static void BuildSplitsOfTrimmedFace(const TopoDS_Face&              theFace,
                                      const TopoDS_Shape&             theEdges,
                                      NCollection_List<TopoDS_Shape>& theLFImages,
+                                     const bool                      theRunParallel,
                                      const Message_ProgressRange&    theRange)
 {
   BOPAlgo_Splitter aSplitter;
+  aSplitter.SetRunParallel(theRunParallel);
   //
   aSplitter.AddArgument(theFace);
   aSplitter.AddArgument(theEdges);
@@ -536,7 +538,8 @@ public: //! @name Constructor
         myEdgesOrigins(nullptr),
         myFacesOrigins(nullptr),
         myETrimEInf(nullptr),
-        myImage(&theImage)
+        myImage(&theImage),
+        myRunParallel(false)
   {
     myContext = new IntTools_Context();
   }
@@ -573,6 +576,9 @@ public: //! @name Setting data
     myETrimEInf = &theETrimEInf;
   }
 
+  //! Sets the flag to run the Boolean operations in parallel threads
+  void SetRunParallel(const bool theRunParallel) { myRunParallel = theRunParallel; }
+
 public: //! @name Public methods to build the splits
   //! Build splits of already trimmed faces
   void BuildSplitsOfTrimmedFaces(const Message_ProgressRange& theRange);
@@ -1029,6 +1035,9 @@ private:
 
   // Output
   BRepAlgo_Image* myImage; //!< History of modifications
+
+  // Options
+  bool myRunParallel; //!< Flag to run the Boolean operations in parallel threads
 };
 
 //=================================================================================================
@@ -1075,7 +1084,7 @@ void BRepOffset_BuildOffsetFaces::BuildSplitsOfTrimmedFaces(const Message_Progre
     }
 
     NCollection_List<TopoDS_Shape> aLFImages;
-    BuildSplitsOfTrimmedFace(aF, aCE, aLFImages, aPSLoop.Next());
+    BuildSplitsOfTrimmedFace(aF, aCE, aLFImages, myRunParallel, aPSLoop.Next());
 
     myOFImages.Add(aF, aLFImages);
   }
@@ -1245,6 +1254,7 @@ void BRepOffset_BuildOffsetFaces::IntersectTrimmedEdges(const Message_ProgressRa
   //
   // perform intersection of the edges
   BOPAlgo_Builder aGFE;
+  aGFE.SetRunParallel(myRunParallel);
   aGFE.SetArguments(aLS);
   aGFE.Perform(aPS.Next());
   if (aGFE.HasErrors())
@@ -4362,6 +4372,7 @@ void BRepOffset_BuildOffsetFaces::RemoveInsideFaces(
   }
   //
   BOPAlgo_MakerVolume aMV;
+  aMV.SetRunParallel(myRunParallel);
   aMV.SetArguments(aLS);
   aMV.SetIntersect(true);
   aMV.Perform(aPS.Next(9));
@@ -7451,6 +7462,7 @@ void BRepOffset_BuildOffsetFaces::IntersectAndTrimEdges(
   //
   // Intersect Edges
   BOPAlgo_Builder aGF;
+  aGF.SetRunParallel(myRunParallel);
   aGF.SetArguments(aLArgs);
   aGF.Perform();
   if (aGF.HasErrors())
@@ -7530,6 +7542,7 @@ void BRepOffset_BuildOffsetFaces::IntersectAndTrimEdges(
   //
   // trim common edges by other intersection edges
   BOPAlgo_Builder aGFCE;
+  aGFCE.SetRunParallel(myRunParallel);
   aGFCE.SetArguments(aLCE);
   aGFCE.AddArgument(aCEIm);
   aGFCE.Perform();
@@ -8110,6 +8123,7 @@ void BRepOffset_BuildOffsetFaces::UpdateValidEdges(
   //
   // Intersect valid splits with bounds and update both
   BOPAlgo_Builder aGF;
+  aGF.SetRunParallel(myRunParallel);
   aGF.AddArgument(aBounds);
   aGF.AddArgument(aSplits);
   aGF.Perform(aPSOuter.Next(3));
@@ -8208,6 +8222,7 @@ void BRepOffset_BuildOffsetFaces::UpdateValidEdges(
     // Perform intersection with the small subset of the edges to make
     // it possible to use the inside edges for building new splits.
     BOPAlgo_BOP aBOP;
+    aBOP.SetRunParallel(myRunParallel);
     aBOP.AddArgument(aCEAvoid);
     aBOP.AddTool(anInsideEdges);
     aBOP.SetOperation(BOPAlgo_CUT);
@@ -8299,6 +8314,7 @@ void BRepOffset_BuildOffsetFaces::TrimNewIntersectionEdges(
       // fuse these parts
       BOPAlgo_Builder                          aGFE;
       NCollection_List<TopoDS_Shape>::Iterator aItLEIm(aLEIm);
+      aGFE.SetRunParallel(myRunParallel);
       for (; aItLEIm.More(); aItLEIm.Next())
       {
         const TopoDS_Shape& aEIm = aItLEIm.Value();
@@ -8421,6 +8437,7 @@ void BRepOffset_BuildOffsetFaces::IntersectEdges(
   TopoDS_Shape& theSplits)
 {
   BOPAlgo_Builder aGFA;
+  aGFA.SetRunParallel(myRunParallel);
   aGFA.SetArguments(theLA);
   aGFA.Perform();
   if (aGFA.HasErrors())
@@ -8694,6 +8711,7 @@ void BRepOffset_BuildOffsetFaces::GetInvalidEdgesByBounds(
   TopExp::MapShapesAndAncestors(theSplits, TopAbs_VERTEX, TopAbs_EDGE, aDMVE);
   //
   BOPAlgo_Section aSec;
+  aSec.SetRunParallel(myRunParallel);
   aSec.AddArgument(theSplits);
   aSec.AddArgument(theBounds);
   //
@@ -9502,6 +9520,7 @@ void BRepOffset_MakeOffset::BuildSplitsOfTrimmedFaces(const NCollection_List<Top
   BRepOffset_BuildOffsetFaces aBFTool(theImage);
   aBFTool.SetFaces(theLF);
   aBFTool.SetAsDesInfo(theAsDes);
+  aBFTool.SetRunParallel(myRunParallel);
   aBFTool.BuildSplitsOfTrimmedFaces(theRange);
 }
 
@@ -9529,5 +9548,6 @@ void BRepOffset_MakeOffset::BuildSplitsOfExtendedFaces(
   aBFTool.SetEdgesOrigins(theEdgesOrigins);
   aBFTool.SetFacesOrigins(theFacesOrigins);
   aBFTool.SetInfEdges(theETrimEInf);
+  aBFTool.SetRunParallel(myRunParallel);
   aBFTool.BuildSplitsOfExtendedFaces(theRange);
 }
@@ -13,6 +13,7 @@
 
 #include <gtest/gtest.h>
 
+#include <BRepOffsetAPI_MakeOffsetShape.hxx>
 #include <BRepOffsetAPI_MakeThickSolid.hxx>
 #include <BRepOffsetAPI_ThruSections.hxx>
 #include <BRepOffset_MakeOffset.hxx>
@@ -25,6 +26,8 @@
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_Ellipse.hxx>
 #include <Geom_BSplineCurve.hxx>
@@ -1027,3 +1030,50 @@ TEST(BRepOffset_MakeOffsetTest, ThickSolid_CircleToOctagonLoft)
   // Octagon is closer to a circle, corners are less sharp
   EXPECT_TRUE(aThickMaker.IsDone()) << "ThickSolid on circle-to-octagon loft failed.";
 }
+
+//=================================================================================================
+// Test: Offset in parallel mode should give the same result as sequential one
+//=================================================================================================
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_ParallelMatchesSequential)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(-50, -50, 0), 100.0, 100.0, 40.0).Shape();
+  const TopoDS_Shape aCyl =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0, 0, 40), gp_Dir(0, 0, 1)), 30.0, 30.0).Shape();
+  BRepAlgoAPI_Fuse aFuse(aBox, aCyl);
+  ASSERT_TRUE(aFuse.IsDone()) << "Failed to fuse box and cylinder";
+
+  for (int anInter = 0; anInter < 2; ++anInter)
+  {
+    int    aNbFaces[2] = {0, 0};
+    double aVolume[2]  = {0.0, 0.0};
+    for (int aParallel = 0; aParallel < 2; ++aParallel)
+    {
+      BRepOffsetAPI_MakeOffsetShape anOffsetMaker;
+      anOffsetMaker.SetRunParallel(aParallel == 1);
+      EXPECT_EQ(anOffsetMaker.RunParallel(), aParallel == 1);
+      anOffsetMaker.PerformByJoin(aFuse.Shape(),
+                                  5.0,
+                                  1.0e-7,
+                                  BRepOffset_Skin,
+                                  anInter == 1,
+                                  false,
+                                  GeomAbs_Intersection);
+      ASSERT_TRUE(anOffsetMaker.IsDone()) << "Offset failed, intersection mode " << anInter;
+
+      const TopoDS_Shape& aResult = anOffsetMaker.Shape();
+      EXPECT_TRUE(BRepCheck_Analyzer(aResult).IsValid());
+      for (TopExp_Explorer anExp(aResult, TopAbs_FACE); anExp.More(); anExp.Next())
+      {
+        ++aNbFaces[aParallel];
+      }
+      GProp_GProps aProps;
+      BRepGProp::VolumeProperties(aResult, aProps);
+      aVolume[aParallel] = aProps.Mass();
+    }
+    EXPECT_EQ(aNbFaces[0], aNbFaces[1]) << "Intersection mode " << anInter;
+    EXPECT_NEAR(aVolume[0], aVolume[1], 1.0e-6 * std::abs(aVolume[0]))
+      << "Intersection mode " << anInter;
+    EXPECT_GT(aVolume[0], 110.0 * 110.0 * 50.0);
+  }
+}
@@ -174,3 +174,35 @@ TEST(ShapeBuild_ReShapeTest, Apply_DiamondSharedVertexInTwoCompounds)
   EXPECT_EQ(aNbOriginals, 0) << "Original vertex must be substituted everywhere";
   EXPECT_EQ(aNbReplVerts, 2) << "Replacement must appear in both parentA and parentB";
 }
+
+// Records copied for a sub-shape and merged back after modification must give
+// the same substitutions as modification of the original context.
+TEST(ShapeBuild_ReShapeTest, CopyRecords_MergeRecords)
+{
+  const TopoDS_Vertex aV1     = BRepBuilderAPI_MakeVertex(gp_Pnt(0, 0, 0));
+  const TopoDS_Vertex aV2     = BRepBuilderAPI_MakeVertex(gp_Pnt(1, 0, 0));
+  const TopoDS_Vertex aV3     = BRepBuilderAPI_MakeVertex(gp_Pnt(2, 0, 0));
+  const TopoDS_Vertex aV2Repl = BRepBuilderAPI_MakeVertex(gp_Pnt(1.5, 0, 0));
+  const TopoDS_Vertex aV3Repl = BRepBuilderAPI_MakeVertex(gp_Pnt(2.5, 0, 0));
+  const TopoDS_Edge   anEdge1 = BRepBuilderAPI_MakeEdge(aV1, aV2);
+  const TopoDS_Edge   anEdge2 = BRepBuilderAPI_MakeEdge(aV2, aV3);
+
+  occ::handle<ShapeBuild_ReShape> aReShape = new ShapeBuild_ReShape;
+  aReShape->Replace(aV2, aV2Repl);
+  aReShape->Replace(aV3, aV3Repl);
+
+  // only records related to the first edge should be copied
+  occ::handle<ShapeBuild_ReShape> aCopy = new ShapeBuild_ReShape;
+  aCopy->CopyRecords(*aReShape, anEdge1);
+  EXPECT_TRUE(aCopy->IsRecorded(aV2));
+  EXPECT_FALSE(aCopy->IsRecorded(aV3));
+  EXPECT_TRUE(aCopy->Value(aV2).IsSame(aV2Repl));
+
+  aCopy->Remove(aV1);
+  aReShape->MergeRecords(*aCopy);
+  EXPECT_TRUE(aReShape->IsRecorded(aV1));
+  EXPECT_TRUE(aReShape->Value(aV1).IsNull());
+  EXPECT_TRUE(aReShape->Value(aV2).IsSame(aV2Repl));
+  EXPECT_TRUE(aReShape->Value(aV3).IsSame(aV3Repl));
+  EXPECT_EQ(CountSubShapes(aReShape->Apply(anEdge2), TopAbs_VERTEX), 2);
+}
@@ -12,21 +12,169 @@
 // commercial license or contractual agreement.
 
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakePolygon.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <BRepPrimAPI_MakePrism.hxx>
+#include <Geom_Plane.hxx>
+#include <gp.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <NCollection_Array2.hxx>
+#include <NCollection_IndexedMap.hxx>
 #include <Precision.hxx>
+#include <ShapeExtend_MsgRegistrator.hxx>
 #include <ShapeExtend_Status.hxx>
 #include <ShapeFix_Shape.hxx>
+#include <ShapeFix_Shell.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
 #include <gtest/gtest.h>
 
+namespace
+{
+//! Returns shell of theNbCells x theNbCells planar faces sharing edges, without pcurves;
+//! outer wires of every third face are reversed.
+//! Faces lie on the same plane or on separate ones (which are not in conflict for fixing).
+TopoDS_Shell makeGridShell(const int theNbCells, const bool theToShareSurface = true)
+{
+  BRep_Builder                      aBuilder;
+  const occ::handle<Geom_Plane>     aPlane = new Geom_Plane(gp_Pnt(0.0, 0.0, 0.0), gp::DZ());
+  NCollection_Array2<TopoDS_Vertex> aVerts(0, theNbCells, 0, theNbCells);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      aBuilder.MakeVertex(aVerts(aRow, aCol), gp_Pnt(aCol, aRow, 0.0), Precision::Confusion());
+    }
+  }
+
+  NCollection_Array2<TopoDS_Edge> aRowEdges(0, theNbCells, 0, theNbCells - 1);
+  NCollection_Array2<TopoDS_Edge> aColEdges(0, theNbCells - 1, 0, theNbCells);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      if (aCol < theNbCells)
+      {
+        aRowEdges(aRow, aCol) =
+          BRepBuilderAPI_MakeEdge(aVerts(aRow, aCol), aVerts(aRow, aCol + 1)).Edge();
+      }
+      if (aRow < theNbCells)
+      {
+        aColEdges(aRow, aCol) =
+          BRepBuilderAPI_MakeEdge(aVerts(aRow, aCol), aVerts(aRow + 1, aCol)).Edge();
+      }
+    }
+  }
+
+  TopoDS_Shell aShell;
+  aBuilder.MakeShell(aShell);
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      TopoDS_Wire aWire;
+      aBuilder.MakeWire(aWire);
+      aBuilder.Add(aWire, aRowEdges(aRow, aCol));
+      aBuilder.Add(aWire, aColEdges(aRow, aCol + 1));
+      aBuilder.Add(aWire, aRowEdges(aRow + 1, aCol).Reversed());
+      aBuilder.Add(aWire, aColEdges(aRow, aCol).Reversed());
+      if ((aRow * theNbCells + aCol) % 3 == 0)
+      {
+        aWire.Reverse();
+      }
+
+      TopoDS_Face aFace;
+      aBuilder.MakeFace(aFace,
+                        theToShareSurface ? aPlane
+                                          : new Geom_Plane(gp_Pnt(0.0, 0.0, 0.0), gp::DZ()),
+                        Precision::Confusion());
+      aBuilder.Add(aFace, aWire);
+      aBuilder.Add(aShell, aFace);
+    }
+  }
+  return aShell;
+}
+
+//! Heals the shell sequentially or in parallel threads.
+TopoDS_Shape healShell(const TopoDS_Shell&                            theShell,
+                       const bool                                     theToParallel,
+                       const occ::handle<ShapeExtend_MsgRegistrator>& theMsgReg)
+{
+  occ::handle<ShapeFix_Shape> aFixer = new ShapeFix_Shape(theShell);
+  aFixer->SetMsgRegistrator(theMsgReg);
+  aFixer->SetRunParallel(theToParallel);
+  EXPECT_EQ(aFixer->RunParallel(), theToParallel);
+  aFixer->Perform();
+  EXPECT_TRUE(aFixer->FixShellTool()->Status(ShapeExtend_DONE1));
+  return aFixer->Shape();
+}
+
+//! Checks that fixing faces of a grid shell in parallel threads
+//! gives the same result as sequential fixing.
+void checkParallelShell(const bool theToShareSurface)
+{
+  const int                               aNbCells = 8;
+  occ::handle<ShapeExtend_MsgRegistrator> aSeqMsgs = new ShapeExtend_MsgRegistrator();
+  occ::handle<ShapeExtend_MsgRegistrator> aParMsgs = new ShapeExtend_MsgRegistrator();
+  const TopoDS_Shape                      aSeqResult =
+    healShell(makeGridShell(aNbCells, theToShareSurface), false, aSeqMsgs);
+  const TopoDS_Shape aParResult =
+    healShell(makeGridShell(aNbCells, theToShareSurface), true, aParMsgs);
+  ASSERT_FALSE(aSeqResult.IsNull());
+  ASSERT_FALSE(aParResult.IsNull());
+  EXPECT_TRUE(BRepCheck_Analyzer(aSeqResult).IsValid());
+  EXPECT_TRUE(BRepCheck_Analyzer(aParResult).IsValid());
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSeqEdges, aParEdges;
+  TopExp::MapShapes(aSeqResult, TopAbs_EDGE, aSeqEdges);
+  TopExp::MapShapes(aParResult, TopAbs_EDGE, aParEdges);
+  EXPECT_EQ(aSeqEdges.Extent(), 2 * aNbCells * (aNbCells + 1));
+  EXPECT_EQ(aSeqEdges.Extent(), aParEdges.Extent());
+
+  int             aNbFaces = 0;
+  TopExp_Explorer aSeqExp(aSeqResult, TopAbs_FACE);
+  TopExp_Explorer aParExp(aParResult, TopAbs_FACE);
+  for (; aSeqExp.More() && aParExp.More(); aSeqExp.Next(), aParExp.Next(), ++aNbFaces)
+  {
+    const TopoDS_Face aSeqFace = TopoDS::Face(aSeqExp.Current());
+    const TopoDS_Face aParFace = TopoDS::Face(aParExp.Current());
+    EXPECT_EQ(aSeqFace.Orientation(), aParFace.Orientation());
+
+    TopExp_Explorer aSeqEdgeExp(aSeqFace, TopAbs_EDGE);
+    TopExp_Explorer aParEdgeExp(aParFace, TopAbs_EDGE);
+    for (; aSeqEdgeExp.More() && aParEdgeExp.More(); aSeqEdgeExp.Next(), aParEdgeExp.Next())
+    {
+      const TopoDS_Edge& aSeqEdge = TopoDS::Edge(aSeqEdgeExp.Current());
+      const TopoDS_Edge& aParEdge = TopoDS::Edge(aParEdgeExp.Current());
+      EXPECT_EQ(aSeqEdge.Orientation(), aParEdge.Orientation());
+      EXPECT_EQ(aSeqEdges.FindIndex(aSeqEdge), aParEdges.FindIndex(aParEdge));
+      EXPECT_NEAR(BRep_Tool::Tolerance(aSeqEdge), BRep_Tool::Tolerance(aParEdge), 1.0e-15);
+    }
+    EXPECT_FALSE(aSeqEdgeExp.More());
+    EXPECT_FALSE(aParEdgeExp.More());
+  }
+  EXPECT_FALSE(aSeqExp.More());
+  EXPECT_FALSE(aParExp.More());
+  EXPECT_EQ(aNbFaces, aNbCells * aNbCells);
+  EXPECT_EQ(aSeqMsgs->MapShape().Extent(), aParMsgs->MapShape().Extent());
+}
+} // namespace
+
 TEST(ShapeFix_ShapeTest, FixValidBox)
 {
   BRepPrimAPI_MakeBox aMakeBox(10.0, 10.0, 10.0);
@@ -123,3 +271,12 @@ TEST(ShapeFix_ShapeTest, HealPrismFromSelfIntersectingFace)
   BRepCheck_Analyzer anAnalyzer(aFixer->Shape());
   EXPECT_TRUE(anAnalyzer.IsValid());
 }
+
+// Fixing faces of a shell in parallel threads must give the same result as sequential fixing
+TEST(ShapeFix_ShapeTest, ParallelShellMatchesSequential)
+{
+  for (const bool toShareSurface : {true, false})
+  {
+    checkParallelShell(toShareSurface);
+  }
+}
@@ -23,6 +23,7 @@
 #include <Geom_CylindricalSurface.hxx>
 #include <Geom2d_Line.hxx>
 #include <gp_Dir2d.hxx>
+#include <gp_Ax3.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
@@ -589,3 +590,51 @@ TEST(ShapeUpgrade_UnifySameDomainTest, MissingSourcePCurveDuringTransformation)
   ASSERT_FALSE(aResult.IsNull());
   EXPECT_EQ(countFaces(aResult), 2);
 }
+
+// Test that evaluation of surfaces in parallel threads gives the same result,
+// for faces lying on the equal but not shared planes and cylinders.
+TEST(ShapeUpgrade_UnifySameDomainTest, ParallelMatchesSequential)
+{
+  const int             aNbCells = 8;
+  BRepBuilderAPI_Sewing aSewing;
+  for (int aRow = 0; aRow < aNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < aNbCells; ++aCol)
+    {
+      // planar patch
+      aSewing.Add(BRepBuilderAPI_MakeFace(gp_Pln(gp::XOY()),
+                                          aCol * 1.0,
+                                          (aCol + 1) * 1.0,
+                                          aRow * 1.0,
+                                          (aRow + 1) * 1.0)
+                    .Face());
+
+      // cylindrical patch, each one on its own surface
+      const occ::handle<Geom_CylindricalSurface> aCylinder =
+        new Geom_CylindricalSurface(gp_Ax3(gp_Pnt(0.0, 0.0, 10.0), gp::DZ()), 5.0);
+      aSewing.Add(BRepBuilderAPI_MakeFace(aCylinder,
+                                          aCol * M_PI / aNbCells,
+                                          (aCol + 1) * M_PI / aNbCells,
+                                          aRow * 1.0,
+                                          (aRow + 1) * 1.0,
+                                          Precision::Confusion())
+                    .Face());
+    }
+  }
+  aSewing.Perform();
+  const TopoDS_Shape aSewed = aSewing.SewedShape();
+  ASSERT_EQ(countFaces(aSewed), 2 * aNbCells * aNbCells);
+
+  int aNbFaces[2] = {0, 0};
+  for (int aParallel = 0; aParallel < 2; ++aParallel)
+  {
+    ShapeUpgrade_UnifySameDomain aUnifier(aSewed);
+    aUnifier.SetRunParallel(aParallel == 1);
+    EXPECT_EQ(aUnifier.RunParallel(), aParallel == 1);
+    aUnifier.Build();
+    ASSERT_FALSE(aUnifier.Shape().IsNull());
+    aNbFaces[aParallel] = countFaces(aUnifier.Shape());
+  }
+  EXPECT_EQ(aNbFaces[0], 2);
+  EXPECT_EQ(aNbFaces[1], aNbFaces[0]);
+}
@@ -146,6 +146,28 @@ void ShapeFix_Face::ClearModes()
 
 //=================================================================================================
 
+void ShapeFix_Face::CopyModes(const ShapeFix_Face& theOther)
+{
+  SetPrecision(theOther.Precision());
+  SetMinTolerance(theOther.MinTolerance());
+  SetMaxTolerance(theOther.MaxTolerance());
+  myFixWire->CopyModes(*theOther.myFixWire);
+
+  myFixWireMode              = theOther.myFixWireMode;
+  myFixOrientationMode       = theOther.myFixOrientationMode;
+  myFixAddNaturalBoundMode   = theOther.myFixAddNaturalBoundMode;
+  myFixMissingSeamMode       = theOther.myFixMissingSeamMode;
+  myFixSmallAreaWireMode     = theOther.myFixSmallAreaWireMode;
+  myRemoveSmallAreaFaceMode  = theOther.myRemoveSmallAreaFaceMode;
+  myFixIntersectingWiresMode = theOther.myFixIntersectingWiresMode;
+  myFixLoopWiresMode         = theOther.myFixLoopWiresMode;
+  myFixSplitFaceMode         = theOther.myFixSplitFaceMode;
+  myAutoCorrectPrecisionMode = theOther.myAutoCorrectPrecisionMode;
+  myFixPeriodicDegenerated   = theOther.myFixPeriodicDegenerated;
+}
+
+//=================================================================================================
+
 void ShapeFix_Face::SetMsgRegistrator(const occ::handle<ShapeExtend_BasicMsgRegistrator>& msgreg)
 {
   ShapeFix_Root::SetMsgRegistrator(msgreg);
@@ -62,6 +62,9 @@ public:
   //! Sets all modes to default
   Standard_EXPORT virtual void ClearModes();
 
+  //! Copies all modes and tolerances of another tool, including ones of its wire fixing tool
+  Standard_EXPORT void CopyModes(const ShapeFix_Face& theOther);
+
   //! Loads a whole face already created, with its wires, sense and
   //! location
   Standard_EXPORT void Init(const TopoDS_Face& face);
@@ -75,6 +75,12 @@ public:
   //! Returns tool for fixing edges.
   occ::handle<ShapeFix_Edge> FixEdgeTool() const;
 
+  //! Sets flag to fix faces of shells in parallel threads (see ShapeFix_Shell::SetRunParallel()).
+  void SetRunParallel(const bool theIsParallel);
+
+  //! Returns flag to fix faces of shells in parallel threads.
+  bool RunParallel() const;
+
   //! Returns the status of the last Fix.
   //! This can be a combination of the following flags:
   //! ShapeExtend_DONE1: some free edges were fixed
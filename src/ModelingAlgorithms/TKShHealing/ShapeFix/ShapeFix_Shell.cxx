@@ -21,6 +21,8 @@
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepBndLib.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <Message_Msg.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_DataMap.hxx>
@@ -28,12 +30,14 @@
 #include <NCollection_IndexedMap.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeExtend_MsgRegistrator.hxx>
 #include <ShapeFix_Face.hxx>
 #include <ShapeFix_Shell.hxx>
 #include <Standard_Type.hxx>
 #include <Standard_Integer.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -61,6 +65,102 @@ using EdgeFacesMap =
 
 // Default increment for dynamic array of faces per edge
 constexpr int DEFAULT_EDGE_FACES_INCREMENT = 5;
+
+// Set of data (shapes and geometry) which could be modified by fixing of a face
+using FaceDataMap = NCollection_Map<occ::handle<Standard_Transient>>;
+
+//! Returns TRUE if messages could be sent to the registrator from parallel tasks,
+//! either directly or through registrators of separate tasks.
+bool isSplittableRegistrator(const occ::handle<ShapeExtend_BasicMsgRegistrator>& theMsgReg)
+{
+  return theMsgReg.IsNull()
+         || theMsgReg->DynamicType() == STANDARD_TYPE(ShapeExtend_BasicMsgRegistrator)
+         || theMsgReg->DynamicType() == STANDARD_TYPE(ShapeExtend_MsgRegistrator);
+}
+
+//! Collects data which could be modified by fixing of the face: shapes of the face
+//! (including their replacements recorded in the context), surface and 3D curves of edges.
+void collectFaceData(const TopoDS_Shape&                    theFace,
+                     const occ::handle<ShapeBuild_ReShape>& theContext,
+                     FaceDataMap&                           theData)
+{
+  NCollection_List<TopoDS_Shape> aQueue;
+  aQueue.Append(theFace);
+  while (!aQueue.IsEmpty())
+  {
+    const TopoDS_Shape aShape = aQueue.First();
+    aQueue.RemoveFirst();
+    if (aShape.IsNull() || !theData.Add(aShape.TShape()))
+    {
+      continue;
+    }
+
+    TopLoc_Location aLoc;
+    if (aShape.ShapeType() == TopAbs_FACE)
+    {
+      const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(TopoDS::Face(aShape), aLoc);
+      if (!aSurf.IsNull())
+      {
+        theData.Add(aSurf);
+      }
+    }
+    else if (aShape.ShapeType() == TopAbs_EDGE)
+    {
+      double                         aFirst = 0.0, aLast = 0.0;
+      const occ::handle<Geom_Curve>& aCurve =
+        BRep_Tool::Curve(TopoDS::Edge(aShape), aLoc, aFirst, aLast);
+      if (!aCurve.IsNull())
+      {
+        theData.Add(aCurve);
+      }
+    }
+
+    if (theContext->IsRecorded(aShape))
+    {
+      aQueue.Append(theContext->Value(aShape));
+    }
+    for (TopoDS_Iterator anIter(aShape, false); anIter.More(); anIter.Next())
+    {
+      aQueue.Append(anIter.Value());
+    }
+  }
+}
+
+//! Sends messages collected by one registrator to another one.
+void mergeMessages(const ShapeExtend_MsgRegistrator& theFrom, ShapeExtend_MsgRegistrator& theTo)
+{
+  using ShapeMsgMap =
+    NCollection_DataMap<TopoDS_Shape, NCollection_List<Message_Msg>, TopTools_ShapeMapHasher>;
+  using TransientMsgMap =
+    NCollection_DataMap<occ::handle<Standard_Transient>, NCollection_List<Message_Msg>>;
+  for (ShapeMsgMap::Iterator aMsgIter(theFrom.MapShape()); aMsgIter.More(); aMsgIter.Next())
+  {
+    for (NCollection_List<Message_Msg>::Iterator aListIter(aMsgIter.Value()); aListIter.More();
+         aListIter.Next())
+    {
+      theTo.Send(aMsgIter.Key(), aListIter.Value(), Message_Warning);
+    }
+  }
+  for (TransientMsgMap::Iterator aMsgIter(theFrom.MapTransient()); aMsgIter.More();
+       aMsgIter.Next())
+  {
+    for (NCollection_List<Message_Msg>::Iterator aListIter(aMsgIter.Value()); aListIter.More();
+         aListIter.Next())
+    {
+      theTo.Send(aMsgIter.Key(), aListIter.Value(), Message_Warning);
+    }
+  }
+}
+
+//! Task fixing single face against its own context and message registrator.
+struct FaceFixTask
+{
+  TopoDS_Face                             Face;
+  occ::handle<ShapeFix_Face>              Tool;
+  occ::handle<ShapeBuild_ReShape>         Context;
+  occ::handle<ShapeExtend_MsgRegistrator> MsgReg;
+  bool                                    IsDone = false;
+};
 } // namespace
 
 //=================================================================================================
@@ -73,6 +173,7 @@ ShapeFix_Shell::ShapeFix_Shell()
   myFixFace            = new ShapeFix_Face;
   myNbShells           = 0;
   myNonManifold        = false;
+  myRunParallel        = false;
 }
 
 //=================================================================================================
@@ -85,6 +186,7 @@ ShapeFix_Shell::ShapeFix_Shell(const TopoDS_Shell& shape)
   myFixFace            = new ShapeFix_Face;
   Init(shape);
   myNonManifold = false;
+  myRunParallel = false;
 }
 
 //=================================================================================================
@@ -117,15 +219,22 @@ bool ShapeFix_Shell::Perform(const Message_ProgressRange& theProgress)
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Fixing face", aNbFaces);
 
-    for (TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next())
+    if (myRunParallel && aNbFaces > 1 && isSplittableRegistrator(MsgRegistrator()))
     {
-      TopoDS_Shape sh      = iter.Value();
-      TopoDS_Face  tmpFace = TopoDS::Face(sh);
-      myFixFace->Init(tmpFace);
-      if (myFixFace->Perform())
+      status = fixFacesParallel(S, aPS);
+    }
+    else
+    {
+      for (TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next())
       {
-        status = true;
-        myStatus |= ShapeExtend::EncodeStatus(ShapeExtend_DONE1);
+        TopoDS_Shape sh      = iter.Value();
+        TopoDS_Face  tmpFace = TopoDS::Face(sh);
+        myFixFace->Init(tmpFace);
+        if (myFixFace->Perform())
+        {
+          status = true;
+          myStatus |= ShapeExtend::EncodeStatus(ShapeExtend_DONE1);
+        }
       }
     }
 
@@ -175,6 +284,145 @@ bool ShapeFix_Shell::Perform(const Message_ProgressRange& theProgress)
 
 //=================================================================================================
 
+bool ShapeFix_Shell::fixFacesParallel(const TopoDS_Shape& theShell, Message_ProgressScope& thePS)
+{
+  const occ::handle<ShapeExtend_MsgRegistrator> aMsgReg =
+    occ::down_cast<ShapeExtend_MsgRegistrator>(MsgRegistrator());
+
+  NCollection_DynamicArray<TopoDS_Face> aFaces;
+  for (TopoDS_Iterator anIter(theShell); anIter.More(); anIter.Next())
+  {
+    aFaces.Append(TopoDS::Face(anIter.Value()));
+  }
+  const int aNbFaces = aFaces.Length();
+
+  // Faces sharing data conflict with each other and should not be fixed concurrently.
+  // The conflict graph is colored greedily in the order of faces,
+  // then faces of the same color are fixed in parallel, color by color.
+  // Data shared by faces of different colors could be replaced by fixing of the first one,
+  // but never by two faces of one color, so that the graph is built once.
+  NCollection_Array1<int> aColors(0, aNbFaces - 1);
+  int                     aNbColors = 0;
+  {
+    NCollection_Array1<FaceDataMap> aFaceData(0, aNbFaces - 1);
+    OSD_Parallel::For(0, aNbFaces, [&](const int theIndex) {
+      collectFaceData(aFaces(theIndex), Context(), aFaceData.ChangeValue(theIndex));
+    });
+
+    NCollection_DataMap<occ::handle<Standard_Transient>, NCollection_DynamicArray<int>>
+                            aDataFaces;
+    NCollection_Array1<int> aColorStamps(1, aNbFaces);
+    aColorStamps.Init(-1);
+    for (int aFaceIndex = 0; aFaceIndex < aNbFaces; ++aFaceIndex)
+    {
+      for (FaceDataMap::Iterator aDataIter(aFaceData(aFaceIndex)); aDataIter.More();
+           aDataIter.Next())
+      {
+        NCollection_DynamicArray<int>* aDataFaceList = aDataFaces.ChangeSeek(aDataIter.Key());
+        if (aDataFaceList == nullptr)
+        {
+          aDataFaceList =
+            aDataFaces.Bound(aDataIter.Key(),
+                             NCollection_DynamicArray<int>(DEFAULT_EDGE_FACES_INCREMENT));
+        }
+        for (const int anOtherFace : *aDataFaceList)
+        {
+          aColorStamps(aColors(anOtherFace)) = aFaceIndex;
+        }
+        aDataFaceList->Append(aFaceIndex);
+      }
+      int aColor = 1;
+      while (aColorStamps(aColor) == aFaceIndex)
+      {
+        ++aColor;
+      }
+      aColors(aFaceIndex) = aColor;
+      aNbColors           = std::max(aNbColors, aColor);
+    }
+  }
+
+  // faces sorted by colors keeping their order within a color
+  NCollection_Array1<int> aColorStarts(1, aNbColors + 1);
+  aColorStarts.Init(0);
+  for (const int aColor : aColors)
+  {
+    ++aColorStarts(aColor);
+  }
+  for (int aColor = 1, aStart = 0; aColor <= aNbColors + 1; ++aColor)
+  {
+    const int aNbColorFaces = aColorStarts(aColor);
+    aColorStarts(aColor)    = aStart;
+    aStart += aNbColorFaces;
+  }
+  NCollection_Array1<int> aSortedFaces(0, aNbFaces - 1);
+  {
+    NCollection_Array1<int> aColorEnds(1, aNbColors + 1);
+    aColorEnds = aColorStarts;
+    for (int aFaceIndex = 0; aFaceIndex < aNbFaces; ++aFaceIndex)
+    {
+      aSortedFaces(aColorEnds(aColors(aFaceIndex))++) = aFaceIndex;
+    }
+  }
+
+  bool                            isFixed = false;
+  NCollection_Array1<FaceFixTask> aTasks(1, aNbFaces);
+  for (int aColor = 1; aColor <= aNbColors && thePS.More(); ++aColor)
+  {
+    int aNbTasks = 0;
+    for (int aSortedIndex = aColorStarts(aColor); aSortedIndex < aColorStarts(aColor + 1);
+         ++aSortedIndex)
+    {
+      const int    aFaceIndex = aSortedFaces(aSortedIndex);
+      FaceFixTask& aTask      = aTasks.ChangeValue(++aNbTasks);
+      aTask.Face         = aFaces(aFaceIndex);
+      aTask.Context      = new ShapeBuild_ReShape();
+
+      aTask.Context->ModeConsiderLocation() = Context()->ModeConsiderLocation();
+      aTask.Context->CopyRecords(*Context(), aTask.Face);
+      aTask.Tool = new ShapeFix_Face();
+      aTask.Tool->CopyModes(*myFixFace);
+      aTask.Tool->SetContext(aTask.Context);
+      aTask.IsDone = false;
+      aTask.MsgReg.Nullify();
+      if (!aMsgReg.IsNull())
+      {
+        aTask.MsgReg = new ShapeExtend_MsgRegistrator();
+        aTask.Tool->SetMsgRegistrator(aTask.MsgReg);
+      }
+      else
+      {
+        aTask.Tool->SetMsgRegistrator(MsgRegistrator());
+      }
+    }
+
+    OSD_Parallel::For(1, aNbTasks + 1, [&](const int theIndex) {
+      FaceFixTask& aTask = aTasks.ChangeValue(theIndex);
+      aTask.Tool->Init(aTask.Face);
+      aTask.IsDone = aTask.Tool->Perform();
+    });
+
+    // merge results in the order of faces
+    for (int aTaskIter = 1; aTaskIter <= aNbTasks; ++aTaskIter)
+    {
+      const FaceFixTask& aTask = aTasks.Value(aTaskIter);
+      Context()->MergeRecords(*aTask.Context);
+      if (!aTask.MsgReg.IsNull())
+      {
+        mergeMessages(*aTask.MsgReg, *aMsgReg);
+      }
+      if (aTask.IsDone)
+      {
+        isFixed = true;
+        myStatus |= ShapeExtend::EncodeStatus(ShapeExtend_DONE1);
+      }
+    }
+    thePS.Next(aNbTasks);
+  }
+  return isFixed;
+}
+
+//=================================================================================================
+
 static bool GetFreeEdges(const TopoDS_Shape&                                     aShape,
                          NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>& MapEdges)
 {
@@ -25,6 +25,7 @@
 #include <ShapeExtend_Status.hxx>
 #include <Message_ProgressRange.hxx>
 
+class Message_ProgressScope;
 class ShapeFix_Face;
 class ShapeExtend_BasicMsgRegistrator;
 
@@ -115,8 +116,25 @@ public:
   //! Sets NonManifold flag
   Standard_EXPORT virtual void SetNonManifoldFlag(const bool isNonManifold);
 
+  //! Sets flag to fix faces of the shell in parallel threads (FALSE by default).
+  //! Faces sharing sub-shapes or geometry are fixed one after another in the order of the shell,
+  //! so that the result is the same as of sequential processing.
+  //! Parallel processing is used only with message registrator of type
+  //! ShapeExtend_BasicMsgRegistrator or ShapeExtend_MsgRegistrator (or without registrator).
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns flag to fix faces of the shell in parallel threads.
+  bool RunParallel() const { return myRunParallel; }
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shell, ShapeFix_Root)
 
+private:
+  //! Fixes faces of the shell in parallel threads, in groups of faces sharing no data.
+  //! @param[in] theShell shell with faces to fix
+  //! @param[in] thePS    progress scope with a step per face
+  //! @return TRUE if some face has been fixed
+  bool fixFacesParallel(const TopoDS_Shape& theShell, Message_ProgressScope& thePS);
+
 protected:
   TopoDS_Shell               myShell;
   TopoDS_Compound            myErrFaces;
@@ -126,6 +144,7 @@ protected:
   int                        myFixOrientationMode;
   int                        myNbShells;
   bool                       myNonManifold;
+  bool                       myRunParallel;
 };
 
 #include <ShapeFix_Shell.lxx>
@@ -203,6 +203,51 @@ void ShapeFix_Wire::ClearModes()
 
 //=================================================================================================
 
+void ShapeFix_Wire::CopyModes(const ShapeFix_Wire& theOther)
+{
+  SetPrecision(theOther.Precision());
+  SetMinTolerance(theOther.MinTolerance());
+  SetMaxTolerance(theOther.MaxTolerance());
+  myMaxTailAngleSine = theOther.myMaxTailAngleSine;
+  myMaxTailWidth     = theOther.myMaxTailWidth;
+
+  myTopoMode        = theOther.myTopoMode;
+  myGeomMode        = theOther.myGeomMode;
+  myClosedMode      = theOther.myClosedMode;
+  myPreference2d    = theOther.myPreference2d;
+  myFixGapsByRanges = theOther.myFixGapsByRanges;
+
+  myRemoveLoopMode = theOther.myRemoveLoopMode;
+
+  myFixReversed2dMode      = theOther.myFixReversed2dMode;
+  myFixRemovePCurveMode    = theOther.myFixRemovePCurveMode;
+  myFixRemoveCurve3dMode   = theOther.myFixRemoveCurve3dMode;
+  myFixAddPCurveMode       = theOther.myFixAddPCurveMode;
+  myFixAddCurve3dMode      = theOther.myFixAddCurve3dMode;
+  myFixSeamMode            = theOther.myFixSeamMode;
+  myFixShiftedMode         = theOther.myFixShiftedMode;
+  myFixSameParameterMode   = theOther.myFixSameParameterMode;
+  myFixVertexToleranceMode = theOther.myFixVertexToleranceMode;
+
+  myFixNotchedEdgesMode                 = theOther.myFixNotchedEdgesMode;
+  myFixSelfIntersectingEdgeMode         = theOther.myFixSelfIntersectingEdgeMode;
+  myFixIntersectingEdgesMode            = theOther.myFixIntersectingEdgesMode;
+  myFixNonAdjacentIntersectingEdgesMode = theOther.myFixNonAdjacentIntersectingEdgesMode;
+  myFixTailMode                         = theOther.myFixTailMode;
+
+  myFixReorderMode          = theOther.myFixReorderMode;
+  myFixSmallMode            = theOther.myFixSmallMode;
+  myFixConnectedMode        = theOther.myFixConnectedMode;
+  myFixEdgeCurvesMode       = theOther.myFixEdgeCurvesMode;
+  myFixDegeneratedMode      = theOther.myFixDegeneratedMode;
+  myFixSelfIntersectionMode = theOther.myFixSelfIntersectionMode;
+  myFixLackingMode          = theOther.myFixLackingMode;
+  myFixGaps3dMode           = theOther.myFixGaps3dMode;
+  myFixGaps2dMode           = theOther.myFixGaps2dMode;
+}
+
+//=================================================================================================
+
 void ShapeFix_Wire::ClearStatuses()
 {
   int emptyStatus = ShapeExtend::EncodeStatus(ShapeExtend_OK);
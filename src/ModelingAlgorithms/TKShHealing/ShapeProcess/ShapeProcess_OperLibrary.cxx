@@ -822,6 +822,7 @@ static bool fixshape(const occ::handle<ShapeProcess_Context>& context,
   sfs->FixShellTool()->FixFaceMode() = ctx->IntegerVal("FixFaceMode", -1);
   sfs->FixShellTool()->SetNonManifoldFlag(ctx->IsNonManifold());
   sfs->FixShellTool()->FixOrientationMode() = ctx->IntegerVal("FixFaceOrientationMode", -1);
+  sfs->FixShellTool()->SetRunParallel(ctx->BooleanVal("RunParallel", false));
 
   // parameters for ShapeFix_Face
   sff->FixWireMode()              = ctx->IntegerVal("FixWireMode", -1);
@@ -43,6 +43,7 @@
 #include <GeomConvert.hxx>
 #include <GeomConvert_ApproxSurface.hxx>
 #include <GeomConvert_CompCurveToBSplineCurve.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
 #include <GeomLib_IsPlanarSurface.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Dir.hxx>
@@ -76,6 +77,7 @@
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <NCollection_IndexedMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <gp_Circ.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Curve2d.hxx>
@@ -1534,11 +1536,13 @@ static bool GetNormalToSurface(const TopoDS_Face& theFace,
 
 //=================================================================================================
 
-static bool IsSameDomain(const TopoDS_Face&                                aFace,
-                         const TopoDS_Face&                                aCheckedFace,
-                         const double                                      theLinTol,
-                         const double                                      theAngTol,
-                         ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
+static bool IsSameDomain(
+  const TopoDS_Face&                                            aFace,
+  const TopoDS_Face&                                            aCheckedFace,
+  const double                                                  theLinTol,
+  const double                                                  theAngTol,
+  const ShapeUpgrade_UnifySameDomain::DataMapOfFaceSurfaceData& theFaceSurfaces,
+  ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane&             theFacePlaneMap)
 {
   // checking the same handles
   TopLoc_Location           L1, L2;
@@ -1552,11 +1556,25 @@ static bool IsSameDomain(const TopoDS_Face&                                aFace
     return true;
   }
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
+  // take the surface data evaluated in advance, if any
+  const ShapeUpgrade_UnifySameDomain::FaceSurfaceData* aData1 = theFaceSurfaces.Seek(aFace);
+  const ShapeUpgrade_UnifySameDomain::FaceSurfaceData* aData2 =
+    theFaceSurfaces.Seek(aCheckedFace);
+  if (aData1 != nullptr && aData2 != nullptr)
+  {
+    S1 = aData1->Surface;
+    S2 = aData2->Surface;
+  }
+  else
+  {
+    aData1 = aData2 = nullptr;
 
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
+    S1 = BRep_Tool::Surface(aFace);
+    S2 = BRep_Tool::Surface(aCheckedFace);
+
+    S1 = ClearRts(S1);
+    S2 = ClearRts(S2);
+  }
 
   // occ::handle<Geom_OffsetSurface> aGOFS1, aGOFS2;
   // aGOFS1 = occ::down_cast<Geom_OffsetSurface>(S1);
@@ -1566,15 +1584,34 @@ static bool IsSameDomain(const TopoDS_Face&                                aFace
 
   // case of two planar surfaces:
   // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar())
+  bool   isPlanar1 = false, isPlanar2 = false;
+  gp_Pln aPln1, aPln2;
+  if (aData1 != nullptr)
+  {
+    isPlanar1 = aData1->IsPlanar;
+    isPlanar2 = aData2->IsPlanar;
+    aPln1     = aData1->Plane;
+    aPln2     = aData2->Plane;
+  }
+  else
   {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar())
+    GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
+    isPlanar1 = aPlanarityChecker1.IsPlanar();
+    if (isPlanar1)
+    {
+      aPln1 = aPlanarityChecker1.Plan();
+      GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
+      isPlanar2 = aPlanarityChecker2.IsPlanar();
+      if (isPlanar2)
+      {
+        aPln2 = aPlanarityChecker2.Plan();
+      }
+    }
+  }
+  if (isPlanar1)
+  {
+    if (isPlanar2)
     {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
-
       if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol)
           && aPln1.Distance(aPln2) < theLinTol)
       {
@@ -1606,6 +1643,13 @@ static bool IsSameDomain(const TopoDS_Face&                                aFace
   if (S1->IsKind(STANDARD_TYPE(Geom_ElementarySurface))
       && S2->IsKind(STANDARD_TYPE(Geom_ElementarySurface)))
   {
+    // the coincident surfaces have been grouped in advance
+    if (aData1 != nullptr && aData1->DomainIndex > 0
+        && aData1->DomainIndex == aData2->DomainIndex)
+    {
+      return true;
+    }
+
     occ::handle<GeomAdaptor_Surface> aGA1 = new GeomAdaptor_Surface(S1);
     occ::handle<GeomAdaptor_Surface> aGA2 = new GeomAdaptor_Surface(S2);
 
@@ -2976,6 +3020,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
       myConcatBSplines(false),
       myAllowInternal(false),
       mySafeInputMode(true),
+      myRunParallel(false),
       myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -2995,6 +3040,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
       myConcatBSplines(ConcatBSplines),
       myAllowInternal(false),
       mySafeInputMode(true),
+      myRunParallel(false),
       myShape(aShape),
       myHistory(new BRepTools_History)
 {
@@ -3017,6 +3063,7 @@ void ShapeUpgrade_UnifySameDomain::Initialize(const TopoDS_Shape& aShape,
   myContext->Clear();
   myKeepShapes.Clear();
   myFacePlaneMap.Clear();
+  myFaceSurfaces.Clear();
   myEFmap.Clear();
   myFaceNewFace.Clear();
   myHistory->Clear();
@@ -3076,6 +3123,47 @@ void ShapeUpgrade_UnifySameDomain::UnifyFaces()
     TopExp::MapShapesAndAncestors(aFaceMap(i), TopAbs_EDGE, TopAbs_FACE, aGMapEdgeFaces);
   }
 
+  // evaluate the surfaces of faces (which is the most expensive part of checking
+  // the faces for lying on the same domain) in advance
+  NCollection_Array1<FaceSurfaceData> aFaceSurfaces(1, std::max(aFaceMap.Extent(), 1));
+  OSD_Parallel::For(
+    1,
+    aFaceMap.Extent() + 1,
+    [&](const int theIndex) {
+      const TopoDS_Face& aFace = TopoDS::Face(aFaceMap(theIndex));
+      FaceSurfaceData&   aData = aFaceSurfaces(theIndex);
+      aData.Surface            = ClearRts(BRep_Tool::Surface(aFace));
+      if (aData.Surface.IsNull())
+      {
+        return;
+      }
+      GeomLib_IsPlanarSurface aPlanarityChecker(aData.Surface, myLinTol);
+      aData.IsPlanar = aPlanarityChecker.IsPlanar();
+      if (aData.IsPlanar)
+      {
+        aData.Plane = aPlanarityChecker.Plan();
+      }
+    },
+    !myRunParallel);
+
+  // group coincident elementary surfaces by hashing instead of intersecting them pairwise
+  NCollection_IndexedMap<occ::handle<Geom_Surface>, GeomHash_SurfaceHasher> aDomains(
+    GeomHash_SurfaceHasher(Precision::Angular(), myLinTol),
+    static_cast<size_t>(aFaceMap.Extent()) + 1);
+  for (int i = 1; i <= aFaceMap.Extent(); i++)
+  {
+    FaceSurfaceData& aData = aFaceSurfaces(i);
+    if (aData.Surface.IsNull())
+    {
+      continue;
+    }
+    if (aData.Surface->IsKind(STANDARD_TYPE(Geom_ElementarySurface)))
+    {
+      aData.DomainIndex = aDomains.Add(aData.Surface);
+    }
+    myFaceSurfaces.Bind(aFaceMap(i), aData);
+  }
+
   // creating map of face shells for the whole shape to avoid
   // unification of faces belonging to the different shells
   DataMapOfShapeMapOfShape aGMapFaceShells;
@@ -3144,6 +3232,7 @@ void ShapeUpgrade_UnifySameDomain::UnifyFaces()
     IntUnifyFaces(aCmp, aGMapEdgeFaces, DataMapOfShapeMapOfShape(), aFreeBoundMap);
   }
 
+  myFaceSurfaces.Clear();
   myShape = myContext->Apply(myShape);
 }
 
@@ -3352,7 +3441,12 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(
           }
         }
         //
-        if (IsSameDomain(aFace, aCheckedFace, myLinTol, myAngTol, myFacePlaneMap))
+        if (IsSameDomain(aFace,
+                         aCheckedFace,
+                         myLinTol,
+                         myAngTol,
+                         myFaceSurfaces,
+                         myFacePlaneMap))
         {
 
           if (AddOrdinaryEdges(edges, aCheckedFace, dummy, RemovedEdges))
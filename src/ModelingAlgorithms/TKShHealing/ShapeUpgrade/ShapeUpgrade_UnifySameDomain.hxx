@@ -31,6 +31,7 @@
 #include <NCollection_Map.hxx>
 #include <NCollection_Sequence.hxx>
 #include <Geom_Plane.hxx>
+#include <gp_Pln.hxx>
 #include <Precision.hxx>
 class ShapeBuild_ReShape;
 
@@ -73,6 +74,25 @@ public:
                               TopTools_ShapeMapHasher>
     DataMapOfShapeMapOfShape;
 
+  //! Surface data of the face, evaluated once before unification of faces
+  //! to check the faces for lying on the same domain.
+  struct FaceSurfaceData
+  {
+    occ::handle<Geom_Surface> Surface;  //!< basis surface of the face, transformed by location
+    gp_Pln                    Plane;    //!< plane of the planar surface
+    bool                      IsPlanar; //!< flag indicating that the surface is planar
+    //! Index of the group of coincident elementary surfaces, 0 for other surfaces
+    int DomainIndex;
+
+    FaceSurfaceData()
+        : IsPlanar(false),
+          DomainIndex(0)
+    {
+    }
+  };
+  typedef NCollection_DataMap<TopoDS_Shape, FaceSurfaceData, TopTools_ShapeMapHasher>
+    DataMapOfFaceSurfaceData;
+
   //! Empty constructor
   Standard_EXPORT ShapeUpgrade_UnifySameDomain();
 
@@ -128,6 +148,13 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag to evaluate the surfaces of faces in parallel threads
+  //! before unification of faces. Default value is false.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myRunParallel; }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
 
@@ -213,10 +240,12 @@ private:
   bool                                                   myConcatBSplines;
   bool                                                   myAllowInternal;
   bool                                                   mySafeInputMode;
+  bool                                                   myRunParallel;
   TopoDS_Shape                                           myShape;
   occ::handle<ShapeBuild_ReShape>                        myContext;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myKeepShapes;
   DataMapOfFacePlane                                     myFacePlaneMap;
+  DataMapOfFaceSurfaceData                               myFaceSurfaces;
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
                                                                            myEFmap;
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myFaceNewFace;
@@ -41,6 +41,9 @@
 #define TEST 1
 
 #include <Bnd_Box2d.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <BndLib_Add2dCurve.hxx>
 #include <BndLib_Add3dCurve.hxx>
 #include <BRep_Builder.hxx>
@@ -74,12 +77,14 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_UBTreeFiller.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <Standard_Type.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <NCollection_Sequence.hxx>
 #include <NCollection_Array2.hxx>
 #include <Standard_Integer.hxx>
@@ -100,6 +105,7 @@
 #include <TopoDS_Wire.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_DataMap.hxx>
+#include <algorithm>
 #include <utility>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing, Standard_Transient)
@@ -2127,6 +2133,7 @@ void BRepBuilderAPI_Sewing::Init(const double tolerance,
   // myCuttingFloatingEdgesMode = false; //gka
   mySameParameterMode  = true;
   myLocalToleranceMode = false;
+  myRunParallel        = false;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -2583,6 +2590,43 @@ void BRepBuilderAPI_Sewing::Dump() const
   std::cout << " " << '\n';
 }
 
+//=======================================================================
+// function : isSmallEdge
+// purpose  : Checks if the 3D curve of the edge is compact within tolerance
+//=======================================================================
+
+static bool isSmallEdge(const TopoDS_Edge& theEdge, const double theMinTolerance)
+{
+  if (BRep_Tool::Degenerated(theEdge))
+  {
+    return false;
+  }
+  double                  first, last;
+  occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(theEdge, first, last);
+  if (c3d.IsNull())
+  {
+#ifdef OCCT_DEBUG
+    std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
+#endif
+    return false;
+  }
+
+  // Evaluate curve compactness
+  const int npt = 5;
+  gp_Pnt    cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
+  double    dist, maxdist = 0.0;
+  double    delta = (last - first) / (npt - 1);
+  for (int idx = 0; idx < npt; idx++)
+  {
+    dist = cp.Distance(c3d->Value(first + idx * delta));
+    if (maxdist < dist)
+    {
+      maxdist = dist;
+    }
+  }
+  return (2. * maxdist <= theMinTolerance);
+}
+
 //=======================================================================
 // function : FaceAnalysis
 // purpose  : Remove
@@ -2608,6 +2652,28 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
                         GluedVertices;
   int                   i = 1;
   Message_ProgressScope aPS(theProgress, "Shape analysis", myOldShapes.Extent());
+
+  // Evaluate compactness of all edges of faces at once, as it is independent per edge
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aCheckedEdges;
+  for (i = 1; i <= myOldShapes.Extent(); i++)
+  {
+    for (TopExp_Explorer fexp(myOldShapes(i), TopAbs_FACE); fexp.More(); fexp.Next())
+    {
+      TopExp::MapShapes(fexp.Current(), TopAbs_EDGE, aCheckedEdges);
+    }
+  }
+  NCollection_Array1<bool> aSmallFlags(1, std::max(aCheckedEdges.Extent(), 1));
+  aSmallFlags.Init(false);
+  const double aMinTol = MinTolerance();
+  OSD_Parallel::For(
+    1,
+    aCheckedEdges.Extent() + 1,
+    [&](const int theIndex) {
+      aSmallFlags.ChangeValue(theIndex) =
+        isSmallEdge(TopoDS::Edge(aCheckedEdges.FindKey(theIndex)), aMinTol);
+    },
+    !myRunParallel);
+
   for (i = 1; i <= myOldShapes.Extent() && aPS.More(); i++, aPS.Next())
   {
     for (TopExp_Explorer fexp(myOldShapes(i), TopAbs_FACE); fexp.More(); fexp.Next())
@@ -2663,43 +2729,7 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
           {
 
             // Check for small edge
-            double                  first, last;
-            occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(edge, first, last);
-            if (c3d.IsNull())
-            {
-#ifdef OCCT_DEBUG
-              std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
-#endif
-            }
-            else
-            {
-              // Evaluate curve compactness
-              const int npt = 5;
-              gp_Pnt    cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
-              double    dist, maxdist = 0.0;
-              double    delta = (last - first) / (npt - 1);
-              for (int idx = 0; idx < npt; idx++)
-              {
-                dist = cp.Distance(c3d->Value(first + idx * delta));
-                if (maxdist < dist)
-                {
-                  maxdist = dist;
-                }
-              }
-              isSmall = (2. * maxdist <= MinTolerance());
-              /*try {
-            GeomAdaptor_Curve cAdapt(c3d);
-            double length = GCPnts_AbscissaPoint::Length(cAdapt,first,last);
-            isSmall = (length <= MinTolerance());
-              }
-              catch (Standard_Failure) {
-    #ifdef OCCT_DEBUG
-            std::cout << "Warning: Possibly small edge can be sewed: ";
-            Standard_Failure::Caught()->Print(std::cout); std::cout << std::endl;
-    #endif
-              }*/
-            }
-
+            isSmall = aSmallFlags.Value(aCheckedEdges.FindIndex(edge));
             if (isSmall)
             {
 
@@ -4430,6 +4460,66 @@ bool BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape&
   return success;
 }
 
+namespace
+{
+//! Selector of vertex boxes overlapping the given box from BVH tree.
+class VertexBoxSelector : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3, int>, bool>
+{
+public:
+  //! Sets the box to search for overlapping with it.
+  void SetBox(const BVH_Box<double, 3>& theBox) { myBox = theBox; }
+
+  //! Returns indices of overlapping boxes.
+  NCollection_DynamicArray<int>& Indices() { return myIndices; }
+
+  //! Rejects the node not overlapping the box.
+  bool RejectNode(const BVH_Vec3d& theCMin, const BVH_Vec3d& theCMax, bool& theIsInside)
+    const override
+  {
+    bool hasOverlap = false;
+    theIsInside     = myBox.Contains(theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  //! Accepts elements of nodes inside the box.
+  bool AcceptMetric(const bool& theIsInside) const override { return theIsInside; }
+
+  //! Accepts the element overlapping the box.
+  bool Accept(const int theIndex, const bool& theIsInside) override
+  {
+    if (theIsInside || !myBox.IsOut(this->myBVHSet->Box(theIndex)))
+    {
+      myIndices.Append(this->myBVHSet->Element(theIndex));
+      return true;
+    }
+    return false;
+  }
+
+private:
+  BVH_Box<double, 3>            myBox;
+  NCollection_DynamicArray<int> myIndices;
+};
+
+//! Converts bounding box into BVH box.
+BVH_Box<double, 3> toBVHBox(const Bnd_Box& theBox)
+{
+  double aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+  theBox.Get(aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+  return BVH_Box<double, 3>(BVH_Vec3d(aXMin, aYMin, aZMin), BVH_Vec3d(aXMax, aYMax, aZMax));
+}
+
+//! Data of the bound to be cut, computed independently of other bounds.
+struct CuttingBound
+{
+  TopoDS_Vertex                                                 V1;
+  TopoDS_Vertex                                                 V2;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> Candidates;
+  NCollection_Array1<double>                                    Dist;
+  NCollection_Array1<double>                                    Para;
+  NCollection_Array1<gp_Pnt>                                    Proj;
+};
+} // namespace
+
 //=======================================================================
 // function : Cutting
 // purpose  : Modifies :
@@ -4445,109 +4535,170 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   {
     return;
   }
-  // Create a box tree with vertices
-  double                                 eps = myTolerance * 0.5;
-  NCollection_UBTree<int, Bnd_Box>       aTree;
-  NCollection_UBTreeFiller<int, Bnd_Box> aTreeFiller(aTree);
-  BRepBuilderAPI_BndBoxTreeSelector      aSelector;
+  // Create a box tree with vertices;
+  // in parallel mode BVH tree is used as it could be traversed concurrently,
+  // otherwise UBTree keeps the order of candidates (hence of equal distances)
+  double                                  eps = myTolerance * 0.5;
+  occ::handle<BVH_BoxSet<double, 3, int>> aBoxSet;
+  NCollection_UBTree<int, Bnd_Box>        aTree;
+  NCollection_UBTreeFiller<int, Bnd_Box>  aTreeFiller(aTree);
+  BRepBuilderAPI_BndBoxTreeSelector       aTreeSelector;
+  if (myRunParallel)
+  {
+    aBoxSet = new BVH_BoxSet<double, 3, int>(new BVH_LinearBuilder<double, 3>());
+    aBoxSet->SetSize(nbVertices);
+  }
   for (i = 1; i <= nbVertices; i++)
   {
     gp_Pnt  pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
     Bnd_Box aBox;
     aBox.Set(pt);
     aBox.Enlarge(eps);
-    aTreeFiller.Add(i, aBox);
-  }
-  aTreeFiller.Fill();
-
-  occ::handle<Geom_Curve> c3d;
-  TopLoc_Location         loc;
-  double                  first, last;
-  // Iterate on all boundaries
-  int                   nbBounds = myBoundFaces.Extent();
-  Message_ProgressScope aPS(theProgress, "Cutting bounds", nbBounds);
-  NCollection_IndexedDataMap<TopoDS_Shape,
-                             NCollection_List<TopoDS_Shape>,
-                             TopTools_ShapeMapHasher>::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next())
-  {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent())
-    {
-      continue;
-    }
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull())
+    if (myRunParallel)
     {
-      continue;
+      aBoxSet->Add(i, toBVHBox(aBox));
     }
-    if (!loc.IsIdentity())
+    else
     {
-      c3d = occ::down_cast<Geom_Curve>(c3d->Copy());
-      c3d->Transform(loc.Transformation());
+      aTreeFiller.Add(i, aBox);
     }
-    // Create cutting sections
-    NCollection_List<TopoDS_Shape> listSections;
-    { // szv: Use brackets to destroy local variables
+  }
+  if (myRunParallel)
+  {
+    aBoxSet->Build();
+  }
+  else
+  {
+    aTreeFiller.Fill();
+  }
+
+  // Search candidate vertices and project them on bounds;
+  // each bound is processed independently so that it could be done in parallel
+  int                                             nbBounds = myBoundFaces.Extent();
+  NCollection_Array1<CuttingBound> aCutBounds(1, std::max(nbBounds, 1));
+  OSD_Parallel::For(
+    1,
+    nbBounds + 1,
+    [&](const int theIndex) {
+      // Do not cut floating edges
+      if (!myBoundFaces.FindFromIndex(theIndex).Extent())
+      {
+        return;
+      }
+      // Obtain bound curve
+      const TopoDS_Edge&      bound = TopoDS::Edge(myBoundFaces.FindKey(theIndex));
+      TopLoc_Location         loc;
+      double                  first, last;
+      occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(bound, loc, first, last);
+      if (c3d.IsNull())
+      {
+        return;
+      }
+      if (!loc.IsIdentity())
+      {
+        c3d = occ::down_cast<Geom_Curve>(c3d->Copy());
+        c3d->Transform(loc.Transformation());
+      }
       // Obtain candidate vertices
-      TopoDS_Vertex                                                 V1, V2;
-      NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> CandidateVertices;
-      { // szv: Use brackets to destroy local variables
+      CuttingBound& aCutBound = aCutBounds.ChangeValue(theIndex);
+      {
         // Create bounding box around curve
         Bnd_Box           aGlobalBox;
         GeomAdaptor_Curve adptC(c3d, first, last);
         BndLib_Add3dCurve::Add(adptC, myTolerance, aGlobalBox);
+        if (aGlobalBox.IsVoid())
+        {
+          return;
+        }
         // Sort vertices to find candidates
-        aSelector.SetCurrent(aGlobalBox);
-        aTree.Select(aSelector);
+        NCollection_DynamicArray<int> anIndices;
+        if (myRunParallel)
+        {
+          VertexBoxSelector aSelector;
+          aSelector.SetBVHSet(aBoxSet.get());
+          aSelector.SetBox(toBVHBox(aGlobalBox));
+          aSelector.Select();
+          // keep the order of vertices independent of tree structure
+          std::sort(aSelector.Indices().begin(), aSelector.Indices().end());
+          anIndices = aSelector.Indices();
+        }
+        else
+        {
+          aTreeSelector.SetCurrent(aGlobalBox);
+          aTree.Select(aTreeSelector);
+          for (const int anIndex : aTreeSelector.ResInd())
+          {
+            anIndices.Append(anIndex);
+          }
+          aTreeSelector.ClearResList();
+        }
         // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent())
+        if (anIndices.IsEmpty())
         {
-          continue;
+          return;
         }
         // Retrieve bound nodes
-        TopExp::Vertices(bound, V1, V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
+        TopExp::Vertices(bound, aCutBound.V1, aCutBound.V2);
+        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(aCutBound.V1);
+        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(aCutBound.V2);
         // Fill map of candidate vertices
-        NCollection_List<int>::Iterator itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next())
+        for (const int index : anIndices)
         {
-          const int           index = itl.Value();
           const TopoDS_Shape& Node  = myVertexNode.FindFromIndex(index);
           if (!Node.IsSame(Node1) && !Node.IsSame(Node2))
           {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
+            aCutBound.Candidates.Add(myVertexNode.FindKey(index));
           }
         }
-        aSelector.ClearResList();
       }
-      int nbCandidates = CandidateVertices.Extent();
+      int nbCandidates = aCutBound.Candidates.Extent();
       if (!nbCandidates)
       {
-        continue;
+        return;
       }
       // Project vertices on curve
-      NCollection_Array1<double> arrPara(1, nbCandidates), arrDist(1, nbCandidates);
-      NCollection_Array1<gp_Pnt> arrPnt(1, nbCandidates), arrProj(1, nbCandidates);
+      aCutBound.Para.Resize(1, nbCandidates, false);
+      aCutBound.Dist.Resize(1, nbCandidates, false);
+      aCutBound.Proj.Resize(1, nbCandidates, false);
+      NCollection_Array1<gp_Pnt> arrPnt(1, nbCandidates);
       for (int j = 1; j <= nbCandidates; j++)
       {
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
+        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(aCutBound.Candidates(j)));
       }
-      ProjectPointsOnCurve(arrPnt, c3d, first, last, arrDist, arrPara, arrProj, true);
+      ProjectPointsOnCurve(arrPnt,
+                           c3d,
+                           first,
+                           last,
+                           aCutBound.Dist,
+                           aCutBound.Para,
+                           aCutBound.Proj,
+                           true);
+    },
+    !myRunParallel);
+
+  // Iterate on all boundaries
+  Message_ProgressScope aPS(theProgress, "Cutting bounds", nbBounds);
+  for (i = 1; i <= nbBounds && aPS.More(); i++, aPS.Next())
+  {
+    const CuttingBound& aCutBound = aCutBounds.Value(i);
+    if (aCutBound.Candidates.IsEmpty())
+    {
+      continue;
+    }
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    // Create cutting sections
+    NCollection_List<TopoDS_Shape> listSections;
+    { // szv: Use brackets to destroy local variables
       // Create cutting nodes
       NCollection_Sequence<TopoDS_Shape> seqNode;
       NCollection_Sequence<double>       seqPara;
-      CreateCuttingNodes(CandidateVertices,
+      CreateCuttingNodes(aCutBound.Candidates,
                          bound,
-                         V1,
-                         V2,
-                         arrDist,
-                         arrPara,
-                         arrProj,
+                         aCutBound.V1,
+                         aCutBound.V2,
+                         aCutBound.Dist,
+                         aCutBound.Para,
+                         aCutBound.Proj,
                          seqNode,
                          seqPara);
       if (!seqPara.Length())
@@ -225,9 +225,16 @@ public:
   void SetNonManifoldMode(const bool theNonManifoldMode);
 
   //! Gets mode for non-manifold sewing.
+  bool NonManifoldMode() const;
+
+  //! Sets mode for parallel processing of independent faces and bounds
+  //! (analysis of small edges and search for cutting vertices). By default - false.
+  void SetRunParallel(const bool theIsParallel);
+
+  //! Returns mode for parallel processing.
   //!
   //! INTERNAL FUNCTIONS ---
-  bool NonManifoldMode() const;
+  bool RunParallel() const;
 
   DEFINE_STANDARD_RTTIEXT(BRepBuilderAPI_Sewing, Standard_Transient)
 
@@ -414,6 +421,7 @@ private:
   bool                                                   myFloatingEdgesMode;
   bool                                                   mySameParameterMode;
   bool                                                   myLocalToleranceMode;
+  bool                                                   myRunParallel;
   double                                                 myMinTolerance;
   double                                                 myMaxTolerance;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myMergedEdges;
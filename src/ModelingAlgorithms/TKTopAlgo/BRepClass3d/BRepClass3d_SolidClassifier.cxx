@@ -62,7 +62,13 @@ static StatistiquesBRepClass3d STAT;
 #endif
 
 #include <BRepClass3d_SolidClassifier.hxx>
+#include <Bnd_Box.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
 #include <gp_Pnt.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_DimensionMismatch.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS_Shape.hxx>
 
 BRepClass3d_SolidClassifier::BRepClass3d_SolidClassifier()
@@ -210,6 +216,93 @@ void BRepClass3d_SolidClassifier::Perform(const gp_Pnt& P, const double Tol)
 #endif
 }
 
+void BRepClass3d_SolidClassifier::Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                                          const double                      theTol,
+                                          NCollection_Array1<TopAbs_State>& theStates,
+                                          const bool                        theToRunParallel)
+{
+  if (thePoints.Lower() != theStates.Lower() || thePoints.Upper() != theStates.Upper())
+  {
+    throw Standard_DimensionMismatch(
+      "BRepClass3d_SolidClassifier::Perform() - arrays of points and states differ");
+  }
+  if (thePoints.IsEmpty())
+  {
+    return;
+  }
+
+  // The points out of the bounding box of a solid with closed shells
+  // have the same state as the infinite point.
+  Bnd_Box      aBox;
+  TopAbs_State aStateOut = TopAbs_UNKNOWN;
+  if (aSolidLoaded && !explorer.Reject(gp_Pnt()))
+  {
+    bool isClosed = false;
+    for (TopExp_Explorer aShellExp(explorer.GetShape(), TopAbs_SHELL); aShellExp.More();
+         aShellExp.Next())
+    {
+      isClosed = BRep_Tool::IsClosed(aShellExp.Current());
+      if (!isClosed)
+      {
+        break;
+      }
+    }
+    if (isClosed)
+    {
+      BRepClass3d_SClassifier anInfClassifier;
+      anInfClassifier.PerformInfinitePoint(explorer, theTol);
+      aStateOut = anInfClassifier.State();
+      if (aStateOut == TopAbs_IN || aStateOut == TopAbs_OUT)
+      {
+        BRepBndLib::Add(explorer.GetShape(), aBox, false);
+        aBox.Enlarge(theTol);
+      }
+    }
+  }
+
+  const auto aClassify = [&](BRepClass3d_SolidExplorer& theExplorer,
+                             BRepClass3d_SClassifier&   theClassifier,
+                             const int                  theIndex) {
+    const gp_Pnt& aPnt = thePoints.Value(theIndex);
+    if (!aBox.IsVoid() && aBox.IsOut(aPnt))
+    {
+      theStates.ChangeValue(theIndex) = aStateOut;
+      return;
+    }
+    theClassifier.Perform(theExplorer, aPnt, theTol);
+    theStates.ChangeValue(theIndex) = theClassifier.State();
+  };
+
+  if (!theToRunParallel || !aSolidLoaded || thePoints.Size() < 2)
+  {
+    BRepClass3d_SClassifier aClassifier;
+    for (int anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+    {
+      aClassify(explorer, aClassifier, anIndex);
+    }
+    return;
+  }
+
+  // The intersectors of faces keep the results of the last intersection,
+  // so each thread classifies the points with its own explorer of the solid.
+  const occ::handle<OSD_ThreadPool>& aPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher           aLauncher(*aPool, aPool->NbDefaultThreadsToLaunch());
+  NCollection_Array1<BRepClass3d_SolidExplorer> anExplorers(aLauncher.LowerThreadIndex(),
+                                                            aLauncher.UpperThreadIndex());
+  NCollection_Array1<BRepClass3d_SClassifier>   aClassifiers(aLauncher.LowerThreadIndex(),
+                                                           aLauncher.UpperThreadIndex());
+  aLauncher.Perform(thePoints.Lower(),
+                    thePoints.Upper() + 1,
+                    [&](const int theThreadIndex, const int theIndex) {
+                      BRepClass3d_SolidExplorer& anExpl = anExplorers.ChangeValue(theThreadIndex);
+                      if (anExpl.GetShape().IsNull())
+                      {
+                        anExpl.InitShape(explorer.GetShape());
+                      }
+                      aClassify(anExpl, aClassifiers.ChangeValue(theThreadIndex), theIndex);
+                    });
+}
+
 void BRepClass3d_SolidClassifier::PerformInfinitePoint(const double Tol)
 {
 #if LBRCOMPT
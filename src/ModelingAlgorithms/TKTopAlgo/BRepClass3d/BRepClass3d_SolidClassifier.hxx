@@ -23,6 +23,8 @@
 #include <Standard_Boolean.hxx>
 #include <BRepClass3d_SolidExplorer.hxx>
 #include <BRepClass3d_SClassifier.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopAbs_State.hxx>
 class TopoDS_Shape;
 class gp_Pnt;
 
@@ -50,6 +52,18 @@ public:
   //! tolerance Tol on the solid S.
   Standard_EXPORT void Perform(const gp_Pnt& P, const double Tol);
 
+  //! Classifies the points thePoints with the tolerance theTol on the solid
+  //! and stores their states into theStates, which should have the same bounds.
+  //! For a solid with closed shells, the bounding box of the solid and the state
+  //! of the infinite point are computed once, and the points out of the box
+  //! get the state of the infinite point without casting of rays.
+  //! In parallel mode, each thread uses its own explorer of the solid.
+  //! The state of this classifier is not modified.
+  Standard_EXPORT void Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                               const double                      theTol,
+                               NCollection_Array1<TopAbs_State>& theStates,
+                               const bool                        theToRunParallel = false);
+
   //! Classify an infinite point with the
   //! tolerance Tol on the solid S.
   //! Useful for compute the orientation of a solid.
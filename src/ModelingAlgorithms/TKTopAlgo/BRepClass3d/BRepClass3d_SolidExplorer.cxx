@@ -898,11 +898,13 @@ void BRepClass3d_SolidExplorer::Destroy()
 void BRepClass3d_SolidExplorer::InitShape(const TopoDS_Shape& S)
 {
   myMapEV.Clear();
+  myMapEF.Clear();
   myTree.Clear();
 
   myShape       = S;
   myFirstFace   = 0;
   myParamOnEdge = 0.512345;
+  TopExp::MapShapesAndAncestors(myShape, TopAbs_EDGE, TopAbs_FACE, myMapEF);
   //-- Exploring of the Map and removal of allocated objects
 
   NCollection_DataMap<TopoDS_Shape, void*, TopTools_ShapeMapHasher>::Iterator iter(myMapOfInter);
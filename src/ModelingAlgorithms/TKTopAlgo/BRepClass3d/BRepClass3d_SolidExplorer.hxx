@@ -25,6 +25,8 @@
 #include <TopAbs_State.hxx>
 #include <TopExp_Explorer.hxx>
 #include <NCollection_IndexedMap.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_List.hxx>
 
 class gp_Pnt;
 class TopoDS_Face;
@@ -181,6 +183,15 @@ public:
     return myMapEV;
   }
 
+  //! Return map of edges and their ancestor faces for current shape.
+  const NCollection_IndexedDataMap<TopoDS_Shape,
+                                   NCollection_List<TopoDS_Shape>,
+                                   TopTools_ShapeMapHasher>&
+    GetMapEF() const
+  {
+    return myMapEF;
+  }
+
   Standard_EXPORT void Destroy();
 
 private:
@@ -201,6 +212,8 @@ private:
   NCollection_DataMap<TopoDS_Shape, void*, TopTools_ShapeMapHasher> myMapOfInter;
   NCollection_UBTree<int, Bnd_Box>                                  myTree;
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>     myMapEV;
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    myMapEF;
 };
 
 #endif // _BRepClass3d_SolidExplorer_HeaderFile
@@ -27,11 +27,13 @@
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_DynamicArray.hxx>
 #include <NCollection_Map.hxx>
 #include <BRepCheck_Shell.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
+#include <OSD_Parallel.hxx>
 #include <cmath>
 
 #ifdef OCCT_DEBUG
@@ -79,6 +81,23 @@ public:
   }
 };
 
+//! Face to be integrated and its computed properties.
+struct FaceProps
+{
+  TopoDS_Face  Face;   //!< face to integrate
+  GProp_GProps Props;  //!< properties of the face
+  double       Error;  //!< error reached by the adaptive integration
+  int          Index;  //!< index of the face in the shape
+  bool         IsMesh; //!< flag indicating integration over the face triangulation
+
+  FaceProps()
+      : Error(0.0),
+        Index(0),
+        IsMesh(false)
+  {
+  }
+};
+
 } // anonymous namespace
 
 static gp_Pnt roughBaryCenter(const TopoDS_Shape& S)
@@ -164,99 +183,106 @@ void BRepGProp::LinearProperties(const TopoDS_Shape& S,
   }
 }
 
-static double surfaceProperties(const TopoDS_Shape& S,
-                                GProp_GProps&       Props,
-                                const double        Eps,
-                                const bool          SkipShared,
-                                const bool          UseTriangulation)
+//! Returns TRUE if the face should be integrated using its triangulation.
+//! Returns FALSE in theToSkip if the face has neither surface nor triangulation.
+static bool isMeshIntegration(const TopoDS_Face& F, const bool UseTriangulation, bool& theToSkip)
 {
-  int i;
-#ifdef OCCT_DEBUG
-  int iErrorMax = 0;
-#endif
-  double           ErrorMax = 0.0, Error;
-  TopExp_Explorer  ex;
-  gp_Pnt           P(roughBaryCenter(S));
-  BRepGProp_Sinert G;
-  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face                                         BF;
-  BRepGProp_Domain                                       BD;
-  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFMap;
-  TopLoc_Location                                        aLocDummy;
+  TopLoc_Location                        aLocDummy;
+  const occ::handle<Geom_Surface>&       aSurf  = BRep_Tool::Surface(F, aLocDummy);
+  const occ::handle<Poly_Triangulation>& aTri   = BRep_Tool::Triangulation(F, aLocDummy);
+  const bool                             NoSurf = aSurf.IsNull();
+  const bool NoTri = aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0;
+  theToSkip        = NoTri && NoSurf;
+  return (UseTriangulation && !NoTri) || (NoSurf && !NoTri);
+}
 
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+//! Computes the properties of a single face relatively to the point theRefPnt.
+//! InertType is BRepGProp_Sinert or BRepGProp_Vinert defining the kind of properties.
+template <class InertType>
+static void faceProperties(FaceProps&                                       theFace,
+                           const gp_Pnt&                                    theRefPnt,
+                           const double                                     Eps,
+                           const BRepGProp_MeshProps::BRepGProp_MeshObjType theMeshType)
+{
+  const TopoDS_Face& F = theFace.Face;
+  if (theFace.IsMesh)
   {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    if (SkipShared && !aFMap.Add(F))
-    {
-      continue;
-    }
-
-    bool NoSurf = false, NoTri = false;
-    {
-      const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = true;
-      }
-      const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = true;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
-    }
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLoc);
+    BRepGProp_MeshProps                    MG(theMeshType);
+    MG.SetLocation(theRefPnt);
+    MG.Perform(aTri, aLoc, F.Orientation());
+    theFace.Props = MG;
+    return;
+  }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
+  InertType G;
+  G.SetLocation(theRefPnt);
+  BRepGProp_Face   BF;
+  BRepGProp_Domain BD;
+  BF.Load(F);
+  bool IsNatRestr = (F.NbChildren() == 0);
+  if (!IsNatRestr)
+  {
+    BD.Init(F);
+  }
+  if (Eps < 1.0)
+  {
+    G.Perform(BF, BD, Eps);
+    theFace.Error = G.GetEpsilon();
+  }
+  else
+  {
+    if (IsNatRestr)
     {
-      TopAbs_Orientation                     anOri = F.Orientation();
-      const occ::handle<Poly_Triangulation>& aTri  = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
+      G.Perform(BF);
     }
     else
     {
-      BF.Load(F);
-      bool IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr)
-      {
-        BD.Init(F);
-      }
-      if (Eps < 1.0)
-      {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error)
-        {
-          ErrorMax = Error;
+      G.Perform(BF, BD);
+    }
+  }
+  theFace.Props = G;
+}
+
+//! Computes the properties of the faces, concurrently in parallel mode,
+//! and adds them to Props in the order of the faces.
+//! Returns the maximal error reached on the faces.
+template <class InertType>
+static double facesProperties(NCollection_DynamicArray<FaceProps>&             theFaces,
+                              GProp_GProps&                                    Props,
+                              const gp_Pnt&                                    theRefPnt,
+                              const double                                     Eps,
+                              const BRepGProp_MeshProps::BRepGProp_MeshObjType theMeshType,
+                              const bool                                       theIsParallel)
+{
+  OSD_Parallel::For(
+    0,
+    static_cast<int>(theFaces.Size()),
+    [&](const int theIndex) {
+      faceProperties<InertType>(theFaces.ChangeValue(theIndex), theRefPnt, Eps, theMeshType);
+    },
+    !theIsParallel || theFaces.Size() < 2);
+
+  double ErrorMax = 0.0;
 #ifdef OCCT_DEBUG
-          iErrorMax = i;
+  int iErrorMax = 0;
 #endif
-        }
-      }
-      else
-      {
-        if (IsNatRestr)
-        {
-          G.Perform(BF);
-        }
-        else
-        {
-          G.Perform(BF, BD);
-        }
-      }
-      Props.Add(G);
+  for (int i = 0; i < static_cast<int>(theFaces.Size()); ++i)
+  {
+    const FaceProps& aFace = theFaces.Value(i);
+    Props.Add(aFace.Props);
+    if (ErrorMax < aFace.Error)
+    {
+      ErrorMax = aFace.Error;
 #ifdef OCCT_DEBUG
-      if (AffichEps)
-        std::cout << "\n" << i << ":\tEpsArea = " << G.GetEpsilon();
+      iErrorMax = aFace.Index;
 #endif
     }
+#ifdef OCCT_DEBUG
+    if (AffichEps && !aFace.IsMesh)
+      std::cout << "\n" << aFace.Index << ":\tEps = " << aFace.Error;
+#endif
   }
 #ifdef OCCT_DEBUG
   if (AffichEps)
@@ -265,28 +291,71 @@ static double surfaceProperties(const TopoDS_Shape& S,
   return ErrorMax;
 }
 
+static double surfaceProperties(const TopoDS_Shape& S,
+                                GProp_GProps&       Props,
+                                const double        Eps,
+                                const bool          SkipShared,
+                                const bool          UseTriangulation,
+                                const bool          theIsParallel)
+{
+  int                                                    i;
+  TopExp_Explorer                                        ex;
+  gp_Pnt                                                 P(roughBaryCenter(S));
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFMap;
+  NCollection_DynamicArray<FaceProps>                    aFaces;
+
+  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+  {
+    const TopoDS_Face& F = TopoDS::Face(ex.Current());
+    if (SkipShared && !aFMap.Add(F))
+    {
+      continue;
+    }
+
+    bool       isToSkip = false;
+    const bool isMesh   = isMeshIntegration(F, UseTriangulation, isToSkip);
+    if (isToSkip)
+    {
+      continue;
+    }
+
+    FaceProps& aFace = aFaces.Appended();
+    aFace.Face       = F;
+    aFace.Index      = i;
+    aFace.IsMesh     = isMesh;
+  }
+  return facesProperties<BRepGProp_Sinert>(aFaces,
+                                           Props,
+                                           P,
+                                           Eps,
+                                           BRepGProp_MeshProps::Sinert,
+                                           theIsParallel);
+}
+
 void BRepGProp::SurfaceProperties(const TopoDS_Shape& S,
                                   GProp_GProps&       Props,
                                   const bool          SkipShared,
-                                  const bool          UseTriangulation)
+                                  const bool          UseTriangulation,
+                                  const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
 }
 
 double BRepGProp::SurfaceProperties(const TopoDS_Shape& S,
                                     GProp_GProps&       Props,
                                     const double        Eps,
-                                    const bool          SkipShared)
+                                    const bool          SkipShared,
+                                    const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
   Props           = GProp_GProps(P);
-  double ErrorMax = surfaceProperties(S, Props, Eps, SkipShared, false);
+  double ErrorMax = surfaceProperties(S, Props, Eps, SkipShared, false, theIsParallel);
   return ErrorMax;
 }
 
@@ -300,24 +369,14 @@ static double volumePropertiesFaces(const TopoDS_Shape& S,
                                     const gp_Pnt&       theRefPnt,
                                     const double        Eps,
                                     const bool          SkipShared,
-                                    const bool          UseTriangulation)
+                                    const bool          UseTriangulation,
+                                    const bool          theIsParallel)
 {
-  int i;
-#ifdef OCCT_DEBUG
-  int iErrorMax = 0;
-#endif
-  double           ErrorMax = 0.0, Error = 0.0;
-  TopExp_Explorer  ex;
-  BRepGProp_Vinert G;
-  G.SetLocation(theRefPnt);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(theRefPnt);
-
-  BRepGProp_Face                                         BF;
-  BRepGProp_Domain                                       BD;
+  int                                                    i;
+  TopExp_Explorer                                        ex;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFwdFMap;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aRvsFMap;
-  TopLoc_Location                                        aLocDummy;
+  NCollection_DynamicArray<FaceProps>                    aFaces;
 
   for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
   {
@@ -336,76 +395,29 @@ static double volumePropertiesFaces(const TopoDS_Shape& S,
         continue;
       }
     }
-    bool NoSurf = false, NoTri = false;
+    if (!isFwd && !isRvs)
     {
-      const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = true;
-      }
-      const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = true;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
+      continue;
     }
 
-    if (isFwd || isRvs)
+    bool       isToSkip = false;
+    const bool isMesh   = isMeshIntegration(F, UseTriangulation, isToSkip);
+    if (isToSkip)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        bool IsNatRestr = (F.NbChildren() == 0);
-        if (!IsNatRestr)
-        {
-          BD.Init(F);
-        }
-        if (Eps < 1.0)
-        {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error)
-          {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else
-        {
-          if (IsNatRestr)
-          {
-            G.Perform(BF);
-          }
-          else
-          {
-            G.Perform(BF, BD);
-          }
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if (AffichEps)
-          std::cout << "\n" << i << ":\tEpsVolume = " << G.GetEpsilon();
-#endif
-      }
+      continue;
     }
+
+    FaceProps& aFace = aFaces.Appended();
+    aFace.Face       = F;
+    aFace.Index      = i;
+    aFace.IsMesh     = isMesh;
   }
-#ifdef OCCT_DEBUG
-  if (AffichEps)
-    std::cout << "\n-----------------\n" << iErrorMax << ":\tMaxError = " << ErrorMax << "\n";
-#endif
-  return ErrorMax;
+  return facesProperties<BRepGProp_Vinert>(aFaces,
+                                           Props,
+                                           theRefPnt,
+                                           Eps,
+                                           BRepGProp_MeshProps::Vinert,
+                                           theIsParallel);
 }
 
 //=================================================================================================
@@ -414,7 +426,8 @@ static double volumeProperties(const TopoDS_Shape& S,
                                GProp_GProps&       Props,
                                const double        Eps,
                                const bool          SkipShared,
-                               const bool          UseTriangulation)
+                               const bool          UseTriangulation,
+                               const bool          theIsParallel)
 {
   const gp_Pnt P(roughBaryCenter(S));
 
@@ -437,7 +450,7 @@ static double volumeProperties(const TopoDS_Shape& S,
   if (!hasSharedSolids)
   {
     // No shared solids: use direct face-level iteration (original path).
-    return volumePropertiesFaces(S, Props, P, Eps, SkipShared, UseTriangulation);
+    return volumePropertiesFaces(S, Props, P, Eps, SkipShared, UseTriangulation, theIsParallel);
   }
 
   // Shared solids detected: iterate at solid level with caching.
@@ -483,8 +496,13 @@ static double volumeProperties(const TopoDS_Shape& S,
       {
         // Non-rigid relative transform: fall back to direct face-level computation.
         GProp_GProps aSolidProps(P);
-        const double anError =
-          volumePropertiesFaces(aSolid, aSolidProps, P, Eps, SkipShared, UseTriangulation);
+        const double anError = volumePropertiesFaces(aSolid,
+                                                     aSolidProps,
+                                                     P,
+                                                     Eps,
+                                                     SkipShared,
+                                                     UseTriangulation,
+                                                     theIsParallel);
         if (ErrorMax < anError)
         {
           ErrorMax = anError;
@@ -508,8 +526,13 @@ static double volumeProperties(const TopoDS_Shape& S,
     {
       // First instance of this TShape: compute via face integration.
       GProp_GProps aSolidProps(P);
-      const double anError =
-        volumePropertiesFaces(aSolid, aSolidProps, P, Eps, SkipShared, UseTriangulation);
+      const double anError = volumePropertiesFaces(aSolid,
+                                                   aSolidProps,
+                                                   P,
+                                                   Eps,
+                                                   SkipShared,
+                                                   UseTriangulation,
+                                                   theIsParallel);
       if (ErrorMax < anError)
       {
         ErrorMax = anError;
@@ -539,8 +562,13 @@ static double volumeProperties(const TopoDS_Shape& S,
     if (hasFree)
     {
       GProp_GProps aFreeProps(P);
-      const double aFreeError =
-        volumePropertiesFaces(aFreeComp, aFreeProps, P, Eps, SkipShared, UseTriangulation);
+      const double aFreeError = volumePropertiesFaces(aFreeComp,
+                                                      aFreeProps,
+                                                      P,
+                                                      Eps,
+                                                      SkipShared,
+                                                      UseTriangulation,
+                                                      theIsParallel);
       if (ErrorMax < aFreeError)
       {
         ErrorMax = aFreeError;
@@ -556,7 +584,8 @@ void BRepGProp::VolumeProperties(const TopoDS_Shape& S,
                                  GProp_GProps&       Props,
                                  const bool          OnlyClosed,
                                  const bool          SkipShared,
-                                 const bool          UseTriangulation)
+                                 const bool          UseTriangulation,
+                                 const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
@@ -575,13 +604,13 @@ void BRepGProp::VolumeProperties(const TopoDS_Shape& S,
       }
       if (BRep_Tool::IsClosed(Sh))
       {
-        volumeProperties(Sh, Props, 1.0, SkipShared, UseTriangulation);
+        volumeProperties(Sh, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
       }
     }
   }
   else
   {
-    volumeProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+    volumeProperties(S, Props, 1.0, SkipShared, UseTriangulation, theIsParallel);
   }
 }
 
@@ -591,7 +620,8 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
                                    GProp_GProps&       Props,
                                    const double        Eps,
                                    const bool          OnlyClosed,
-                                   const bool          SkipShared)
+                                   const bool          SkipShared,
+                                   const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
@@ -615,7 +645,7 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
       }
       if (BRep_Tool::IsClosed(Sh))
       {
-        Error = volumeProperties(Sh, Props, Eps, SkipShared, false);
+        Error = volumeProperties(Sh, Props, Eps, SkipShared, false, theIsParallel);
         if (ErrorMax < Error)
         {
           ErrorMax = Error;
@@ -628,7 +658,7 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
   }
   else
   {
-    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, false);
+    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, false, theIsParallel);
   }
 #ifdef OCCT_DEBUG
   if (AffichEps)
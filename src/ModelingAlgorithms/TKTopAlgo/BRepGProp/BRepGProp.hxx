@@ -130,10 +130,13 @@ public:
   //! source of geometry data. If UseTriangulation = false,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel defines whether the faces are integrated in parallel threads;
+  //! the properties of the faces are summed up in the same order in both modes.
   Standard_EXPORT static void SurfaceProperties(const TopoDS_Shape& S,
                                                 GProp_GProps&       SProps,
                                                 const bool          SkipShared       = false,
-                                                const bool          UseTriangulation = false);
+                                                const bool          UseTriangulation = false,
+                                                const bool          theIsParallel    = false);
 
   //! Updates <SProps> with the shape <S>, that contains its principal properties.
   //! The surface properties of all the faces in <S> are computed.
@@ -147,10 +150,12 @@ public:
   //! shared topological entities or not
   //! For ex., if SkipShared = True, faces, shared by two or more shells,
   //! are taken into calculation only once.
+  //! theIsParallel defines whether the faces are integrated in parallel threads.
   Standard_EXPORT static double SurfaceProperties(const TopoDS_Shape& S,
                                                   GProp_GProps&       SProps,
                                                   const double        Eps,
-                                                  const bool          SkipShared = false);
+                                                  const bool          SkipShared    = false,
+                                                  const bool          theIsParallel = false);
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -193,11 +198,14 @@ public:
   //! source of geometry data. If UseTriangulation = false,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel defines whether the faces are integrated in parallel threads;
+  //! the properties of the faces are summed up in the same order in both modes.
   Standard_EXPORT static void VolumeProperties(const TopoDS_Shape& S,
                                                GProp_GProps&       VProps,
                                                const bool          OnlyClosed       = false,
                                                const bool          SkipShared       = false,
-                                               const bool          UseTriangulation = false);
+                                               const bool          UseTriangulation = false,
+                                               const bool          theIsParallel    = false);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -213,11 +221,13 @@ public:
   //! For ex., if SkipShared = True, the volumes formed by the equal
   //! (the same TShape, location and orientation)
   //! faces are taken into calculation only once.
+  //! theIsParallel defines whether the faces are integrated in parallel threads.
   Standard_EXPORT static double VolumeProperties(const TopoDS_Shape& S,
                                                  GProp_GProps&       VProps,
                                                  const double        Eps,
-                                                 const bool          OnlyClosed = false,
-                                                 const bool          SkipShared = false);
+                                                 const bool          OnlyClosed    = false,
+                                                 const bool          SkipShared    = false,
+                                                 const bool          theIsParallel = false);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -14,8 +14,6 @@
 #include <BRepGProp_MeshProps.hxx>
 
 #include <BRepGProp.hxx>
-#include <ElSLib.hxx>
-#include <gp_Ax3.hxx>
 #include <gp_Pnt.hxx>
 #include <GProp.hxx>
 #include <Poly_Triangulation.hxx>
@@ -110,54 +108,39 @@ void BRepGProp_MeshProps::CalculateProps(const gp_Pnt& p1,
   // GProps[7] = Ixy, aGProps[8] = Ixz, GProps[9] = Iyz,
   //
 
-  // Define plane and coordinates of triangle nodes on plane
-  gp_Vec aV12(p2, p1);
-  gp_Vec aV23(p3, p2);
-  gp_Vec aNorm = aV12 ^ aV23;
-  double aDet  = aNorm.Magnitude();
+  // Nodes of triangle relatively to apex; the Gauss points are evaluated
+  // directly by barycentric coordinates, without projection on triangle plane
+  const gp_XYZ aP1   = p1.XYZ() - Apex.XYZ();
+  const gp_XYZ aP2   = p2.XYZ() - Apex.XYZ();
+  const gp_XYZ aP3   = p3.XYZ() - Apex.XYZ();
+  const gp_XYZ aNorm = (aP1 - aP2).Crossed(aP2 - aP3);
+  const double aDet  = aNorm.Modulus();
   if (aDet <= gp::Resolution())
   {
     return;
   }
-  gp_XYZ aCenter = (p1.XYZ() + p2.XYZ() + p3.XYZ()) / 3.;
-  gp_Pnt aPC(aCenter);
-  gp_Dir aDN(aNorm);
-  gp_Ax3 aPosPln(aPC, aDN);
-  // Coordinates of nodes on plane
-  double x1, y1, x2, y2, x3, y3;
-  ElSLib::PlaneParameters(aPosPln, p1, x1, y1);
-  ElSLib::PlaneParameters(aPosPln, p2, x2, y2);
-  ElSLib::PlaneParameters(aPosPln, p3, x3, y3);
+  const gp_XYZ aV13 = aP1 - aP3;
+  const gp_XYZ aV23 = aP2 - aP3;
   //
-  double l1, l2; // barycentriche coordinates
-  double x, y, z;
-  double w; // weight
-  int    i;
-  for (i = 0; i < NbGaussPoints; ++i)
+  for (int i = 0; i < NbGaussPoints; ++i)
   {
-    int ind = 3 * i;
-    l1      = GaussPnts[ind];
-    l2      = GaussPnts[ind + 1];
-    w       = GaussPnts[ind + 2];
-    w *= aDet;
-    x         = l1 * (x1 - x3) + l2 * (x2 - x3) + x3;
-    y         = l1 * (y1 - y3) + l2 * (y2 - y3) + y3;
-    gp_Pnt aP = ElSLib::PlaneValue(x, y, aPosPln);
-    x         = aP.X() - Apex.X();
-    y         = aP.Y() - Apex.Y();
-    z         = aP.Z() - Apex.Z();
+    const int    ind = 3 * i;
+    const double l1  = GaussPnts[ind]; // barycentric coordinates
+    const double l2  = GaussPnts[ind + 1];
+    const double w   = GaussPnts[ind + 2]; // weight
+    const double x   = l1 * aV13.X() + l2 * aV23.X() + aP3.X();
+    const double y   = l1 * aV13.Y() + l2 * aV23.Y() + aP3.Y();
+    const double z   = l1 * aV13.Z() + l2 * aV23.Z() + aP3.Z();
     //
     if (isVolume)
     {
-      double xn = aDN.X() * w;
-      double yn = aDN.Y() * w;
-      double zn = aDN.Z() * w;
-      double dv = x * xn + y * yn + z * zn;
+      // projection of point on unit normal multiplied by weighted area
+      const double dv = (x * aNorm.X() + y * aNorm.Y() + z * aNorm.Z()) * w;
       CalculateElVProps(x, y, z, dv, GProps);
     }
     else
     {
-      double ds = w;
+      const double ds = w * aDet;
       CalculateElSProps(x, y, z, ds, GProps);
     }
   }
@@ -0,0 +1,78 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <gp_Pln.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_IndexedMap.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Sews grid of separate square faces with the long face along its bottom side,
+//! which has to be cut to be sewn with the squares.
+occ::handle<BRepBuilderAPI_Sewing> sewGrid(const int theNbCells, const bool theToRunParallel)
+{
+  occ::handle<BRepBuilderAPI_Sewing> aSewing = new BRepBuilderAPI_Sewing(1.0e-6);
+  aSewing->SetRunParallel(theToRunParallel);
+  const gp_Pln aPlane;
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      aSewing->Add(BRepBuilderAPI_MakeFace(aPlane, aCol, aCol + 1.0, aRow, aRow + 1.0).Face());
+    }
+  }
+  aSewing->Add(BRepBuilderAPI_MakeFace(aPlane, 0.0, theNbCells, -1.0, 0.0).Face());
+  aSewing->Perform();
+  return aSewing;
+}
+} // namespace
+
+TEST(BRepBuilderAPI_SewingTest, ParallelMatchesSequential)
+{
+  const int                          aNbCells   = 12;
+  occ::handle<BRepBuilderAPI_Sewing> aSeqSewing = sewGrid(aNbCells, false);
+  occ::handle<BRepBuilderAPI_Sewing> aParSewing = sewGrid(aNbCells, true);
+  EXPECT_TRUE(aParSewing->RunParallel());
+
+  const TopoDS_Shape& aSeqShape = aSeqSewing->SewedShape();
+  const TopoDS_Shape& aParShape = aParSewing->SewedShape();
+  ASSERT_FALSE(aSeqShape.IsNull());
+  ASSERT_FALSE(aParShape.IsNull());
+  EXPECT_EQ(aSeqShape.ShapeType(), TopAbs_SHELL);
+  EXPECT_EQ(aParShape.ShapeType(), aSeqShape.ShapeType());
+  EXPECT_TRUE(BRepCheck_Analyzer(aParShape).IsValid());
+
+  // internal edges of the grid and split bottom side of the long face
+  EXPECT_EQ(aSeqSewing->NbContigousEdges(), 2 * aNbCells * (aNbCells - 1) + aNbCells);
+  EXPECT_EQ(aParSewing->NbContigousEdges(), aSeqSewing->NbContigousEdges());
+  EXPECT_EQ(aParSewing->NbFreeEdges(), aSeqSewing->NbFreeEdges());
+  EXPECT_EQ(aParSewing->NbMultipleEdges(), 0);
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSeqEdges, aParEdges;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSeqVerts, aParVerts;
+  TopExp::MapShapes(aSeqShape, TopAbs_EDGE, aSeqEdges);
+  TopExp::MapShapes(aParShape, TopAbs_EDGE, aParEdges);
+  TopExp::MapShapes(aSeqShape, TopAbs_VERTEX, aSeqVerts);
+  TopExp::MapShapes(aParShape, TopAbs_VERTEX, aParVerts);
+  EXPECT_EQ(aParEdges.Extent(), aSeqEdges.Extent());
+  EXPECT_EQ(aParVerts.Extent(), aSeqVerts.Extent());
+  EXPECT_EQ(aSeqVerts.Extent(), (aNbCells + 1) * (aNbCells + 1) + 2);
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRep_CurveRepresentation.hxx>
+#include <BRep_TEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <Geom2d_Line.hxx>
+#include <Geom_Plane.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Edge.hxx>
+#include <gp.hxx>
+#include <gp_Ax3.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Dir2d.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cmath>
+
+// Checkers looking up the indexed representations of an edge run concurrently
+// with read-only callers of BRep_TEdge::ChangeCurves() (like BRepCheck_Edge).
+TEST(BRepCheck_AnalyzerTest, ParallelChecksWithChangeCurves)
+{
+  BRepBuilderAPI_MakeEdge anEdgeMaker(gp_Pnt(0.0, 0.0, 0.0), gp_Pnt(10.0, 0.0, 0.0));
+  ASSERT_TRUE(anEdgeMaker.IsDone());
+  const TopoDS_Edge& anEdge = anEdgeMaker.Edge();
+
+  // pcurves on planes rotated around the edge, enough to make the edge index them
+  const int                                     aNbPlanes = 16;
+  NCollection_Array1<occ::handle<Geom_Surface>> aPlanes(1, aNbPlanes);
+  NCollection_Array1<occ::handle<Geom2d_Curve>> aPCurves(1, aNbPlanes);
+  BRep_Builder                                  aBuilder;
+  for (int aPlaneIter = 1; aPlaneIter <= aNbPlanes; ++aPlaneIter)
+  {
+    const double anAngle = M_PI * aPlaneIter / aNbPlanes;
+    aPlanes(aPlaneIter)  = new Geom_Plane(
+      gp_Ax3(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, std::cos(anAngle), std::sin(anAngle)), gp::DX()));
+    aPCurves(aPlaneIter) = new Geom2d_Line(gp_Pnt2d(0.0, 0.0), gp_Dir2d(1.0, 0.0));
+    aBuilder.UpdateEdge(anEdge, aPCurves(aPlaneIter), aPlanes(aPlaneIter), TopLoc_Location(), 0.0);
+  }
+  const occ::handle<BRep_TEdge>& aTEdge = occ::down_cast<BRep_TEdge>(anEdge.TShape());
+  const int                      aNbCurves = aTEdge->Curves().Extent();
+
+  std::atomic<int> aNbInvalid(0);
+  std::atomic<int> aNbWrongPCurves(0);
+  std::atomic<int> aNbWrongLists(0);
+  OSD_Parallel::For(0, 64, [&](const int theIndex) {
+    for (int anIter = 0; anIter < 20; ++anIter)
+    {
+      if (theIndex % 2 == 0)
+      {
+        BRepCheck_Analyzer anAnalyzer(anEdge);
+        if (!anAnalyzer.IsValid())
+        {
+          ++aNbInvalid;
+        }
+        double aFirst = 0.0, aLast = 0.0;
+        for (int aPlaneIter = 1; aPlaneIter <= aNbPlanes; ++aPlaneIter)
+        {
+          const occ::handle<Geom2d_Curve> aPCurve = BRep_Tool::CurveOnSurface(anEdge,
+                                                                              aPlanes(aPlaneIter),
+                                                                              TopLoc_Location(),
+                                                                              aFirst,
+                                                                              aLast);
+          if (aPCurve != aPCurves(aPlaneIter))
+          {
+            ++aNbWrongPCurves;
+          }
+        }
+      }
+      else if (aTEdge->ChangeCurves().Extent() != aNbCurves)
+      {
+        ++aNbWrongLists;
+      }
+    }
+  });
+  EXPECT_EQ(aNbInvalid, 0);
+  EXPECT_EQ(aNbWrongPCurves, 0);
+  EXPECT_EQ(aNbWrongLists, 0);
+
+  // the index is still updated after modifications
+  occ::handle<Geom2d_Curve> aNewPCurve = new Geom2d_Line(gp_Pnt2d(0.0, 0.0), gp_Dir2d(1.0, 0.0));
+  aBuilder.UpdateEdge(anEdge, aNewPCurve, aPlanes(3), TopLoc_Location(), 0.0);
+  double aFirst = 0.0, aLast = 0.0;
+  EXPECT_EQ(BRep_Tool::CurveOnSurface(anEdge, aPlanes(3), TopLoc_Location(), aFirst, aLast),
+            aNewPCurve);
+  EXPECT_EQ(BRep_Tool::CurveOnSurface(anEdge, aPlanes(4), TopLoc_Location(), aFirst, aLast),
+            aPCurves(4));
+}
@@ -15,6 +15,7 @@
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <gp_Pnt.hxx>
+#include <NCollection_Array1.hxx>
 #include <Precision.hxx>
 #include <TopAbs_State.hxx>
 #include <TopoDS_Shape.hxx>
@@ -81,3 +82,43 @@ TEST(BRepClass3d_SolidClassifierTest, PerformInfinitePoint)
 
   EXPECT_EQ(aClassifier.State(), TopAbs_OUT) << "Infinite point should be outside the box";
 }
+
+TEST(BRepClass3d_SolidClassifierTest, PerformPoints_MatchesSinglePoint)
+{
+  BRepPrimAPI_MakeSphere aMakeSphere(gp_Pnt(0.0, 0.0, 0.0), 5.0);
+  const TopoDS_Shape& aSphere = aMakeSphere.Shape();
+  ASSERT_TRUE(aMakeSphere.IsDone()) << "Sphere creation failed";
+
+  // grid of points covering the sphere, its boundary and the space around it
+  const int                  aNbSteps = 9;
+  NCollection_Array1<gp_Pnt> aPoints(1, aNbSteps * aNbSteps * aNbSteps);
+  int                        anIndex = 1;
+  for (int i = 0; i < aNbSteps; ++i)
+  {
+    for (int j = 0; j < aNbSteps; ++j)
+    {
+      for (int k = 0; k < aNbSteps; ++k)
+      {
+        aPoints.SetValue(anIndex++, gp_Pnt(-10.0 + 2.5 * i, -10.0 + 2.5 * j, -10.0 + 2.5 * k));
+      }
+    }
+  }
+
+  BRepClass3d_SolidClassifier      aClassifier(aSphere);
+  NCollection_Array1<TopAbs_State> aStates(aPoints.Lower(), aPoints.Upper());
+  NCollection_Array1<TopAbs_State> aStatesParallel(aPoints.Lower(), aPoints.Upper());
+  aClassifier.Perform(aPoints, Precision::Confusion(), aStates);
+  aClassifier.Perform(aPoints, Precision::Confusion(), aStatesParallel, true);
+
+  int aNbIn = 0, aNbOn = 0;
+  for (int i = aPoints.Lower(); i <= aPoints.Upper(); ++i)
+  {
+    aClassifier.Perform(aPoints.Value(i), Precision::Confusion());
+    EXPECT_EQ(aStates.Value(i), aClassifier.State()) << "Point " << i;
+    EXPECT_EQ(aStatesParallel.Value(i), aClassifier.State()) << "Point " << i;
+    aNbIn += aClassifier.State() == TopAbs_IN ? 1 : 0;
+    aNbOn += aClassifier.State() == TopAbs_ON ? 1 : 0;
+  }
+  EXPECT_GT(aNbIn, 0);
+  EXPECT_EQ(aNbOn, 6) << "Poles and equator points (+-5) should be on the sphere";
+}
@@ -14,6 +14,7 @@
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepGProp.hxx>
+#include <BRepGProp_MeshProps.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <BRepPrimAPI_MakeCylinder.hxx>
 #include <BRepPrimAPI_MakeSphere.hxx>
@@ -23,11 +24,13 @@
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_Plane.hxx>
 #include <GeomAdaptor_Curve.hxx>
+#include <gp_Ax2.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 #include <GProp_GProps.hxx>
 #include <GProp_PrincipalProps.hxx>
 #include <NCollection_Array1.hxx>
+#include <Poly_Triangulation.hxx>
 #include <Precision.hxx>
 #include <Standard_Handle.hxx>
 #include <TopExp_Explorer.hxx>
@@ -107,6 +110,62 @@ TEST(BRepGPropTest, VolumeProperties_BoxCenterOfMass)
   EXPECT_NEAR(aCOM.Z(), 5.0, Precision::Confusion());
 }
 
+TEST(BRepGPropTest, VolumeProperties_ParallelMatchesSequential)
+{
+  TopoDS_Shape aBox = BRepPrimAPI_MakeBox(20.0, 30.0, 40.0).Shape();
+  TopoDS_Shape aCyl =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(10.0, 15.0, -5.0), gp::DZ()), 5.0, 50.0).Shape();
+  BRepAlgoAPI_Cut aCut(aBox, aCyl);
+  ASSERT_TRUE(aCut.IsDone());
+
+  GProp_GProps aSeqProps, aParProps;
+  BRepGProp::VolumeProperties(aCut.Shape(), aSeqProps, false, false, false, false);
+  BRepGProp::VolumeProperties(aCut.Shape(), aParProps, false, false, false, true);
+
+  // Face contributions are summed in the same order, so results must be identical
+  EXPECT_EQ(aSeqProps.Mass(), aParProps.Mass());
+  EXPECT_TRUE(aSeqProps.CentreOfMass().IsEqual(aParProps.CentreOfMass(), 0.0));
+  const gp_Mat aSeqInertia = aSeqProps.MatrixOfInertia();
+  const gp_Mat aParInertia = aParProps.MatrixOfInertia();
+  for (int aRow = 1; aRow <= 3; ++aRow)
+  {
+    for (int aCol = 1; aCol <= 3; ++aCol)
+    {
+      EXPECT_EQ(aSeqInertia(aRow, aCol), aParInertia(aRow, aCol));
+    }
+  }
+
+  GProp_GProps aSeqSurf, aParSurf;
+  const double aSeqErr = BRepGProp::SurfaceProperties(aCut.Shape(), aSeqSurf, 1.0e-6, false, false);
+  const double aParErr = BRepGProp::SurfaceProperties(aCut.Shape(), aParSurf, 1.0e-6, false, true);
+  EXPECT_EQ(aSeqSurf.Mass(), aParSurf.Mass());
+  EXPECT_EQ(aSeqErr, aParErr);
+}
+
+TEST(BRepGPropTest, MeshProps_Tetrahedron)
+{
+  occ::handle<Poly_Triangulation> aMesh = new Poly_Triangulation(4, 4, false);
+  aMesh->SetNode(1, gp_Pnt(0.0, 0.0, 0.0));
+  aMesh->SetNode(2, gp_Pnt(1.0, 0.0, 0.0));
+  aMesh->SetNode(3, gp_Pnt(0.0, 1.0, 0.0));
+  aMesh->SetNode(4, gp_Pnt(0.0, 0.0, 1.0));
+  // triangles oriented outside
+  aMesh->SetTriangle(1, Poly_Triangle(1, 3, 2));
+  aMesh->SetTriangle(2, Poly_Triangle(1, 2, 4));
+  aMesh->SetTriangle(3, Poly_Triangle(1, 4, 3));
+  aMesh->SetTriangle(4, Poly_Triangle(2, 3, 4));
+
+  BRepGProp_MeshProps aVProps(BRepGProp_MeshProps::Vinert);
+  aVProps.SetLocation(gp_Pnt(0.3, -0.2, 0.5));
+  aVProps.Perform(aMesh, TopAbs_FORWARD);
+  EXPECT_NEAR(aVProps.Mass(), 1.0 / 6.0, Precision::Confusion());
+  EXPECT_TRUE(aVProps.CentreOfMass().IsEqual(gp_Pnt(0.25, 0.25, 0.25), Precision::Confusion()));
+
+  BRepGProp_MeshProps aSProps(BRepGProp_MeshProps::Sinert);
+  aSProps.Perform(aMesh, TopAbs_FORWARD);
+  EXPECT_NEAR(aSProps.Mass(), 1.5 + 0.5 * std::sqrt(3.0), Precision::Confusion());
+}
+
 TEST(BRepGPropTest, LinearProperties_SkipShared)
 {
   BRepPrimAPI_MakeBox aBox(10.0, 10.0, 10.0);
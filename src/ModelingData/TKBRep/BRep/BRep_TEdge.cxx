@@ -18,6 +18,10 @@
 #include <BRep_CurveRepresentation.hxx>
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
+#include <Geom_Surface.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <Poly_Triangulation.hxx>
 #include <Standard_Type.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -27,11 +31,99 @@ static const int ParameterMask   = 1;
 static const int RangeMask       = 2;
 static const int DegeneratedMask = 4;
 
+//! Minimal number of representations for building the index;
+//! shorter lists are scanned directly.
+static const int THE_CURVES_INDEX_MIN_EXTENT = 8;
+
+//! Maximal number of rebuilds of the index of modified representations;
+//! then the whole list is scanned, so that the number of kept outdated indices is limited.
+static const int THE_CURVES_INDEX_MAX_REBUILDS = 4;
+
+//! Index of curve representations by their surface or triangulation.
+struct BRep_TEdge::CurvesIndex
+{
+  typedef NCollection_List<occ::handle<BRep_CurveRepresentation>> ListOfCurves;
+
+  occ::handle<NCollection_IncAllocator>                      Allocator;
+  NCollection_DataMap<const Standard_Transient*, ListOfCurves> Map;
+
+  //! previous index kept for concurrent lookups and number of such indices
+  CurvesIndex* Outdated;
+  int          NbRebuilds;
+
+  //! value of BRep_TEdge::myCurvesStamp when the index is built,
+  //! number and extremities of indexed representations
+  unsigned int                    Stamp;
+  int                             NbCurves;
+  const BRep_CurveRepresentation* First;
+  const BRep_CurveRepresentation* Last;
+
+  CurvesIndex(const ListOfCurves& theCurves,
+              const unsigned int  theStamp,
+              CurvesIndex*        theOutdated)
+      : Allocator(new NCollection_IncAllocator()),
+        Map(1, Allocator),
+        Outdated(theOutdated),
+        NbRebuilds(theOutdated != nullptr ? theOutdated->NbRebuilds + 1 : 0),
+        Stamp(theStamp),
+        NbCurves(theCurves.Extent()),
+        First(theCurves.First().get()),
+        Last(theCurves.Last().get())
+  {
+    Map.ReSize(NbCurves);
+    for (ListOfCurves::Iterator aCurveIter(theCurves); aCurveIter.More(); aCurveIter.Next())
+    {
+      const occ::handle<BRep_CurveRepresentation>& aCurve = aCurveIter.Value();
+      if (aCurve->IsCurveOnSurface() || aCurve->IsPolygonOnSurface())
+      {
+        add(aCurve->Surface().get(), aCurve);
+      }
+      else if (aCurve->IsPolygonOnTriangulation())
+      {
+        add(aCurve->Triangulation().get(), aCurve);
+      }
+      if (aCurve->IsRegularity())
+      {
+        if (!aCurve->IsCurveOnSurface())
+        {
+          add(aCurve->Surface().get(), aCurve);
+        }
+        if (aCurve->Surface2() != aCurve->Surface())
+        {
+          add(aCurve->Surface2().get(), aCurve);
+        }
+      }
+    }
+  }
+
+  //! Returns true if the index corresponds to the list of representations;
+  //! modifications keeping the extremities and the length of the list
+  //! through a reference kept after lookups are not detected.
+  bool IsActual(const ListOfCurves& theCurves, const unsigned int theStamp) const
+  {
+    return Stamp == theStamp && NbCurves == theCurves.Extent() && First == theCurves.First().get()
+           && Last == theCurves.Last().get();
+  }
+
+  void add(const Standard_Transient*                    theGeometry,
+           const occ::handle<BRep_CurveRepresentation>& theCurve)
+  {
+    ListOfCurves* aList = Map.ChangeSeek(theGeometry);
+    if (aList == nullptr)
+    {
+      aList = Map.Bound(theGeometry, ListOfCurves(Allocator));
+    }
+    aList->Append(theCurve);
+  }
+};
+
 //=================================================================================================
 
 BRep_TEdge::BRep_TEdge()
     : myTolerance(RealEpsilon()),
-      myFlags(0)
+      myFlags(0),
+      myCurvesIndex(nullptr),
+      myCurvesStamp(0)
 {
   SameParameter(true);
   SameRange(true);
@@ -39,6 +131,63 @@ BRep_TEdge::BRep_TEdge()
 
 //=================================================================================================
 
+BRep_TEdge::~BRep_TEdge()
+{
+  for (CurvesIndex* anIndex = myCurvesIndex.load(std::memory_order_relaxed); anIndex != nullptr;)
+  {
+    CurvesIndex* anOutdated = anIndex->Outdated;
+    delete anIndex;
+    anIndex = anOutdated;
+  }
+}
+
+//=================================================================================================
+
+const NCollection_List<occ::handle<BRep_CurveRepresentation>>& BRep_TEdge::CurvesOn(
+  const Standard_Transient* theGeometry) const
+{
+  if (myCurves.Extent() < THE_CURVES_INDEX_MIN_EXTENT)
+  {
+    return myCurves;
+  }
+
+  const unsigned int aStamp  = myCurvesStamp.load(std::memory_order_relaxed);
+  CurvesIndex*       anIndex = myCurvesIndex.load(std::memory_order_acquire);
+  if (anIndex == nullptr || !anIndex->IsActual(myCurves, aStamp))
+  {
+    if (anIndex != nullptr && anIndex->NbRebuilds >= THE_CURVES_INDEX_MAX_REBUILDS)
+    {
+      return myCurves;
+    }
+
+    // the outdated index is kept, as it might still be used by concurrent lookups
+    CurvesIndex* aNewIndex = new CurvesIndex(myCurves, aStamp, anIndex);
+    if (myCurvesIndex.compare_exchange_strong(anIndex,
+                                              aNewIndex,
+                                              std::memory_order_acq_rel,
+                                              std::memory_order_acquire))
+    {
+      anIndex = aNewIndex;
+    }
+    else
+    {
+      // another thread has published its index first
+      delete aNewIndex;
+      if (!anIndex->IsActual(myCurves, aStamp))
+      {
+        return myCurves;
+      }
+    }
+  }
+
+  static const NCollection_List<occ::handle<BRep_CurveRepresentation>> THE_EMPTY_LIST;
+  const NCollection_List<occ::handle<BRep_CurveRepresentation>>*      aList =
+    anIndex->Map.Seek(theGeometry);
+  return aList != nullptr ? *aList : THE_EMPTY_LIST;
+}
+
+//=================================================================================================
+
 bool BRep_TEdge::SameParameter() const
 {
   return (myFlags & ParameterMask) != 0;
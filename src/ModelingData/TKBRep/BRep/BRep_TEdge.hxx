@@ -24,6 +24,9 @@
 #include <BRep_CurveRepresentation.hxx>
 #include <NCollection_List.hxx>
 #include <TopoDS_TEdge.hxx>
+
+#include <atomic>
+
 class TopoDS_TShape;
 
 //! The TEdge from BRep is inherited from the TEdge
@@ -36,6 +39,9 @@ class TopoDS_TShape;
 //! * same range flag.
 //! * Degenerated flag.
 //! * list of curve representation.
+//!
+//! Representations of edges having many of them are indexed
+//! by their surface or triangulation on first lookup (see CurvesOn()).
 class BRep_TEdge : public TopoDS_TEdge
 {
 
@@ -43,6 +49,9 @@ public:
   //! Creates an empty TEdge.
   Standard_EXPORT BRep_TEdge();
 
+  //! Destructor.
+  Standard_EXPORT ~BRep_TEdge() override;
+
   double Tolerance() const;
 
   void Tolerance(const double T);
@@ -65,8 +74,24 @@ public:
 
   const NCollection_List<occ::handle<BRep_CurveRepresentation>>& Curves() const;
 
+  //! Returns the modifiable list of curve representations.
+  //! Marks the index of representations as outdated (it is rebuilt by the next lookup),
+  //! so that the list should not be modified through a reference kept after lookups
+  //! by CurvesOn() (e.g. by BRep_Tool): ChangeCurves() should be called again after them.
   NCollection_List<occ::handle<BRep_CurveRepresentation>>& ChangeCurves();
 
+  //! Returns the curve representations which may be defined on the given surface
+  //! or triangulation (curves and polygons on surface, polygons on triangulation,
+  //! regularities), in the same order as within Curves().
+  //! For edges with few representations the whole list Curves() is returned,
+  //! so that the caller should still check each representation.
+  //! The index is built on the first call and is safe for concurrent lookups,
+  //! including concurrent calls of ChangeCurves() not modifying the list:
+  //! outdated indices are kept till destruction of the edge, and the edge falls back
+  //! to the whole list after a few rebuilds.
+  Standard_EXPORT const NCollection_List<occ::handle<BRep_CurveRepresentation>>& CurvesOn(
+    const Standard_Transient* theGeometry) const;
+
   //! Returns a copy of the TShape with no sub-shapes.
   Standard_EXPORT occ::handle<TopoDS_TShape> EmptyCopy() const override;
 
@@ -75,10 +100,16 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(BRep_TEdge, TopoDS_TEdge)
 
+private:
+  struct CurvesIndex;
+
 private:
   double                                                  myTolerance;
   int                                                     myFlags;
   NCollection_List<occ::handle<BRep_CurveRepresentation>> myCurves;
+  mutable std::atomic<CurvesIndex*>                       myCurvesIndex;
+  //! counter of ChangeCurves() calls to detect outdated index
+  std::atomic<unsigned int> myCurvesStamp;
 };
 
 #include <BRep_TEdge.lxx>
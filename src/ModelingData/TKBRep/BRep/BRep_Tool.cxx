@@ -373,7 +373,7 @@ occ::handle<Geom2d_Curve> BRep_Tool::CurveOnSurface(const TopoDS_Edge&
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
   if (itcr.More())
   {
     const TopLoc_Location loc = L.Predivided(E.Location());
@@ -616,7 +616,7 @@ occ::handle<Poly_Polygon2D> BRep_Tool::PolygonOnSurface(const TopoDS_Edge&
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
 
   while (itcr.More())
   {
@@ -728,7 +728,7 @@ const occ::handle<Poly_PolygonOnTriangulation>& BRep_Tool::PolygonOnTriangulatio
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(T.get()));
 
   while (itcr.More())
   {
@@ -864,7 +864,7 @@ bool BRep_Tool::IsClosed(const TopoDS_Edge&               E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
 
   while (itcr.More())
   {
@@ -897,7 +897,7 @@ bool BRep_Tool::IsClosed(const TopoDS_Edge&                     E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(T.get()));
 
   while (itcr.More())
   {
@@ -1009,7 +1009,7 @@ void BRep_Tool::Range(const TopoDS_Edge&               E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
 
   while (itcr.More())
   {
@@ -1051,7 +1051,7 @@ void BRep_Tool::UVPoints(const TopoDS_Edge&               E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
 
   while (itcr.More())
   {
@@ -1157,7 +1157,7 @@ void BRep_Tool::SetUVPoints(const TopoDS_Edge&               E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S.get()));
 
   while (itcr.More())
   {
@@ -1242,7 +1242,7 @@ bool BRep_Tool::HasContinuity(const TopoDS_Edge&               E,
 
   // find the representation
   const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->Curves());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S1.get()));
 
   while (itcr.More())
   {
@@ -1268,8 +1268,8 @@ GeomAbs_Shape BRep_Tool::Continuity(const TopoDS_Edge&               E,
   TopLoc_Location l2 = L2.Predivided(E.Location());
 
   // find the representation
-  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(
-    (*((occ::handle<BRep_TEdge>*)&E.TShape()))->ChangeCurves());
+  const BRep_TEdge* TE = static_cast<const BRep_TEdge*>(E.TShape().get());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator itcr(TE->CurvesOn(S1.get()));
 
   while (itcr.More())
   {
@@ -1310,7 +1310,7 @@ GeomAbs_Shape BRep_Tool::MaxContinuity(const TopoDS_Edge& theEdge)
 {
   GeomAbs_Shape aMaxCont = GeomAbs_C0;
   for (NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator aReprIter(
-         (*((occ::handle<BRep_TEdge>*)&theEdge.TShape()))->ChangeCurves());
+         static_cast<const BRep_TEdge*>(theEdge.TShape().get())->Curves());
        aReprIter.More();
        aReprIter.Next())
   {
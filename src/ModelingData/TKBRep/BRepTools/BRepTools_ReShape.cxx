@@ -693,3 +693,64 @@ occ::handle<BRepTools_History> BRepTools_ReShape::History() const
 
   return aHistory;
 }
+
+//=================================================================================================
+
+void BRepTools_ReShape::CopyRecords(const BRepTools_ReShape& theOther, const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    return;
+  }
+
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aVisited;
+  NCollection_List<TopoDS_Shape>                         aQueue;
+  aQueue.Append(theShape);
+  for (; !aQueue.IsEmpty(); aQueue.RemoveFirst())
+  {
+    const TopoDS_Shape& aShape = aQueue.First();
+    TopoDS_Shape        aKey   = aShape;
+    if (theOther.myConsiderLocation)
+    {
+      aKey.Location(TopLoc_Location(), false);
+    }
+    if (!aVisited.Add(aKey))
+    {
+      continue;
+    }
+
+    if (const TReplacement* aReplacement = theOther.myShapeToReplacement.Seek(aKey))
+    {
+      myShapeToReplacement.Bind(aKey, *aReplacement);
+      if (!aReplacement->RelationResult().IsNull())
+      {
+        aQueue.Append(aReplacement->RelationResult());
+      }
+    }
+    if (theOther.myNewShapes.Contains(aShape))
+    {
+      myNewShapes.Add(aShape);
+    }
+
+    for (TopoDS_Iterator aSubIter(aShape, false); aSubIter.More(); aSubIter.Next())
+    {
+      aQueue.Append(aSubIter.Value());
+    }
+  }
+}
+
+//=================================================================================================
+
+void BRepTools_ReShape::MergeRecords(const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator aRIt(theOther.myShapeToReplacement); aRIt.More(); aRIt.Next())
+  {
+    myShapeToReplacement.Bind(aRIt.Key(), aRIt.Value());
+  }
+  for (NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator aNIt(theOther.myNewShapes);
+       aNIt.More();
+       aNIt.Next())
+  {
+    myNewShapes.Add(aNIt.Value());
+  }
+}
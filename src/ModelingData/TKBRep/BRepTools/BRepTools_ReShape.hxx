@@ -157,6 +157,19 @@ public:
   //! Returns the history of the substituted shapes.
   Standard_EXPORT occ::handle<BRepTools_History> History() const;
 
+  //! Copies from another context the records of the given shape and of its sub-shapes,
+  //! and recursively the records of shapes these ones are replaced with.
+  //! Allows performing modifications of the shape in a separate context,
+  //! e.g. to modify several independent shapes in parallel threads.
+  //! @param[in] theOther context to copy records from
+  //! @param[in] theShape shape to copy records for
+  Standard_EXPORT void CopyRecords(const BRepTools_ReShape& theOther, const TopoDS_Shape& theShape);
+
+  //! Adds all records and new shapes of another context to this one;
+  //! existing records of the same shapes are overridden.
+  //! @param[in] theOther context to merge
+  Standard_EXPORT void MergeRecords(const BRepTools_ReShape& theOther);
+
   DEFINE_STANDARD_RTTIEXT(BRepTools_ReShape, Standard_Transient)
 
 protected:
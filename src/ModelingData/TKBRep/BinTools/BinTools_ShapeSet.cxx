@@ -40,14 +40,223 @@
 #include <Standard_Integer.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <OSD_Parallel.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Message_ProgressRange.hxx>
 
+#include <atomic>
+#include <climits>
 #include <cstring>
 
+namespace
+{
+//! Maximal size of raw triangulation data read from the stream at once for parallel decoding.
+constexpr size_t THE_TRIANGULATION_CHUNK_SIZE = 64 * 1024 * 1024;
+
+//! Reads a value of type T from the raw data and shifts the pointer.
+template <typename T>
+inline T readRaw(const char*& theData)
+{
+  T aValue;
+  std::memcpy(&aValue, theData, sizeof(T));
+  theData += sizeof(T);
+  return aValue;
+}
+
+//! Writes a value of type T into the raw data and shifts the pointer.
+template <typename T>
+inline void writeRaw(char*& theData, const T theValue)
+{
+  std::memcpy(theData, &theValue, sizeof(T));
+  theData += sizeof(T);
+}
+
+//! Appends the signed integer as zigzag variable-length integer (7 bits per byte).
+inline void writeVarInt(char*& theData, const int theValue)
+{
+  uint32_t aValue = (static_cast<uint32_t>(theValue) << 1) ^ static_cast<uint32_t>(theValue >> 31);
+  while (aValue >= 0x80)
+  {
+    *theData++ = static_cast<char>(aValue | 0x80);
+    aValue >>= 7;
+  }
+  *theData++ = static_cast<char>(aValue);
+}
+
+//! Reads the signed zigzag variable-length integer; returns FALSE if data is exhausted.
+inline bool readVarInt(const char*& theData, const char* theEnd, int& theValue)
+{
+  uint32_t aValue = 0;
+  for (int aShift = 0; aShift < 35; aShift += 7)
+  {
+    if (theData >= theEnd)
+    {
+      return false;
+    }
+    const uint8_t aByte = static_cast<uint8_t>(*theData++);
+    aValue |= static_cast<uint32_t>(aByte & 0x7F) << aShift;
+    if ((aByte & 0x80) == 0)
+    {
+      theValue = static_cast<int>((aValue >> 1) ^ (0u - (aValue & 1)));
+      return true;
+    }
+  }
+  return false;
+}
+
+//! Encodes triangles as deltas of node indices: the first node relatively to the first node
+//! of previous triangle, the other nodes relatively to the first one.
+//! Returns the size of encoded data; theData should have room for 15 bytes per triangle.
+size_t encodeTriangles(const Poly_Triangulation& theTriangulation, char* theData)
+{
+  char* aData  = theData;
+  int   aPrev1 = 0;
+  for (int aTriIter = 1; aTriIter <= theTriangulation.NbTriangles(); ++aTriIter)
+  {
+    int aN1 = 0, aN2 = 0, aN3 = 0;
+    theTriangulation.Triangle(aTriIter).Get(aN1, aN2, aN3);
+    writeVarInt(aData, aN1 - aPrev1);
+    writeVarInt(aData, aN2 - aN1);
+    writeVarInt(aData, aN3 - aN1);
+    aPrev1 = aN1;
+  }
+  return static_cast<size_t>(aData - theData);
+}
+
+//! Header and raw data location of triangulation stored in the stream.
+struct TriangulationData
+{
+  occ::handle<Poly_Triangulation> Triangulation;     //!< decoded triangulation
+  size_t                          Offset;            //!< offset of raw data within the chunk
+  size_t                          TrianglesSize;     //!< size of encoded triangles data
+  double                          Deflection;        //!< triangulation deflection
+  int                             NbNodes;           //!< number of nodes
+  int                             NbTriangles;       //!< number of triangles
+  bool                            HasUV;             //!< flag indicating UV nodes
+  bool                            HasNormals;        //!< flag indicating nodal normals
+  bool                            IsDoublePrecision; //!< flag indicating nodes stored as doubles
+  bool                            IsEncoded;         //!< flag indicating delta-encoded triangles
+
+  TriangulationData()
+      : Offset(0),
+        TrianglesSize(0),
+        Deflection(0.0),
+        NbNodes(0),
+        NbTriangles(0),
+        HasUV(false),
+        HasNormals(false),
+        IsDoublePrecision(true),
+        IsEncoded(false)
+  {
+  }
+
+  //! Returns the size of raw data following the header in the stream.
+  size_t Size() const
+  {
+    const size_t aCoordSize = IsDoublePrecision ? sizeof(double) : sizeof(float);
+    return size_t(NbNodes) * (HasUV ? 5 : 3) * aCoordSize + TrianglesSize
+           + (HasNormals ? size_t(NbNodes) * 3 * sizeof(float) : 0);
+  }
+
+  //! Creates triangulation from the raw data; returns FALSE if data is inconsistent.
+  bool Decode(const char* theData)
+  {
+    Triangulation = new Poly_Triangulation();
+    Triangulation->SetDoublePrecision(IsDoublePrecision);
+    Triangulation->ResizeNodes(NbNodes, false);
+    Triangulation->ResizeTriangles(NbTriangles, false);
+    if (HasUV)
+    {
+      Triangulation->AddUVNodes();
+    }
+    if (HasNormals)
+    {
+      Triangulation->AddNormals();
+    }
+    Triangulation->Deflection(Deflection);
+    if (IsDoublePrecision)
+    {
+      for (int aNodeIter = 1; aNodeIter <= NbNodes; ++aNodeIter)
+      {
+        const double aX = readRaw<double>(theData);
+        const double aY = readRaw<double>(theData);
+        const double aZ = readRaw<double>(theData);
+        Triangulation->SetNode(aNodeIter, gp_Pnt(aX, aY, aZ));
+      }
+      for (int aNodeIter = 1; HasUV && aNodeIter <= NbNodes; ++aNodeIter)
+      {
+        const double aU = readRaw<double>(theData);
+        const double aV = readRaw<double>(theData);
+        Triangulation->SetUVNode(aNodeIter, gp_Pnt2d(aU, aV));
+      }
+    }
+    else
+    {
+      for (int aNodeIter = 1; aNodeIter <= NbNodes; ++aNodeIter)
+      {
+        const float aX = readRaw<float>(theData);
+        const float aY = readRaw<float>(theData);
+        const float aZ = readRaw<float>(theData);
+        Triangulation->SetNode(aNodeIter, gp_Pnt(aX, aY, aZ));
+      }
+      for (int aNodeIter = 1; HasUV && aNodeIter <= NbNodes; ++aNodeIter)
+      {
+        const float aU = readRaw<float>(theData);
+        const float aV = readRaw<float>(theData);
+        Triangulation->SetUVNode(aNodeIter, gp_Pnt2d(aU, aV));
+      }
+    }
+    if (IsEncoded)
+    {
+      const char* aTrianglesEnd = theData + TrianglesSize;
+      int         aN1 = 0, aDelta1 = 0, aDelta2 = 0, aDelta3 = 0;
+      for (int aTriIter = 1; aTriIter <= NbTriangles; ++aTriIter)
+      {
+        if (!readVarInt(theData, aTrianglesEnd, aDelta1)
+            || !readVarInt(theData, aTrianglesEnd, aDelta2)
+            || !readVarInt(theData, aTrianglesEnd, aDelta3))
+        {
+          return false;
+        }
+        aN1 += aDelta1;
+        Triangulation->SetTriangle(aTriIter, Poly_Triangle(aN1, aN1 + aDelta2, aN1 + aDelta3));
+      }
+      if (theData != aTrianglesEnd)
+      {
+        return false;
+      }
+    }
+    else
+    {
+      for (int aTriIter = 1; aTriIter <= NbTriangles; ++aTriIter)
+      {
+        const int aN1 = readRaw<int>(theData);
+        const int aN2 = readRaw<int>(theData);
+        const int aN3 = readRaw<int>(theData);
+        Triangulation->SetTriangle(aTriIter, Poly_Triangle(aN1, aN2, aN3));
+      }
+    }
+    if (HasNormals)
+    {
+      NCollection_Vec3<float> aNormal;
+      for (int aNormalIter = 1; aNormalIter <= NbNodes; ++aNormalIter)
+      {
+        aNormal.x() = readRaw<float>(theData);
+        aNormal.y() = readRaw<float>(theData);
+        aNormal.z() = readRaw<float>(theData);
+        Triangulation->SetNormal(aNormalIter, aNormal);
+      }
+    }
+    return true;
+  }
+};
+} // namespace
+
 //=================================================================================================
 
 BinTools_ShapeSet::BinTools_ShapeSet()
@@ -1500,6 +1709,22 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream&            OS,
       bool      NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
       const int aNbNodes           = aTriangulation->NbNodes();
       const int aNbTriangles       = aTriangulation->NbTriangles();
+      // since version 5, nodes of single precision triangulation are stored as floats
+      // and triangles are stored as delta-encoded variable-length integers
+      const bool isCompact = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+      const bool isDouble  = !isCompact || aTriangulation->IsDoublePrecision();
+      NCollection_Array1<char> anEncodedTriangles;
+      size_t                   anEncodedSize = 0;
+      if (isCompact && aNbTriangles > 0)
+      {
+        anEncodedTriangles.Resize(size_t(aNbTriangles) * 15, false);
+        anEncodedSize = encodeTriangles(*aTriangulation, &anEncodedTriangles.ChangeFirst());
+        if (anEncodedSize > size_t(INT_MAX))
+        {
+          throw Standard_Failure("Triangulation is too large");
+        }
+      }
+
       BinTools::PutInteger(OS, aNbNodes);
       BinTools::PutInteger(OS, aNbTriangles);
       BinTools::PutBool(OS, aTriangulation->HasUVNodes());
@@ -1507,15 +1732,29 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream&            OS,
       {
         BinTools::PutBool(OS, aTriangulation->HasNormals() && NeedToWriteNormals);
       }
+      if (isCompact)
+      {
+        BinTools::PutBool(OS, isDouble);
+        BinTools::PutInteger(OS, static_cast<int>(anEncodedSize));
+      }
       BinTools::PutReal(OS, aTriangulation->Deflection());
 
       // write the 3d nodes
       for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
       {
         const gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
+        if (isDouble)
+        {
+          BinTools::PutReal(OS, aPnt.X());
+          BinTools::PutReal(OS, aPnt.Y());
+          BinTools::PutReal(OS, aPnt.Z());
+        }
+        else
+        {
+          BinTools::PutShortReal(OS, static_cast<float>(aPnt.X()));
+          BinTools::PutShortReal(OS, static_cast<float>(aPnt.Y()));
+          BinTools::PutShortReal(OS, static_cast<float>(aPnt.Z()));
+        }
       }
 
       if (aTriangulation->HasUVNodes())
@@ -1523,17 +1762,35 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream&            OS,
         for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
         {
           const gp_Pnt2d aUV = aTriangulation->UVNode(aNodeIter);
-          BinTools::PutReal(OS, aUV.X());
-          BinTools::PutReal(OS, aUV.Y());
+          if (isDouble)
+          {
+            BinTools::PutReal(OS, aUV.X());
+            BinTools::PutReal(OS, aUV.Y());
+          }
+          else
+          {
+            BinTools::PutShortReal(OS, static_cast<float>(aUV.X()));
+            BinTools::PutShortReal(OS, static_cast<float>(aUV.Y()));
+          }
         }
       }
 
-      for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      if (isCompact)
+      {
+        if (anEncodedSize != 0)
+        {
+          OS.write(&anEncodedTriangles.First(), static_cast<std::streamsize>(anEncodedSize));
+        }
+      }
+      else
       {
-        const Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
-        BinTools::PutInteger(OS, aTri.Value(1));
-        BinTools::PutInteger(OS, aTri.Value(2));
-        BinTools::PutInteger(OS, aTri.Value(3));
+        for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+        {
+          const Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
+          BinTools::PutInteger(OS, aTri.Value(1));
+          BinTools::PutInteger(OS, aTri.Value(2));
+          BinTools::PutInteger(OS, aTri.Value(3));
+        }
       }
 
       // write the normals
@@ -1581,71 +1838,82 @@ void BinTools_ShapeSet::ReadTriangulation(Standard_IStream&            IS,
   {
     OCC_CATCH_SIGNALS
     Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
-    for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();
-         ++aTriangulationIter, aPS.Next())
+    // the size of triangulation data is defined by its header, so that the stream is read
+    // sequentially by chunks of raw data, which are then decoded in parallel
+    NCollection_DynamicArray<TriangulationData> aChunk;
+    NCollection_Array1<char>                    aChunkData;
+    for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();)
     {
-      int    aNbNodes = 0, aNbTriangles = 0;
-      bool   hasUV      = false;
-      bool   hasNormals = false;
-      double aDefl      = 0.0;
-      BinTools::GetInteger(IS, aNbNodes);
-      BinTools::GetInteger(IS, aNbTriangles);
-      BinTools::GetBool(IS, hasUV);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
+      aChunk.Clear();
+      size_t aChunkSize = 0;
+      for (; aTriangulationIter <= aNbTriangulations && aChunkSize < THE_TRIANGULATION_CHUNK_SIZE;
+           ++aTriangulationIter)
       {
-        BinTools::GetBool(IS, hasNormals);
-      }
-      BinTools::GetReal(IS, aDefl); // deflection
-      occ::handle<Poly_Triangulation> aTriangulation =
-        new Poly_Triangulation(aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection(aDefl);
-
-      gp_Pnt aNode;
-      for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(3));
-        aTriangulation->SetNode(aNodeIter, aNode);
-      }
-
-      if (hasUV)
-      {
-        gp_Pnt2d aNode2d;
-        for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+        TriangulationData& aData = aChunk.Appended();
+        BinTools::GetInteger(IS, aData.NbNodes);
+        BinTools::GetInteger(IS, aData.NbTriangles);
+        BinTools::GetBool(IS, aData.HasUV);
+        if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
         {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(2));
-          aTriangulation->SetUVNode(aNodeIter, aNode2d);
+          BinTools::GetBool(IS, aData.HasNormals);
+        }
+        int aTrianglesSize = 0;
+        if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+        {
+          BinTools::GetBool(IS, aData.IsDoublePrecision);
+          BinTools::GetInteger(IS, aTrianglesSize);
+          aData.IsEncoded = true;
+        }
+        BinTools::GetReal(IS, aData.Deflection); // deflection
+        if (aData.NbNodes < 0 || aData.NbTriangles < 0 || aTrianglesSize < 0)
+        {
+          throw Standard_Failure("Invalid size of triangulation");
+        }
+        aData.TrianglesSize = aData.IsEncoded ? size_t(aTrianglesSize)
+                                              : size_t(aData.NbTriangles) * 3 * sizeof(int);
+        aData.Offset = aChunkSize;
+        aChunkSize += aData.Size();
+        if (aData.Size() == 0)
+        {
+          continue;
+        }
+        if (aChunkData.Size() < aChunkSize)
+        {
+          const size_t aNewSize = std::max(aChunkSize, 2 * aChunkData.Size());
+          aChunkData.Resize(aNewSize, true);
+        }
+        if (!IS.read(&aChunkData.ChangeFirst() + aData.Offset,
+                     static_cast<std::streamsize>(aData.Size())))
+        {
+          throw Storage_StreamTypeMismatchError();
         }
       }
 
-      // read the triangles
-      int aTriNodes[3] = {};
-      for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      const char*       aChunkBytes = aChunkData.IsEmpty() ? nullptr : &aChunkData.First();
+      std::atomic<bool> isCorrupted(false);
+      OSD_Parallel::For(
+        0,
+        static_cast<int>(aChunk.Size()),
+        [&](const int theIndex) {
+          TriangulationData& aData = aChunk.ChangeValue(theIndex);
+          if (!aData.Decode(aChunkBytes + aData.Offset))
+          {
+            isCorrupted = true;
+          }
+        },
+        aChunk.Size() < 2);
+      if (isCorrupted)
       {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle(aTriIter,
-                                    Poly_Triangle(aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+        throw Standard_Failure("Corrupted triangles data");
       }
-      // IS.ignore(sizeof(double) * (hasUV ? 5 : 3) * aNbNodes + sizeof(int) * 3
-      // * aNbTriangles);
 
-      if (hasNormals)
+      for (NCollection_DynamicArray<TriangulationData>::Iterator aDataIter(aChunk);
+           aDataIter.More() && aPS.More();
+           aDataIter.Next(), aPS.Next())
       {
-        NCollection_Vec3<float> aNormal;
-        for (int aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-        {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal(aNormalIter, aNormal);
-        }
+        const TriangulationData& aData = aDataIter.Value();
+        myTriangulations.Add(aData.Triangulation, aData.HasNormals);
       }
-
-      myTriangulations.Add(aTriangulation, hasNormals);
     }
   }
   catch (Standard_Failure const& anException)
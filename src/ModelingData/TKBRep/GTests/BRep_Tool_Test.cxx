@@ -12,17 +12,21 @@
 // commercial license or contractual agreement.
 
 #include <BRep_Builder.hxx>
+#include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <Geom2d_Curve.hxx>
+#include <Geom2d_Line.hxx>
 #include <Geom_BezierCurve.hxx>
 #include <Geom_Circle.hxx>
+#include <Geom_CylindricalSurface.hxx>
 #include <Geom_Curve.hxx>
 #include <Geom_Plane.hxx>
 #include <Geom_Surface.hxx>
 #include <gp.hxx>
 #include <gp_Ax2.hxx>
+#include <gp_Ax3.hxx>
 #include <gp_Pnt.hxx>
 #include <NCollection_Array1.hxx>
 #include <Precision.hxx>
@@ -261,3 +265,68 @@ TEST(BRep_Tool_Test, CurveOnPlane_RejectsEqualPeriodicRange)
   EXPECT_DOUBLE_EQ(aFirst, 0.0);
   EXPECT_DOUBLE_EQ(aLast, 0.0);
 }
+
+TEST(BRep_Tool_Test, CurveOnSurface_ManyRepresentations)
+{
+  BRepBuilderAPI_MakeEdge anEdgeMaker(gp_Pnt(0.0, 0.0, 0.0), gp_Pnt(1.0, 0.0, 0.0));
+  ASSERT_TRUE(anEdgeMaker.IsDone());
+  const TopoDS_Edge& anEdge = anEdgeMaker.Edge();
+
+  // enough pcurves to make the edge index its representations
+  const int                                     aNbSurfaces = 12;
+  NCollection_Array1<occ::handle<Geom_Surface>> aSurfaces(1, aNbSurfaces);
+  NCollection_Array1<occ::handle<Geom2d_Curve>> aPCurves(1, aNbSurfaces);
+  BRep_Builder                                  aBuilder;
+  for (int aSurfIter = 1; aSurfIter <= aNbSurfaces; ++aSurfIter)
+  {
+    aSurfaces(aSurfIter) =
+      new Geom_CylindricalSurface(gp_Ax3(gp_Pnt(0.0, 0.0, -aSurfIter), gp::DX()), aSurfIter);
+    aPCurves(aSurfIter) = new Geom2d_Line(gp_Pnt2d(0.0, aSurfIter), gp_Dir2d(0.0, 1.0));
+    aBuilder.UpdateEdge(anEdge, aPCurves(aSurfIter), aSurfaces(aSurfIter), TopLoc_Location(), 0.0);
+  }
+
+  double aFirst = 0.0, aLast = 0.0;
+  for (int aSurfIter = 1; aSurfIter <= aNbSurfaces; ++aSurfIter)
+  {
+    EXPECT_EQ(
+      BRep_Tool::CurveOnSurface(anEdge, aSurfaces(aSurfIter), TopLoc_Location(), aFirst, aLast),
+      aPCurves(aSurfIter));
+  }
+
+  // location is a part of the key
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(0.0, 0.0, 1.0));
+  const TopLoc_Location aLoc(aTrsf);
+  EXPECT_TRUE(BRep_Tool::CurveOnSurface(anEdge, aSurfaces(1), aLoc, aFirst, aLast).IsNull());
+
+  // replace pcurve using the builder
+  occ::handle<Geom2d_Curve> aNewPCurve = new Geom2d_Line(gp_Pnt2d(1.0, 3.0), gp_Dir2d(0.0, 1.0));
+  aBuilder.UpdateEdge(anEdge, aNewPCurve, aSurfaces(3), TopLoc_Location(), 0.0);
+  EXPECT_EQ(BRep_Tool::CurveOnSurface(anEdge, aSurfaces(3), TopLoc_Location(), aFirst, aLast),
+            aNewPCurve);
+
+  // remove pcurve directly from the list of representations
+  const occ::handle<BRep_TEdge>& aTEdge = occ::down_cast<BRep_TEdge>(anEdge.TShape());
+  NCollection_List<occ::handle<BRep_CurveRepresentation>>& aCurves = aTEdge->ChangeCurves();
+  for (NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator aCurveIter(aCurves);
+       aCurveIter.More();
+       aCurveIter.Next())
+  {
+    if (aCurveIter.Value()->IsCurveOnSurface(aSurfaces(5), TopLoc_Location()))
+    {
+      aCurves.Remove(aCurveIter);
+      break;
+    }
+  }
+  bool isStored = true;
+  EXPECT_TRUE(BRep_Tool::CurveOnSurface(anEdge,
+                                        aSurfaces(5),
+                                        TopLoc_Location(),
+                                        aFirst,
+                                        aLast,
+                                        &isStored)
+                .IsNull());
+  EXPECT_FALSE(isStored);
+  EXPECT_EQ(BRep_Tool::CurveOnSurface(anEdge, aSurfaces(6), TopLoc_Location(), aFirst, aLast),
+            aPCurves(6));
+}
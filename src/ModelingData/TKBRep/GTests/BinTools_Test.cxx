@@ -0,0 +1,155 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+//! Creates a triangulated grid of theNbCells x theNbCells cells.
+occ::handle<Poly_Triangulation> makeGrid(const int  theNbCells,
+                                         const bool theHasNormals,
+                                         const bool theIsDouble = true)
+{
+  occ::handle<Poly_Triangulation> aTris = new Poly_Triangulation();
+  aTris->SetDoublePrecision(theIsDouble);
+  aTris->ResizeNodes((theNbCells + 1) * (theNbCells + 1), false);
+  aTris->ResizeTriangles(2 * theNbCells * theNbCells, false);
+  aTris->AddUVNodes();
+  if (theHasNormals)
+  {
+    aTris->AddNormals();
+  }
+  for (int i = 0; i <= theNbCells; ++i)
+  {
+    for (int j = 0; j <= theNbCells; ++j)
+    {
+      const int aNode = i * (theNbCells + 1) + j + 1;
+      aTris->SetNode(aNode, gp_Pnt(i, j, 0.1 * i * j));
+      aTris->SetUVNode(aNode, gp_Pnt2d(i, j));
+      if (theHasNormals)
+      {
+        aTris->SetNormal(aNode, gp_Dir(0.0, 0.0, 1.0));
+      }
+    }
+  }
+  int aTri = 1;
+  for (int i = 0; i < theNbCells; ++i)
+  {
+    for (int j = 0; j < theNbCells; ++j)
+    {
+      const int aNode = i * (theNbCells + 1) + j + 1;
+      aTris->SetTriangle(aTri++, Poly_Triangle(aNode, aNode + 1, aNode + theNbCells + 2));
+      aTris->SetTriangle(aTri++,
+                         Poly_Triangle(aNode, aNode + theNbCells + 2, aNode + theNbCells + 1));
+    }
+  }
+  aTris->Deflection(0.01 * theNbCells);
+  return aTris;
+}
+
+//! Writes the shape in specified format version, reads it back
+//! and checks that triangulations of faces are restored exactly.
+void checkTriangulationsRoundTrip(const TopoDS_Shape&          theShape,
+                                  const BinTools_FormatVersion theVersion)
+{
+  std::stringstream aStream;
+  BinTools::Write(theShape, aStream, true, true, theVersion);
+  TopoDS_Shape aResult;
+  BinTools::Read(aResult, aStream);
+  ASSERT_FALSE(aResult.IsNull());
+
+  TopExp_Explorer anExpOrig(theShape, TopAbs_FACE), anExpRes(aResult, TopAbs_FACE);
+  for (; anExpOrig.More() && anExpRes.More(); anExpOrig.Next(), anExpRes.Next())
+  {
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& anOrig =
+      BRep_Tool::Triangulation(TopoDS::Face(anExpOrig.Current()), aLoc);
+    const occ::handle<Poly_Triangulation>& aRes =
+      BRep_Tool::Triangulation(TopoDS::Face(anExpRes.Current()), aLoc);
+    ASSERT_FALSE(aRes.IsNull());
+    ASSERT_EQ(anOrig->NbNodes(), aRes->NbNodes());
+    ASSERT_EQ(anOrig->NbTriangles(), aRes->NbTriangles());
+    ASSERT_EQ(anOrig->HasUVNodes(), aRes->HasUVNodes());
+    ASSERT_EQ(anOrig->HasNormals(), aRes->HasNormals());
+    EXPECT_EQ(anOrig->IsDoublePrecision(), aRes->IsDoublePrecision());
+    EXPECT_EQ(anOrig->Deflection(), aRes->Deflection());
+    for (int aNodeIter = 1; aNodeIter <= anOrig->NbNodes(); ++aNodeIter)
+    {
+      EXPECT_TRUE(anOrig->Node(aNodeIter).IsEqual(aRes->Node(aNodeIter), 0.0));
+      EXPECT_TRUE(anOrig->UVNode(aNodeIter).IsEqual(aRes->UVNode(aNodeIter), 0.0));
+      if (anOrig->HasNormals())
+      {
+        EXPECT_TRUE(anOrig->Normal(aNodeIter).IsEqual(aRes->Normal(aNodeIter), 0.0));
+      }
+    }
+    for (int aTriIter = 1; aTriIter <= anOrig->NbTriangles(); ++aTriIter)
+    {
+      int aN[6];
+      anOrig->Triangle(aTriIter).Get(aN[0], aN[1], aN[2]);
+      aRes->Triangle(aTriIter).Get(aN[3], aN[4], aN[5]);
+      EXPECT_EQ(aN[0], aN[3]);
+      EXPECT_EQ(aN[1], aN[4]);
+      EXPECT_EQ(aN[2], aN[5]);
+    }
+  }
+  EXPECT_FALSE(anExpOrig.More());
+  EXPECT_FALSE(anExpRes.More());
+}
+
+} // namespace
+
+TEST(BinToolsTest, ReadWrite_Triangulations)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aComp;
+  aBuilder.MakeCompound(aComp);
+  for (int aFaceIter = 1; aFaceIter <= 8; ++aFaceIter)
+  {
+    TopoDS_Face aFace;
+    aBuilder.MakeFace(aFace, makeGrid(aFaceIter * 5, aFaceIter % 2 == 0));
+    aBuilder.Add(aComp, aFace);
+  }
+
+  checkTriangulationsRoundTrip(aComp, BinTools_FormatVersion_VERSION_4);
+}
+
+TEST(BinToolsTest, ReadWrite_CompactTriangulations)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aComp;
+  aBuilder.MakeCompound(aComp);
+  for (int aFaceIter = 1; aFaceIter <= 8; ++aFaceIter)
+  {
+    TopoDS_Face aFace;
+    aBuilder.MakeFace(aFace, makeGrid(aFaceIter * 5, aFaceIter % 2 == 0, aFaceIter % 3 != 0));
+    aBuilder.Add(aComp, aFace);
+  }
+
+  checkTriangulationsRoundTrip(aComp, BinTools_FormatVersion_VERSION_5);
+
+  std::stringstream aStream4, aStream5;
+  BinTools::Write(aComp, aStream4, true, true, BinTools_FormatVersion_VERSION_4);
+  BinTools::Write(aComp, aStream5, true, true, BinTools_FormatVersion_VERSION_5);
+  EXPECT_LT(aStream5.str().size(), aStream4.str().size());
+}